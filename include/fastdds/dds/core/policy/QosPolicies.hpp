@@ -2810,6 +2810,7 @@ public:
         , domain_ids_(b.max_domains() != 0 ?
                 b.max_domains() :
                 b.domain_ids().size())
+        , huge_pages_(b.huge_pages())
     {
         domain_ids_ = b.domain_ids();
     }
@@ -2826,6 +2827,7 @@ public:
                 max_domains_ :
                 b.domain_ids().size());
         domain_ids_ = b.domain_ids();
+        huge_pages_ = b.huge_pages();
 
         return *this;
     }
@@ -2836,6 +2838,7 @@ public:
         return kind_ == b.kind_ &&
                shm_directory_ == b.shm_directory_ &&
                domain_ids_ == b.domain_ids_ &&
+               huge_pages_ == b.huge_pages_ &&
                Parameter_t::operator ==(b) &&
                QosPolicy::operator ==(b);
     }
@@ -2898,6 +2901,28 @@ public:
         return max_domains_;
     }
 
+    /**
+     * @return whether the writer's shared memory pool is backed by huge pages
+     */
+    RTPS_DllAPI bool huge_pages() const
+    {
+        return huge_pages_;
+    }
+
+    /**
+     * @brief Configures whether the writer's shared memory pool is backed by huge pages
+     *
+     * When enabled, the pool is sized to whole huge pages and prefaulted on creation.
+     * If the system does not support huge pages, regular pages are used.
+     *
+     * @param huge_pages true to request huge pages
+     */
+    RTPS_DllAPI void huge_pages(
+            bool huge_pages)
+    {
+        huge_pages_ = huge_pages;
+    }
+
     /**
      * @brief Configures the DataSharing in automatic mode
      *
@@ -3040,6 +3065,9 @@ private:
 
     //! Only endpoints with matching domain IDs are DataSharing compatible
     std::vector<uint64_t> domain_ids_;
+
+    //! Whether the shared memory pool is backed by huge pages
+    bool huge_pages_ = false;
 };
 
 
@@ -530,6 +530,67 @@ public:
     RTPS_DllAPI ReturnCode_t discard_loan(
             void*& sample);
 
+    /**
+     * @brief Get a buffer on the internal pool where the user could directly serialize a sample.
+     *
+     * Unlike @ref loan_sample, this method can be used with any data type, including those with strings or sequences.
+     * The buffer starts with the representation header, so it can be filled with a CDR serializer built on top of it,
+     * i.e. calling serialize_encapsulation() first and then serializing the fields of the sample.
+     *
+     * Once the buffer has been filled, it can then be published by calling @ref write_serialized_loan.
+     * After a successful call to @ref write_serialized_loan, the middleware takes ownership of the loaned buffer
+     * again, and the user should not access that memory again.
+     *
+     * If, for whatever reason, the sample is not published, the loan can be returned by calling
+     * @ref discard_serialized_loan.
+     *
+     * @param [out] buffer       Pointer to the buffer on the internal pool.
+     * @param [out] buffer_size  Size of the loaned buffer. It may be larger than @c max_size.
+     * @param [in]  max_size     Maximum serialized size the user will write, including the representation header.
+     *
+     * @return ReturnCode_t::RETCODE_BAD_PARAMETER if @c max_size cannot hold the representation header.
+     * @return ReturnCode_t::RETCODE_NOT_ENABLED if the writer has not been enabled.
+     * @return ReturnCode_t::RETCODE_OUT_OF_RESOURCES if the pool has been exhausted or its payloads are smaller
+     * than @c max_size.
+     * @return ReturnCode_t::RETCODE_OK if a buffer is successfully obtained.
+     */
+    RTPS_DllAPI ReturnCode_t loan_serialized_payload(
+            fastrtps::rtps::octet*& buffer,
+            uint32_t& buffer_size,
+            uint32_t max_size);
+
+    /**
+     * @brief Publishes a buffer previously obtained with @ref loan_serialized_payload.
+     *
+     * As the sample is not deserialized, the instance handle should be provided for keyed topics.
+     *
+     * @param [in,out] buffer  Pointer to the previously loaned buffer. Set to nullptr on success.
+     * @param [in]     length  Number of bytes serialized on the buffer, including the representation header.
+     * @param [in]     handle  Instance handle of the sample. Must not be HANDLE_NIL for keyed topics.
+     *
+     * @return ReturnCode_t::RETCODE_NOT_ENABLED if the writer has not been enabled.
+     * @return ReturnCode_t::RETCODE_BAD_PARAMETER if the pointer does not correspond to a loaned buffer,
+     * or the length does not fit on it.
+     * @return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET if the topic is keyed and no handle is provided.
+     * @return ReturnCode_t::RETCODE_OK if the sample is correctly sent, or the error returned by @ref write otherwise.
+     */
+    RTPS_DllAPI ReturnCode_t write_serialized_loan(
+            fastrtps::rtps::octet*& buffer,
+            uint32_t length,
+            const InstanceHandle_t& handle = HANDLE_NIL);
+
+    /**
+     * @brief Discards a buffer loaned with @ref loan_serialized_payload.
+     *
+     * @param [in,out] buffer  Pointer to the previously loaned buffer.
+     *
+     * @return ReturnCode_t::RETCODE_NOT_ENABLED if the writer has not been enabled.
+     * @return ReturnCode_t::RETCODE_BAD_PARAMETER if the pointer does not correspond to a loaned buffer.
+     * @return ReturnCode_t::RETCODE_OK if the loan is successfully discarded.
+     */
+    RTPS_DllAPI ReturnCode_t discard_serialized_loan(
+            fastrtps::rtps::octet*& buffer);
+
     /**
      * @brief Get the list of locators from which this DataWriter may send data.
      *
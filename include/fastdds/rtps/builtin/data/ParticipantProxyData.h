@@ -28,12 +28,14 @@
 #include <fastdds/rtps/attributes/ReaderAttributes.h>
 #include <fastdds/rtps/common/Token.h>
 #include <fastdds/rtps/common/RemoteLocators.hpp>
+#include <fastdds/rtps/common/SerializedPayload.h>
 
 #if HAVE_SECURITY
 #include <fastdds/rtps/security/accesscontrol/ParticipantSecurityAttributes.h>
 #endif // if HAVE_SECURITY
 
 #include <chrono>
+#include <vector>
 
 #define BUILTIN_PARTICIPANT_DATA_MAX_SIZE 100
 #define TYPELOOKUP_DATA_MAX_SIZE 5000
@@ -227,6 +229,21 @@ public:
 
     void assert_liveliness();
 
+    /**
+     * Check whether a received announcement is identical to the one this data was last read from.
+     * @param payload Serialized payload of the received announcement.
+     * @return True if the payload is identical to the one stored with @ref store_announcement.
+     */
+    bool is_same_announcement(
+            const SerializedPayload_t& payload) const;
+
+    /**
+     * Keep a copy of the announcement this data has been read from.
+     * @param payload Serialized payload of the announcement.
+     */
+    void store_announcement(
+            const SerializedPayload_t& payload);
+
     const std::chrono::steady_clock::time_point& last_received_message_tm() const
     {
         return last_received_message_tm_;
@@ -244,6 +261,9 @@ private:
 
     //! Remote participant lease duration in microseconds.
     std::chrono::microseconds lease_duration_;
+
+    //! Serialized payload of the last announcement this data has been read from.
+    std::vector<octet> last_announcement_;
 };
 
 } /* namespace rtps */
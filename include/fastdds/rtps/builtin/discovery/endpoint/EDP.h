@@ -32,6 +32,13 @@
 #include <foonathan/memory/container.hpp>
 #include <foonathan/memory/memory_pool.hpp>
 
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
 #define MATCH_FAILURE_REASON_COUNT size_t(16)
 
 namespace eprosima {
@@ -51,6 +58,7 @@ class RTPSWriter;
 class RTPSReader;
 class WriterProxyData;
 class RTPSParticipantImpl;
+class PartitionMatcher;
 
 /**
  * Class EDP, base class for Endpoint Discovery Protocols. It contains generic methods used by the two EDP implemented (EDPSimple and EDPStatic), as well as abstract methods
@@ -253,23 +261,27 @@ public:
      * Unpair a WriterProxyData object from all local readers.
      * @param participant_guid GUID of the participant.
      * @param writer_guid GUID of the writer.
+     * @param topic_name Name of the topic of the writer. Only local readers on this topic are checked.
      * @param removed_by_lease Whether the writer is being unpaired due to a participant drop.
      * @return True if correct.
      */
     bool unpairWriterProxy(
             const GUID_t& participant_guid,
             const GUID_t& writer_guid,
+            const std::string& topic_name,
             bool removed_by_lease);
 
     /**
      * Unpair a ReaderProxyData object from all local writers.
      * @param participant_guid GUID of the participant.
      * @param reader_guid GUID of the reader.
+     * @param topic_name Name of the topic of the reader. Only local writers on this topic are checked.
      * @return True if correct.
      */
     bool unpairReaderProxy(
             const GUID_t& participant_guid,
-            const GUID_t& reader_guid);
+            const GUID_t& reader_guid,
+            const std::string& topic_name);
 
     /**
      * Try to pair/unpair ReaderProxyData.
@@ -391,6 +403,27 @@ private:
             const WriterProxyData* wdata,
             const ReaderProxyData* rdata) const;
 
+    /**
+     * Check whether any partition name of a writer matches any partition name of a reader.
+     * Each distinct set of partition names is compiled once into a PartitionMatcher, and the result of matching two
+     * sets is kept in a cache, as the same sets are checked every time an endpoint on them is discovered or updated.
+     * @param writer_partitions Partitions of the writer.
+     * @param reader_partitions Partitions of the reader.
+     * @return True if the partition sets match.
+     */
+    bool partitions_match(
+            const fastdds::dds::PartitionQosPolicy& writer_partitions,
+            const fastdds::dds::PartitionQosPolicy& reader_partitions);
+
+    /**
+     * Get the compiled matcher of a set of partition names, creating it if needed.
+     * Should be called with partition_matches_mutex_ locked. It never drops other matchers.
+     * @param partitions Set of partitions.
+     * @return The matcher of the set.
+     */
+    std::shared_ptr<const PartitionMatcher> partition_matcher(
+            const fastdds::dds::PartitionQosPolicy& partitions);
+
     ReaderProxyData temp_reader_proxy_data_;
     WriterProxyData temp_writer_proxy_data_;
 
@@ -402,6 +435,13 @@ private:
 
     foonathan::memory::map<GUID_t, fastdds::dds::SubscriptionMatchedStatus, pool_allocator_t> reader_status_;
     foonathan::memory::map<GUID_t, fastdds::dds::PublicationMatchedStatus, pool_allocator_t> writer_status_;
+
+    //! Compiled sets of partition names, by their PartitionMatcher::key.
+    std::unordered_map<std::string, std::shared_ptr<const PartitionMatcher>> partition_matchers_;
+    //! Results of matching a writer partition set (first) with a reader partition set (second).
+    std::map<std::pair<const PartitionMatcher*, const PartitionMatcher*>, bool> partition_matches_;
+    //! Protects partition_matchers_ and partition_matches_.
+    std::mutex partition_matches_mutex_;
 };
 
 } /* namespace rtps */
@@ -75,6 +75,9 @@ protected:
      * @remarks This should be always accessed with the pdp_reader lock taken
      */
     ParticipantProxyData temp_participant_data_;
+
+    //! Whether announcements identical to the last one received from a known participant are dropped unparsed.
+    bool skip_unchanged_announcements_;
 };
 
 
@@ -38,6 +38,7 @@ namespace rtps {
 
 class BuiltinProtocols;
 class LivelinessManager;
+struct LivelinessData;
 class ReaderHistory;
 class ReaderProxyData;
 class RTPSParticipantImpl;
@@ -144,6 +145,14 @@ public:
      */
     bool assert_liveliness_manual_by_participant();
 
+    /**
+     * @brief A method to assert liveliness of a given writer from its liveliness data
+     * @param writer The liveliness data of the writer, set on the writer when it was added
+     * @return True if liveliness was asserted
+     */
+    bool assert_liveliness(
+            LivelinessData* writer);
+
     /**
      * Get the livelines builtin writer
      * @return stateful writer
@@ -207,11 +207,11 @@ struct RTPS_DllAPI CacheChange_t
         // Note: Fragment numbers are 1-based but we keep them 0 based.
         frag_sns.base(first_missing_fragment_ + 1);
 
-        // Traverse list of missing fragments, adding them to frag_sns
+        // Traverse list of missing fragments, adding them to frag_sns.
+        // Stop on the first one that does not fit on the bitmap, as the rest will not fit either.
         uint32_t current_frag = first_missing_fragment_;
-        while (current_frag < fragment_count_)
+        while (current_frag < fragment_count_ && frag_sns.add(current_frag + 1))
         {
-            frag_sns.add(current_frag + 1);
             current_frag = get_next_missing_fragment(current_frag);
         }
     }
@@ -0,0 +1,82 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file NetworkBuffer.hpp
+ */
+
+#ifndef _FASTDDS_RTPS_COMMON_NETWORKBUFFER_HPP_
+#define _FASTDDS_RTPS_COMMON_NETWORKBUFFER_HPP_
+
+#include <fastdds/rtps/common/Types.h>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * A slice of an outgoing message.
+ * A message can be given to the transports as a list of slices (i.e. a scatter / gather list), so parts of it,
+ * like serialized payloads, don't need to be copied into a contiguous buffer before being sent.
+ * The slice doesn't own the memory it points to.
+ * @ingroup COMMON_MODULE
+ */
+struct NetworkBuffer
+{
+    //! Pointer to the first byte of the slice
+    const octet* buffer = nullptr;
+
+    //! Number of bytes of the slice
+    uint32_t size = 0;
+
+    NetworkBuffer() = default;
+
+    NetworkBuffer(
+            const octet* buf,
+            uint32_t len)
+        : buffer(buf)
+        , size(len)
+    {
+    }
+
+};
+
+/**
+ * Copy a list of slices into a contiguous buffer.
+ * @param buffers List of slices to copy.
+ * @param destination Buffer where the slices will be copied. It should have room for all of them.
+ * @return Number of bytes copied.
+ */
+inline uint32_t copy_network_buffers(
+        const std::vector<NetworkBuffer>& buffers,
+        octet* destination)
+{
+    uint32_t copied = 0;
+    for (const NetworkBuffer& buffer : buffers)
+    {
+        memcpy(destination + copied, buffer.buffer, buffer.size);
+        copied += buffer.size;
+    }
+    return copied;
+}
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif /* _FASTDDS_RTPS_COMMON_NETWORKBUFFER_HPP_ */
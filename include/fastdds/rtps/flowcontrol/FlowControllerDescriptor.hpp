@@ -50,6 +50,38 @@ struct FlowControllerDescriptor
     //! Period of time on which the flow controller is allowed to send max_bytes_per_period.
     //! Default value: 100ms.
     uint64_t period_ms = 100;
+
+    //! Maximum number of bytes that can be sent at once.
+    //!
+    //! When different from 0, max_bytes_per_period / period_ms is applied as a continuous rate using a token bucket
+    //! with this capacity, instead of allowing max_bytes_per_period at the beginning of each period.
+    //! Range of bytes: [1, 2147483647];
+    //! 0 value means no token bucket.
+    //! Default value: 0
+    int32_t burst_bytes = 0;
+
+    //! Maximum number of bytes to be sent to each destination locator per period.
+    //!
+    //! Only applies when burst_bytes is different from 0.
+    //! Messages exceeding the limit of a locator are not sent to it, without affecting the rest of destinations.
+    //! Reliable writers will send them again when the reader asks for them.
+    //! Range of bytes: [1, 2147483647];
+    //! 0 value means no limit per locator.
+    //! Default value: 0
+    int32_t max_bytes_per_period_per_locator = 0;
+
+    //! Maximum number of bytes that can be sent at once to each destination locator.
+    //!
+    //! 0 value means max_bytes_per_period_per_locator.
+    //! Default value: 0
+    int32_t burst_bytes_per_locator = 0;
+
+    //! Number of threads sending the samples of the flow controller.
+    //!
+    //! Each writer is assigned to one of the threads, so the samples of a writer are always sent in order.
+    //! Only applies when max_bytes_per_period is 0.
+    //! Default value: 1
+    uint32_t sender_threads = 1;
 };
 
 } // namespace rtps
@@ -37,7 +37,10 @@ enum class FlowControllerSchedulerPolicy : int32_t
     HIGH_PRIORITY,
     //! Priority with reservation scheduler policy: guarantee each DataWriter's minimum reservation of throughput.
     //! Samples not fitting the reservation are scheduled by priority.
-    PRIORITY_WITH_RESERVATION
+    PRIORITY_WITH_RESERVATION,
+    //! Earliest deadline first scheduler policy: samples closest to exceed the latency budget of their DataWriter are
+    //! scheduled first.
+    EARLIEST_DEADLINE_FIRST
 };
 
 } // namespace rtps
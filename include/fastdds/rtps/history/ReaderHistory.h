@@ -23,6 +23,9 @@
 #include <fastdds/rtps/history/History.h>
 #include <fastdds/rtps/common/CacheChange.h>
 
+#include <map>
+#include <utility>
+
 namespace eprosima {
 namespace fastrtps {
 namespace rtps {
@@ -92,9 +95,40 @@ public:
             const CacheChange_t* inner,
             CacheChange_t* outer) override;
 
+    /**
+     * Find a specific change in the history using the matches_change method criteria.
+     * Changes are looked up on an index by writer GUID and sequence number.
+     * Hides the linear search of History::find_change_nts.
+     * No Thread Safe
+     * @param ch Pointer to the CacheChange_t to search for.
+     * @return an iterator if a suitable change is found
+     */
+    RTPS_DllAPI const_iterator find_change_nts(
+            CacheChange_t* ch);
+
+    /**
+     * Find a specific change in the history using the matches_change method criteria.
+     * @param ch Pointer to the CacheChange_t to search for.
+     * @return an iterator if a suitable change is found
+     */
+    RTPS_DllAPI const_iterator find_change(
+            CacheChange_t* ch)
+    {
+        std::lock_guard<RecursiveTimedMutex> guard(*mp_mutex);
+        return find_change_nts(ch);
+    }
+
     //! Introduce base class method into scope
     using History::remove_change;
 
+    /**
+     * Remove a specific change from the history.
+     * @param ch Pointer to the CacheChange_t.
+     * @return True if removed.
+     */
+    RTPS_DllAPI bool remove_change(
+            CacheChange_t* ch);
+
     /**
      * Remove all changes from the History that have a certain guid.
      * @param a_guid Pointer to the target guid to search for.
@@ -132,6 +166,18 @@ protected:
     //!Pointer to the reader
     RTPSReader* mp_reader;
 
+private:
+
+    /**
+     * Removes a change from the index, unless another change with its writer GUID and sequence number is indexed.
+     * @param change Change being removed from the history.
+     */
+    void remove_from_index(
+            const CacheChange_t* change);
+
+    //! Changes on the history indexed by writer GUID and sequence number
+    std::map<std::pair<GUID_t, SequenceNumber_t>, CacheChange_t*> changes_index_;
+
 };
 
 }  // namespace rtps
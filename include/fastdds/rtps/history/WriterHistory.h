@@ -92,6 +92,17 @@ public:
             const CacheChange_t* inner,
             CacheChange_t* outer) override;
 
+    /**
+     * Find a specific change in the history using the matches_change method criteria.
+     * Changes are kept ordered by sequence number, so a binary search is used.
+     * Hides the linear search of History::find_change_nts.
+     * No Thread Safe
+     * @param ch Pointer to the CacheChange_t to search for.
+     * @return an iterator if a suitable change is found
+     */
+    RTPS_DllAPI const_iterator find_change_nts(
+            CacheChange_t* ch);
+
     //! Introduce base class method into scope
     using History::remove_change;
 
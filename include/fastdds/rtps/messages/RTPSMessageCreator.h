@@ -126,6 +126,11 @@ public:
             bool expectsInlineQos,
             InlineQosWriter* inlineQos);
 
+    /**
+     * Add a DATA submessage to a message.
+     * @param payload_position When not null, the serialized payload is not copied into the message. The position
+     * where it should be inserted is returned instead, so it can be sent from its own buffer.
+     */
     static bool addSubmessageData(
             CDRMessage_t* msg,
             const CacheChange_t* change,
@@ -133,7 +138,8 @@ public:
             const EntityId_t& readerId,
             bool expectsInlineQos,
             InlineQosWriter* inlineQos,
-            bool* is_big_submessage);
+            bool* is_big_submessage,
+            uint32_t* payload_position = nullptr);
 
     static bool addMessageDataFrag(
             CDRMessage_t* msg,
@@ -144,6 +150,12 @@ public:
             const EntityId_t& readerId,
             bool expectsInlineQos,
             InlineQosWriter* inlineQos);
+
+    /**
+     * Add a DATA_FRAG submessage to a message.
+     * @param payload_position When not null, the fragment is not copied into the message. The position
+     * where it should be inserted is returned instead, so it can be sent from its own buffer.
+     */
     static bool addSubmessageDataFrag(
             CDRMessage_t* msg,
             const CacheChange_t* change,
@@ -152,7 +164,8 @@ public:
             TopicKind_t topicKind,
             const EntityId_t& readerId,
             bool expectsInlineQos,
-            InlineQosWriter* inlineQos);
+            InlineQosWriter* inlineQos,
+            uint32_t* payload_position = nullptr);
 
     static bool addMessageGap(
             CDRMessage_t* msg,
@@ -29,6 +29,7 @@
 #include <chrono>
 #include <cassert>
 #include <memory>
+#include <utility>
 
 
 namespace eprosima {
@@ -249,7 +250,20 @@ public:
 
     inline uint32_t get_current_bytes_processed() const
     {
-        return current_sent_bytes_ + full_msg_->length;
+        return current_sent_bytes_ + full_msg_->length + referenced_payloads_size_;
+    }
+
+    /**
+     * Sends the message being built if it references the payload of any change.
+     * Should be called before releasing the mutex of the endpoint when this object outlives it,
+     * as the referenced changes could be removed afterwards.
+     */
+    void flush_referenced_payloads()
+    {
+        if (!referenced_payloads_.empty())
+        {
+            flush_and_reset();
+        }
     }
 
 private:
@@ -257,6 +271,9 @@ private:
     static constexpr uint32_t data_frag_header_size_ = 28;
     static constexpr uint32_t max_inline_qos_size_ = 32;
 
+    //! Payloads of at least this size are sent from the buffer of the change instead of being copied
+    static constexpr uint32_t min_referenced_payload_size_ = 4096;
+
     void reset_to_header();
 
     void flush();
@@ -281,6 +298,40 @@ private:
             const GuidPrefix_t& destination_guid_prefix,
             bool is_big_submessage);
 
+    /**
+     * Appends the pending submessages and a DATA (when fragment_number is 0) or DATA_FRAG submessage directly
+     * to the message being built, avoiding the intermediate copy of the payload into the submessage buffer.
+     * When reference_payload is true the payload is not copied at all, and it will be sent from its own buffer.
+     * Only valid when the submessage needs no security transformation.
+     */
+    bool insert_data_submessage(
+            const CacheChange_t& change,
+            uint32_t fragment_number,
+            const SerializedPayload_t& payload,
+            const EntityId_t& reader_id,
+            bool expects_inline_qos,
+            InlineQosWriter* inline_qos,
+            bool reference_payload);
+
+    bool serialize_data_submessage(
+            const CacheChange_t& change,
+            uint32_t fragment_number,
+            const SerializedPayload_t& payload,
+            const EntityId_t& reader_id,
+            bool expects_inline_qos,
+            InlineQosWriter* inline_qos,
+            bool reference_payload,
+            bool* is_big_submessage);
+
+    /**
+     * Checks whether a payload can be sent from its own buffer instead of being copied into the message.
+     */
+    bool can_reference_payload(
+            uint32_t payload_size) const;
+
+    //! Undoes the room reserved on the message for the referenced payloads and forgets them.
+    void release_referenced_payloads();
+
     bool add_info_dst_in_buffer(
             CDRMessage_t* buffer,
             const GuidPrefix_t& destination_guid_prefix);
@@ -322,6 +373,15 @@ private:
     uint32_t sent_bytes_limitation_ = 0;
 
     uint32_t current_sent_bytes_ = 0;
+
+    //! Payloads referenced by the message being built, with the position of the message where they go
+    std::vector<std::pair<uint32_t, NetworkBuffer>> referenced_payloads_;
+
+    //! Sum of the sizes of the payloads referenced by the message being built
+    uint32_t referenced_payloads_size_ = 0;
+
+    //! Slices of the message handed to the sender when it references payloads
+    std::vector<NetworkBuffer> buffers_to_send_;
 };
 
 }        /* namespace rtps */
@@ -24,7 +24,9 @@
 
 #include <fastdds/rtps/messages/CDRMessage.h>
 #include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/common/NetworkBuffer.hpp>
 
+#include <chrono>
 #include <vector>
 
 namespace eprosima {
@@ -80,6 +82,24 @@ public:
     virtual bool send(
             CDRMessage_t* message,
             std::chrono::steady_clock::time_point max_blocking_time_point) const = 0;
+
+    /**
+     * Send a message made of several slices through this interface.
+     * The default implementation copies the slices into a contiguous buffer.
+     *
+     * @param buffers List of slices composing the message.
+     * @param total_bytes Sum of the sizes of all the slices.
+     * @param max_blocking_time_point Future timepoint where blocking send should end.
+     */
+    virtual bool send(
+            const std::vector<NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            std::chrono::steady_clock::time_point max_blocking_time_point) const
+    {
+        CDRMessage_t message(total_bytes);
+        message.length = copy_network_buffers(buffers, message.buffer);
+        return send(&message, max_blocking_time_point);
+    }
 };
 
 } /* namespace rtps */
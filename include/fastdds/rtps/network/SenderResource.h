@@ -20,6 +20,7 @@
 #include <chrono>
 
 #include <fastdds/rtps/common/Locator.h>
+#include <fastdds/rtps/common/NetworkBuffer.hpp>
 
 namespace eprosima {
 namespace fastrtps {
@@ -67,6 +68,36 @@ public:
         return returned_value;
     }
 
+    /**
+     * Sends a message made of several slices to a destination locator, through the channel managed by this
+     * resource.
+     * When the transport doesn't support gather sends, the slices are copied into a contiguous buffer.
+     * @param buffers List of slices composing the message. They are sent in order.
+     * @param total_bytes Sum of the sizes of all the slices.
+     * @param destination_locators_begin destination endpoint Locators iterator begin.
+     * @param destination_locators_end destination endpoint Locators iterator end.
+     * @param max_blocking_time_point If transport supports it then it will use it as maximum blocking time.
+     * @return Success of the send operation.
+     */
+    bool send(
+            const std::vector<NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            LocatorsIterator* destination_locators_begin,
+            LocatorsIterator* destination_locators_end,
+            const std::chrono::steady_clock::time_point& max_blocking_time_point)
+    {
+        if (send_buffers_lambda_)
+        {
+            return send_buffers_lambda_(buffers, total_bytes, destination_locators_begin, destination_locators_end,
+                           max_blocking_time_point);
+        }
+
+        std::vector<octet> data(total_bytes);
+        copy_network_buffers(buffers, data.data());
+        return send(data.data(), total_bytes, destination_locators_begin, destination_locators_end,
+                       max_blocking_time_point);
+    }
+
     /**
      * Resources can only be transfered through move semantics. Copy, assignment, and
      * construction outside of the factory are forbidden.
@@ -76,6 +107,7 @@ public:
     {
         clean_up.swap(rValueResource.clean_up);
         send_lambda_.swap(rValueResource.send_lambda_);
+        send_buffers_lambda_.swap(rValueResource.send_buffers_lambda_);
     }
 
     virtual ~SenderResource() = default;
@@ -113,6 +145,12 @@ protected:
                 LocatorsIterator* destination_locators_begin,
                 LocatorsIterator* destination_locators_end,
                 const std::chrono::steady_clock::time_point&)> send_lambda_;
+    std::function<bool(
+                const std::vector<NetworkBuffer>&,
+                uint32_t,
+                LocatorsIterator* destination_locators_begin,
+                LocatorsIterator* destination_locators_end,
+                const std::chrono::steady_clock::time_point&)> send_buffers_lambda_;
 
 private:
 
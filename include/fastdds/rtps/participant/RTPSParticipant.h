@@ -24,6 +24,7 @@
 #include <fastrtps/fastrtps_dll.h>
 #include <fastdds/rtps/common/Guid.h>
 #include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
+#include <fastdds/rtps/participant/SendBuffersStatistics.hpp>
 #include <fastrtps/qos/ReaderQos.h>
 #include <fastrtps/qos/WriterQos.h>
 #include <fastdds/statistics/IListeners.hpp>
@@ -204,6 +205,13 @@ public:
 
     ResourceEvent& get_resource_event() const;
 
+    /**
+     * Retrieves the usage statistics of the pool of send buffers.
+     * They can be used to detect an undersized pool (see SendBuffersAllocationAttributes).
+     * @return Statistics of the pool of send buffers.
+     */
+    SendBuffersStatistics get_send_buffers_statistics() const;
+
     /**
      * @brief A method to retrieve the built-in writer liveliness protocol
      * @return Writer liveliness protocol
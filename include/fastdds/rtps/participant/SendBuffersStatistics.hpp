@@ -0,0 +1,52 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SendBuffersStatistics.hpp
+ */
+
+#ifndef _FASTDDS_RTPS_PARTICIPANT_SENDBUFFERSSTATISTICS_HPP_
+#define _FASTDDS_RTPS_PARTICIPANT_SENDBUFFERSSTATISTICS_HPP_
+
+#include <chrono>
+#include <cstdint>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Statistics on the usage of the pool of send buffers of a participant.
+ * @ingroup RTPS_MODULE
+ */
+struct SendBuffersStatistics
+{
+    //! Number of send buffers created by the pool, including the ones reserved on initialization
+    uint32_t created_buffers = 0;
+
+    //! Number of times a buffer was requested while the pool had none available
+    uint64_t exhausted_count = 0;
+
+    //! Number of times a thread had to wait for a buffer to be returned to the pool
+    uint64_t wait_count = 0;
+
+    //! Accumulated time spent by threads waiting for a buffer to be returned to the pool
+    std::chrono::nanoseconds total_wait_time{0};
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // _FASTDDS_RTPS_PARTICIPANT_SENDBUFFERSSTATISTICS_HPP_
@@ -0,0 +1,58 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file FragmentReassemblyStatistics.hpp
+ */
+
+#ifndef _FASTDDS_RTPS_READER_FRAGMENTREASSEMBLYSTATISTICS_HPP_
+#define _FASTDDS_RTPS_READER_FRAGMENTREASSEMBLYSTATISTICS_HPP_
+
+#include <chrono>
+#include <cstdint>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Statistics on the reassembly of samples received as DATA_FRAG submessages on a reader.
+ * @ingroup READER_MODULE
+ */
+struct FragmentReassemblyStatistics
+{
+    //! Number of samples currently being reassembled
+    uint32_t pending_samples = 0;
+
+    //! Payload memory held by the samples currently being reassembled
+    uint64_t pending_bytes = 0;
+
+    //! Number of samples completely reassembled
+    uint64_t completed_samples = 0;
+
+    //! Number of partially received samples discarded for being stale or to keep the configured limits
+    uint64_t evicted_samples = 0;
+
+    //! Accumulated time between the first and last fragment of the completed samples
+    std::chrono::nanoseconds total_reassembly_time{0};
+
+    //! Maximum time between the first and last fragment of a completed sample
+    std::chrono::nanoseconds max_reassembly_time{0};
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // _FASTDDS_RTPS_READER_FRAGMENTREASSEMBLYSTATISTICS_HPP_
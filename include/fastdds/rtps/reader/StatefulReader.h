@@ -22,10 +22,12 @@
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
 #include <fastdds/rtps/reader/RTPSReader.h>
+#include <fastdds/rtps/reader/FragmentReassemblyStatistics.hpp>
 #include <fastrtps/utils/collections/ResourceLimitedVector.hpp>
 #include <fastdds/rtps/common/CDRMessage_t.h>
 #include <fastdds/rtps/messages/RTPSMessageGroup.h>
 
+#include <memory>
 #include <mutex>
 
 namespace eprosima {
@@ -34,6 +36,7 @@ namespace rtps {
 
 class WriterProxy;
 class RTPSMessageSenderInterface;
+class FragmentedChangeTracker;
 
 /**
  * Class StatefulReader, specialization of RTPSReader than stores the state of the matched writers.
@@ -316,12 +319,27 @@ public:
             const WriterProxy* writer,
             bool mark_as_read = true) override;
 
+    /**
+     * Get the statistics on the reassembly of fragmented samples.
+     * @return A copy of the current statistics.
+     */
+    FragmentReassemblyStatistics get_fragment_reassembly_statistics() const;
+
 private:
 
     void init(
             RTPSParticipantImpl* pimpl,
             const ReaderAttributes& att);
 
+    /*!
+     * Discard the partially received changes that are stale or that would exceed the reassembly limits
+     * when a new change of the given size starts being reassembled.
+     * @param incoming_size Payload size of the new change. 0 to only discard stale changes.
+     * @remarks Non thread-safe.
+     */
+    void evict_fragmented_changes_nts(
+            uint32_t incoming_size);
+
     bool acceptMsgFrom(
             const GUID_t& entityGUID,
             WriterProxy** wp) const;
@@ -356,6 +374,8 @@ private:
     bool disable_positive_acks_;
     //! False when being destroyed
     bool is_alive_;
+    //! Changes being reassembled from DATA_FRAG submessages
+    std::unique_ptr<FragmentedChangeTracker> fragmented_changes_;
 };
 
 } /* namespace rtps */
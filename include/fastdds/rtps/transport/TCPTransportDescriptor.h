@@ -255,6 +255,24 @@ struct TCPTransportDescriptor : public SocketTransportDescriptor
     bool calculate_crc;
     //! Enables checking the CRC of incoming message headers
     bool check_crc;
+
+    /**
+     * Number of threads multiplexing the reception on all the TCP channels.
+     * When zero, a dedicated reception thread is created for each channel.
+     * TLS channels always use a dedicated reception thread.
+     */
+    uint32_t reactor_threads;
+
+    /**
+     * Enables coalescing the messages sent through a channel.
+     * Messages sent while another write is in progress on the same channel are queued and written
+     * together by the thread performing that write, with a single system call.
+     */
+    bool enable_write_coalescing;
+    //! Maximum time (us) the first queued message waits for others to be coalesced with it
+    uint32_t write_coalescing_max_latency_us;
+    //! Enables the TCP_CORK socket option while writing coalesced messages (only on Linux)
+    bool enable_tcp_cork;
     //! Enables the use of TLS (Transport Layer Security)
     bool apply_security;
 
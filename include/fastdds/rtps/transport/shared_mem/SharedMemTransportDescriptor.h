@@ -35,6 +35,16 @@ class TransportInterface;
  *
  * - rtps_dump_file_: full path of the protocol dump file.
  *
+ * - listener_busy_poll_us_: time the listening threads spin on an empty port before blocking (us).
+ *
+ * - listener_busy_poll_only_: if true, listening threads spin on the port and never block.
+ *
+ * - huge_pages_: if true, the shared memory segment is sized to whole huge pages and backed by them when the
+ *   system supports it.
+ *
+ * - lazy_segment_: if true, the shared memory segment is not zeroed when the transport is initialized, so its pages
+ *   are only mapped when messages are written on them. The segment is still created on initialization.
+ *
  * @ingroup TRANSPORT_MODULE
  */
 struct SharedMemTransportDescriptor : public TransportDescriptorInterface
@@ -126,6 +136,58 @@ struct SharedMemTransportDescriptor : public TransportDescriptorInterface
         rtps_dump_file_ = rtps_dump_file;
     }
 
+    //! Return the time the listening threads spin on an empty port before blocking (us)
+    RTPS_DllAPI uint32_t listener_busy_poll_us() const
+    {
+        return listener_busy_poll_us_;
+    }
+
+    //! Set the time the listening threads spin on an empty port before blocking (us)
+    RTPS_DllAPI void listener_busy_poll_us(
+            uint32_t listener_busy_poll_us)
+    {
+        listener_busy_poll_us_ = listener_busy_poll_us;
+    }
+
+    //! Return whether the listening threads spin on the port without ever blocking
+    RTPS_DllAPI bool listener_busy_poll_only() const
+    {
+        return listener_busy_poll_only_;
+    }
+
+    //! Set whether the listening threads spin on the port without ever blocking
+    RTPS_DllAPI void listener_busy_poll_only(
+            bool listener_busy_poll_only)
+    {
+        listener_busy_poll_only_ = listener_busy_poll_only;
+    }
+
+    //! Return whether the shared memory segment is backed by huge pages
+    RTPS_DllAPI bool huge_pages() const
+    {
+        return huge_pages_;
+    }
+
+    //! Set whether the shared memory segment is backed by huge pages
+    RTPS_DllAPI void huge_pages(
+            bool huge_pages)
+    {
+        huge_pages_ = huge_pages;
+    }
+
+    //! Return whether the pages of the shared memory segment are mapped on the first writes
+    RTPS_DllAPI bool lazy_segment() const
+    {
+        return lazy_segment_;
+    }
+
+    //! Set whether the pages of the shared memory segment are mapped on the first writes
+    RTPS_DllAPI void lazy_segment(
+            bool lazy_segment)
+    {
+        lazy_segment_ = lazy_segment;
+    }
+
     //! Comparison operator
     RTPS_DllAPI bool operator ==(
             const SharedMemTransportDescriptor& t) const;
@@ -136,6 +198,10 @@ private:
     uint32_t port_queue_capacity_;
     uint32_t healthy_check_timeout_ms_;
     std::string rtps_dump_file_;
+    uint32_t listener_busy_poll_us_;
+    bool listener_busy_poll_only_;
+    bool huge_pages_;
+    bool lazy_segment_;
 
 };
 
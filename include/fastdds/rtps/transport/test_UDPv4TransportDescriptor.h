@@ -18,6 +18,7 @@
 #include <functional>
 
 #include <fastdds/rtps/transport/SocketTransportDescriptor.h>
+#include <fastdds/rtps/common/Locator.h>
 #include <fastdds/rtps/common/SequenceNumber.h>
 #include <fastdds/rtps/messages/CDRMessage.h>
 
@@ -34,6 +35,8 @@ struct test_UDPv4TransportDescriptor : public SocketTransportDescriptor
 
     typedef std::function<bool (fastrtps::rtps::CDRMessage_t& msg)> filter;
 
+    typedef std::function<bool (const fastrtps::rtps::Locator_t& destination, uint32_t size)> destination_filter;
+
     // Test shim parameters
     uint8_t dropDataMessagesPercentage;
     filter drop_data_messages_filter_;
@@ -53,6 +56,9 @@ struct test_UDPv4TransportDescriptor : public SocketTransportDescriptor
     uint8_t percentageOfMessagesToDrop;
     filter messages_filter_;
 
+    //! Drops the messages sent to a destination locator, i.e. to emulate a slow link to a peer
+    destination_filter destination_messages_filter_;
+
     std::vector<fastrtps::rtps::SequenceNumber_t> sequenceNumberDataMessagesToDrop;
 
     //! Log dropped packets
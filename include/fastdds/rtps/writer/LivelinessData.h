@@ -21,7 +21,9 @@
 #include <fastrtps/qos/QosPolicies.h>
 #include <fastdds/rtps/common/Time_t.h>
 
+#include <atomic>
 #include <chrono>
+#include <cstdint>
 
 namespace eprosima {
 namespace fastrtps {
@@ -57,6 +59,7 @@ struct LivelinessData
         , kind(kind_in)
         , lease_duration(lease_duration_in)
         , status(WriterStatus::NOT_ASSERTED)
+        , expiration_ns(0)
     {}
 
     LivelinessData()
@@ -64,8 +67,52 @@ struct LivelinessData
         , kind(LivelinessQosPolicyKind::AUTOMATIC_LIVELINESS_QOS)
         , lease_duration(TIME_T_INFINITE_SECONDS, TIME_T_INFINITE_NANOSECONDS)
         , status(WriterStatus::NOT_ASSERTED)
+        , expiration_ns(0)
     {}
 
+    /**
+     * @brief Copy constructor
+     * @details The copy takes the expiration time stored by the last assertion of liveliness
+     * @param other Liveliness data to copy
+     */
+    LivelinessData(
+            const LivelinessData& other)
+        : guid()
+        , kind(LivelinessQosPolicyKind::AUTOMATIC_LIVELINESS_QOS)
+        , lease_duration()
+        , status(WriterStatus::NOT_ASSERTED)
+        , expiration_ns(0)
+    {
+        *this = other;
+    }
+
+    /**
+     * @brief Copy assignment
+     * @details The copy takes the expiration time stored by the last assertion of liveliness
+     * @param other Liveliness data to copy
+     * @return Reference to this object
+     */
+    LivelinessData& operator =(
+            const LivelinessData& other)
+    {
+        guid = other.guid;
+        kind = other.kind;
+        lease_duration = other.lease_duration;
+        count = other.count;
+        status = other.status;
+        time = other.time;
+
+        int64_t expiration = other.expiration_ns.load();
+        expiration_ns.store(expiration);
+        if (0 != expiration)
+        {
+            time = std::chrono::steady_clock::time_point(
+                std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                    std::chrono::nanoseconds(expiration)));
+        }
+        return *this;
+    }
+
     ~LivelinessData()
     {}
 
@@ -108,8 +155,12 @@ struct LivelinessData
     //! The writer status
     WriterStatus status;
 
-    //! The time when the writer will lose liveliness
+    //! The time when the writer will lose liveliness, as last computed by the liveliness manager
     std::chrono::steady_clock::time_point time;
+
+    //! The time when the writer will lose liveliness, in nanoseconds since the epoch of the steady clock.
+    //! Zero when the writer is not alive. Alive writers extend it without locking when asserting liveliness.
+    std::atomic<int64_t> expiration_ns;
 };
 
 } /* namespace rtps */
@@ -22,7 +22,9 @@
 #include <fastrtps/utils/collections/ResourceLimitedVector.hpp>
 #include <fastdds/rtps/resources/TimedEvent.h>
 
+#include <list>
 #include <mutex>
+#include <unordered_map>
 
 namespace eprosima {
 namespace fastrtps {
@@ -102,6 +104,29 @@ public:
             LivelinessQosPolicyKind kind,
             Duration_t lease_duration);
 
+    /**
+     * @brief Returns the liveliness data of a writer in the set, to be used as a handle to assert its liveliness
+     * @details The liveliness data remains valid until the writer is removed from the set
+     * @param guid GUID of the writer
+     * @param kind Liveliness kind
+     * @param lease_duration Liveliness lease duration
+     * @return Pointer to the liveliness data of the writer, nullptr if the writer is not in the set
+     */
+    LivelinessData* get_writer(
+            const GUID_t& guid,
+            LivelinessQosPolicyKind kind,
+            const Duration_t& lease_duration);
+
+    /**
+     * @brief Asserts liveliness of a writer in the set from its liveliness data
+     * @details When the writer has manual by topic liveliness and is already alive, its expiration time is extended
+     * without taking the mutex of the manager nor restarting the timer, which recomputes expirations when it expires
+     * @param writer Liveliness data of the writer, as returned by get_writer()
+     * @return True if liveliness was successfully asserted
+     */
+    bool assert_liveliness(
+            LivelinessData* writer);
+
     /**
      * @brief Asserts liveliness of writers with given liveliness kind
      * @param kind Liveliness kind
@@ -117,18 +142,28 @@ public:
     bool is_any_alive(LivelinessQosPolicyKind kind);
 
     /**
-     * @brief A method to return liveliness data
+     * @brief A method to return a copy of the liveliness data
      * @details Should only be used for testing purposes
-     * @return Vector of liveliness data
+     * @return Vector of liveliness data, in the order the writers were added
      */
-    const ResourceLimitedVector<LivelinessData> &get_liveliness_data() const;
+    ResourceLimitedVector<LivelinessData> get_liveliness_data() const;
 
 private:
 
     //! @brief A method responsible for invoking the callback when liveliness is asserted
     //! @param writer The liveliness data of the writer asserting liveliness
-    //!
-    void assert_writer_liveliness(LivelinessData& writer);
+    //! @return True if the writer was not alive before the assertion
+    bool assert_writer_liveliness(LivelinessData& writer);
+
+    //! @brief Extends the expiration time of a writer if it is alive. It does not need the mutex to be taken
+    //! @param writer The liveliness data of the writer asserting liveliness
+    //! @return True if the writer was alive and its expiration time was extended
+    static bool extend_writer_liveliness(LivelinessData& writer);
+
+    //! @brief Restarts the timer so it expires when the timer owner loses its liveliness, or cancels it if no
+    //! writer is alive
+    //! @return True if at least one writer is alive
+    bool restart_timer();
 
     /**
      * @brief A method to calculate the time when the next writer is going to lose liveliness
@@ -141,13 +176,11 @@ private:
     //! @param guid The guid of the writer
     //! @param kind The liveliness kind
     //! @param lease_duration The lease duration
-    //! @param wit_out Returns an iterator to the writer liveliness data
-    //! @return Returns true if writer was found, false otherwise
-    bool find_writer(
+    //! @return Returns a pointer to the writer liveliness data if writer was found, nullptr otherwise
+    LivelinessData* find_writer(
             const GUID_t &guid,
             const LivelinessQosPolicyKind &kind,
-            const Duration_t &lease_duration,
-            ResourceLimitedVector<LivelinessData>::iterator* wit_out);
+            const Duration_t &lease_duration);
 
 
     //! @brief A method called if the timer expires
@@ -160,11 +193,30 @@ private:
     //! A boolean indicating whether we are managing writers with automatic liveliness
     bool manage_automatic_;
 
-    //! A vector of liveliness data
-    ResourceLimitedVector<LivelinessData> writers_;
+    //! Hash of a GUID, used to index the liveliness data
+    struct GuidHash
+    {
+        std::size_t operator ()(
+                const GUID_t& guid) const
+        {
+            std::size_t ret = std::hash<EntityId_t>()(guid.entityId);
+            for (octet byte : guid.guidPrefix.value)
+            {
+                ret = (ret * 31) ^ byte;
+            }
+            return ret;
+        }
+
+    };
+
+    //! A list of liveliness data. Elements keep their address, as writers hold pointers to them
+    std::list<LivelinessData> writers_;
+
+    //! Liveliness data indexed by writer GUID
+    std::unordered_multimap<GUID_t, LivelinessData*, GuidHash> writers_by_guid_;
 
     //! A mutex to protect the liveliness data
-    std::mutex mutex_;
+    mutable std::mutex mutex_;
 
     //! The timer owner, i.e. the writer which is next due to lose its liveliness
     LivelinessData* timer_owner_;
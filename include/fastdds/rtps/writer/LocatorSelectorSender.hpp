@@ -75,6 +75,18 @@ public:
             CDRMessage_t* message,
             std::chrono::steady_clock::time_point max_blocking_time_point) const override;
 
+    /*!
+     * Send a message made of several slices through this interface.
+     *
+     * @param buffers List of slices composing the message.
+     * @param total_bytes Sum of the sizes of all the slices.
+     * @param max_blocking_time_point Future timepoint where blocking send should end.
+     */
+    bool send(
+            const std::vector<NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            std::chrono::steady_clock::time_point max_blocking_time_point) const override;
+
     RTPSWriter& writer;
 
     fastrtps::rtps::LocatorSelector locator_selector;
@@ -41,6 +41,8 @@ namespace  fastdds {
 namespace rtps {
 
 class FlowController;
+class LocatorTrafficShaper;
+struct FlowControllerTokenBucketPublishMode;
 
 } // namespace rtps
 } // namespace fastdds
@@ -52,6 +54,7 @@ class WriterListener;
 class WriterHistory;
 class DataSharingNotifier;
 struct CacheChange_t;
+struct LivelinessData;
 
 /**
  * Class RTPSWriter, manages the sending of data to the readers. Is always associated with a HistoryCache.
@@ -64,6 +67,8 @@ class RTPSWriter
     friend class WriterHistory;
     friend class RTPSParticipantImpl;
     friend class RTPSMessageGroup;
+    friend class WLP;
+    friend struct fastdds::rtps::FlowControllerTokenBucketPublishMode;
 
 protected:
 
@@ -434,6 +439,21 @@ public:
             const LocatorSelectorSender& locator_selector,
             std::chrono::steady_clock::time_point& max_blocking_time_point) const;
 
+    /**
+     * Send a message made of several slices through this interface.
+     *
+     * @param buffers List of slices composing the message.
+     * @param total_bytes Sum of the sizes of all the slices.
+     * @param locator_selector RTPSMessageSenderInterface reference uses for selecting locators. The reference has to
+     * be a member of this RTPSWriter object.
+     * @param max_blocking_time_point Future timepoint where blocking send should end.
+     */
+    virtual bool send_nts(
+            const std::vector<NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            const LocatorSelectorSender& locator_selector,
+            std::chrono::steady_clock::time_point& max_blocking_time_point) const;
+
 protected:
 
     //!Is the data sent directly or announced by HB and THEN sent to the ones who ask for it?.
@@ -457,6 +477,8 @@ protected:
     Duration_t liveliness_lease_duration_;
     //! The liveliness announcement period
     Duration_t liveliness_announcement_period_;
+    //! The liveliness data of this writer in the liveliness manager of the participant
+    LivelinessData* liveliness_data_ = nullptr;
 
     void add_guid(
             LocatorSelectorSender& locator_selector,
@@ -553,6 +575,31 @@ private:
             const std::shared_ptr<IChangePool>& change_pool,
             const WriterAttributes& att);
 
+    /*!
+     * Set the shaper limiting the traffic sent through the async locator selector to each destination locator.
+     *
+     * @param traffic_shaper Shaper to use, or nullptr to stop shaping.
+     */
+    void traffic_shaper(
+            fastdds::rtps::LocatorTrafficShaper* traffic_shaper);
+
+    /*!
+     * Fill shaped_locators_ with the selected locators the traffic shaper accepts.
+     *
+     * @return false when the message should not be sent to any locator.
+     */
+    bool shape_locators(
+            const LocatorSelectorSender& locator_selector,
+            uint32_t bytes) const;
+
+    //! Optional shaper deciding which of the selected locators each asynchronous message is sent to.
+    fastdds::rtps::LocatorTrafficShaper* traffic_shaper_ = nullptr;
+
+    //! Locator selector whose messages are shaped by traffic_shaper_.
+    const LocatorSelectorSender* shaped_locator_selector_ = nullptr;
+
+    //! Locators accepted by traffic_shaper_ for the message being sent.
+    mutable LocatorList_t shaped_locators_;
 
     RTPSWriter* next_[2] = { nullptr, nullptr };
 };
@@ -455,7 +455,8 @@ private:
             const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time);
 
     void prepare_datasharing_delivery(
-            CacheChange_t* change);
+            CacheChange_t* change,
+            uint64_t filtered_readers);
 
     //! True to disable piggyback heartbeats
     bool disable_heartbeat_piggyback_;
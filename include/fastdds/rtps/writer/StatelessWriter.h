@@ -162,6 +162,21 @@ public:
             const LocatorSelectorSender& locator_selector,
             std::chrono::steady_clock::time_point& max_blocking_time_point) const override;
 
+    /**
+     * Send a message made of several slices through this interface.
+     *
+     * @param buffers List of slices composing the message.
+     * @param total_bytes Sum of the sizes of all the slices.
+     * @param locator_selector RTPSMessageSenderInterface reference uses for selecting locators. The reference has to
+     * be a member of this RTPSWriter object.
+     * @param max_blocking_time_point Future timepoint where blocking send should end.
+     */
+    bool send_nts(
+            const std::vector<NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            const LocatorSelectorSender& locator_selector,
+            std::chrono::steady_clock::time_point& max_blocking_time_point) const override;
+
     /**
      * Get the number of matched readers
      * @return Number of the matched readers
@@ -21,11 +21,19 @@
 #define KEYEDCHANGES_H_
 
 #include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/common/InstanceHandle.h>
 #include <chrono>
+#include <map>
 
 namespace eprosima{
 namespace fastrtps{
 
+/**
+ * @brief Instances of a history ordered by the time when they will miss the deadline
+ * @ingroup FASTRTPS_MODULE
+ */
+using KeyedDeadlines = std::multimap<std::chrono::steady_clock::time_point, rtps::InstanceHandle_t>;
+
 /**
  * @brief A struct storing a vector of cache changes and the next deadline in the group
  * @ingroup FASTRTPS_MODULE
@@ -36,6 +44,7 @@ struct KeyedChanges
     KeyedChanges()
         : cache_changes()
         , next_deadline_us()
+        , deadline_position()
     {
     }
 
@@ -43,6 +52,7 @@ struct KeyedChanges
     KeyedChanges(const KeyedChanges& other)
         : cache_changes(other.cache_changes)
         , next_deadline_us(other.next_deadline_us)
+        , deadline_position(other.deadline_position)
     {
     }
 
@@ -55,6 +65,8 @@ struct KeyedChanges
     std::vector<rtps::CacheChange_t*> cache_changes;
     //! The time when the group will miss the deadline
     std::chrono::steady_clock::time_point next_deadline_us;
+    //! Position of the group in the deadlines of its history
+    KeyedDeadlines::iterator deadline_position;
 };
 
 } /* namespace  */
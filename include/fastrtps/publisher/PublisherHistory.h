@@ -147,6 +147,8 @@ private:
 
     //!Map where keys are instance handles and values are vectors of cache changes associated
     t_m_Inst_Caches keyed_changes_;
+    //!Instances ordered by their next deadline (only used for topics with key)
+    KeyedDeadlines keyed_deadlines_;
     //!Time point when the next deadline will occur (only used for topics with no key)
     std::chrono::steady_clock::time_point next_deadline_us_;
     //!HistoryQosPolicy values.
@@ -19,7 +19,12 @@
 #include <fastrtps/types/DynamicTypeBuilder.h>
 #include <fastrtps/types/DynamicTypeBuilderPtr.h>
 #include <fastrtps/types/DynamicTypePtr.h>
+
+#include <array>
+#include <cstring>
 #include <mutex>
+#include <set>
+#include <unordered_map>
 
 namespace eprosima {
 namespace fastrtps {
@@ -32,6 +37,73 @@ private:
     mutable std::recursive_mutex m_MutexObjects;
     mutable std::recursive_mutex m_MutexInformations;
 
+    //! Kind (EK_MINIMAL or EK_COMPLETE) followed by the equivalence hash of a hashed TypeIdentifier.
+    using HashedIdentifierKey = std::array<octet, 15>;
+
+    struct HashedIdentifierKeyHasher
+    {
+        size_t operator ()(
+                const HashedIdentifierKey& key) const
+        {
+            // The equivalence hash is already uniformly distributed.
+            size_t value = 0;
+            memcpy(&value, key.data() + 1, sizeof(value) < key.size() - 1 ? sizeof(value) : key.size() - 1);
+            return value;
+        }
+
+    };
+
+    //! Stored hashed TypeIdentifier, with the names it is registered with and its TypeObject.
+    struct HashedIdentifierEntry
+    {
+        const TypeIdentifier* identifier = nullptr;
+        std::set<std::string> names;
+        const TypeObject* object = nullptr;
+    };
+
+    //! Part of the index of hashed TypeIdentifiers, with its own mutex so lookups on different shards do not contend.
+    struct HashedIdentifierShard
+    {
+        std::mutex mutex;
+        std::unordered_map<HashedIdentifierKey, HashedIdentifierEntry, HashedIdentifierKeyHasher> entries;
+    };
+
+    static constexpr size_t hashed_identifier_shards = 16;
+
+    //! Index of the stored EK_MINIMAL and EK_COMPLETE TypeIdentifiers by their equivalence hash.
+    mutable std::array<HashedIdentifierShard, hashed_identifier_shards> hashed_identifiers_;
+
+    static bool get_hashed_identifier_key(
+            const TypeIdentifier* identifier,
+            HashedIdentifierKey& key);
+
+    HashedIdentifierShard& get_hashed_identifier_shard(
+            const HashedIdentifierKey& key) const;
+
+    void index_hashed_identifier(
+            const std::string& type_name,
+            const TypeIdentifier* identifier);
+
+    void unindex_hashed_identifier(
+            const std::string& type_name,
+            const TypeIdentifier* identifier);
+
+    void index_hashed_object(
+            const TypeIdentifier* identifier,
+            const TypeObject* object);
+
+    /**
+     * Looks for a stored hashed TypeIdentifier equal to the given one.
+     * @param identifier TypeIdentifier to look for. Must be EK_MINIMAL or EK_COMPLETE.
+     * @param name If not nullptr, filled with the name the identifier is registered with.
+     * @param object If not nullptr, filled with the TypeObject of the identifier.
+     * @return The stored TypeIdentifier, or nullptr if it is not stored.
+     */
+    const TypeIdentifier* find_hashed_identifier(
+            const TypeIdentifier* identifier,
+            std::string* name,
+            const TypeObject** object) const;
+
 protected:
     TypeObjectFactory();
     mutable std::map<const std::string, const TypeIdentifier*> identifiers_; // Basic, builtin and EK_MINIMAL
@@ -79,6 +79,13 @@ public:
     IPFinder();
     virtual ~IPFinder();
 
+    /**
+     * Get the IP addresses of all the running interfaces.
+     * The interfaces are enumerated once and cached for the whole process. The cache is refreshed when the system
+     * notifies a change on the interfaces or, where notifications are not available, when it gets too old.
+     * @param[out] vec_name List where the addresses are appended.
+     * @param return_loopback Whether to include the loopback addresses.
+     */
     RTPS_DllAPI static bool getIPs(
             std::vector<info_IP>* vec_name,
             bool return_loopback = false);
@@ -126,6 +133,19 @@ public:
      */
     RTPS_DllAPI static bool getAllMACAddress(
             std::vector<info_MAC>* macs);
+
+private:
+
+    friend class IPFinderTests;
+
+    /**
+     * Enumerates the interfaces of the system, bypassing the cache.
+     * @param[out] vec_name List where the addresses are appended.
+     * @param return_loopback Whether to include the loopback addresses.
+     */
+    static bool getIPsFromSystem(
+            std::vector<info_IP>* vec_name,
+            bool return_loopback);
 };
 
 } // namespace rtps
@@ -73,6 +73,10 @@ extern const char* METADATA_LOGICAL_PORT;
 extern const char* LISTENING_PORTS;
 extern const char* CALCULATE_CRC;
 extern const char* CHECK_CRC;
+extern const char* REACTOR_THREADS;
+extern const char* ENABLE_WRITE_COALESCING;
+extern const char* WRITE_COALESCING_MAX_LATENCY_US;
+extern const char* ENABLE_TCP_CORK;
 extern const char* SEGMENT_SIZE;
 extern const char* PORT_QUEUE_CAPACITY;
 extern const char* PORT_OVERFLOW_POLICY;
@@ -81,6 +85,10 @@ extern const char* HEALTHY_CHECK_TIMEOUT_MS;
 extern const char* DISCARD;
 extern const char* FAIL;
 extern const char* RTPS_DUMP_FILE;
+extern const char* LISTENER_BUSY_POLL_US;
+extern const char* LISTENER_BUSY_POLL_ONLY;
+extern const char* HUGE_PAGES;
+extern const char* LAZY_SEGMENT;
 extern const char* ON;
 
 // IntraprocessDeliveryType
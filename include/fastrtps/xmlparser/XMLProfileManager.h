@@ -63,6 +63,13 @@ public:
 
     /**
      * Load a profiles XML file.
+     * When the environment variable FASTDDS_DEFERRED_XML_PROFILES is set to '1', the named profiles are only
+     * parsed when they are first requested.
+     * Only the participant, publisher, subscriber, topic, requester and replier profiles that are not default
+     * profiles are deferred. Types, transports, library settings and log configuration are still parsed on load,
+     * and the whole file is still read on every call.
+     * Errors on deferred profiles do not make this method fail: they are logged, and reported as
+     * XMLP_ret::XML_ERROR by the method requesting the profile.
      * @param filename Name for the file to be loaded.
      * @return XMLP_ret::XML_OK if all profiles are correct, XMLP_ret::XML_NOK if some are and some are not,
      *         XMLP_ret::XML_ERROR in other case.
@@ -225,6 +232,7 @@ public:
         topic_profiles_.clear();
         xml_files_.clear();
         transport_profiles_.clear();
+        clearDeferredProfiles();
     }
 
     /**
@@ -256,8 +264,32 @@ private:
 
     RTPS_DllAPI static XMLP_ret extractProfiles(
             up_base_node_t properties,
+            const std::string& filename,
+            unsigned int deferred_count = 0u);
+
+    /**
+     * Moves each named, non-default profile of the document to its own document, so it is only parsed when it is
+     * first requested.
+     * @param doc Document loaded from the XML file. Deferred profiles are removed from it.
+     * @param filename Name of the XML file.
+     * @return Number of deferred profiles.
+     */
+    RTPS_DllAPI static unsigned int deferProfiles(
+            tinyxml2::XMLDocument& doc,
             const std::string& filename);
 
+    /**
+     * Parses a deferred profile, if there is any with the given kind and name.
+     * @param kind XML tag of the profile kind (participant, publisher, subscriber, topic, requester or replier).
+     * @param profile_name Name of the profile.
+     * @return true if the profile has been parsed and extracted.
+     */
+    RTPS_DllAPI static bool parseDeferredProfile(
+            const char* kind,
+            const std::string& profile_name);
+
+    RTPS_DllAPI static void clearDeferredProfiles();
+
     RTPS_DllAPI static XMLP_ret extractParticipantProfile(
             up_base_node_t& profile,
             const std::string& filename);
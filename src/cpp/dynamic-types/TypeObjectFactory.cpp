@@ -168,6 +168,12 @@ TypeObjectFactory::~TypeObjectFactory()
         identifiers_.clear();
         complete_identifiers_.clear();
 
+        for (HashedIdentifierShard& shard : hashed_identifiers_)
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            shard.entries.clear();
+        }
+
         for (TypeIdentifier* id : identifiers_created_)
         {
             delete id;
@@ -202,6 +208,18 @@ void TypeObjectFactory::create_builtin_annotations()
 void TypeObjectFactory::nullify_all_entries(
         const TypeIdentifier* identifier)
 {
+    HashedIdentifierKey key;
+    if (get_hashed_identifier_key(identifier, key))
+    {
+        HashedIdentifierShard& shard = get_hashed_identifier_shard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto entry = shard.entries.find(key);
+        if (entry != shard.entries.end() && entry->second.identifier == identifier)
+        {
+            shard.entries.erase(entry);
+        }
+    }
+
     for (auto it = identifiers_.begin(); it != identifiers_.end(); ++it)
     {
         if (it->second == identifier)
@@ -225,6 +243,120 @@ void TypeObjectFactory::nullify_all_entries(
     }
 }
 
+bool TypeObjectFactory::get_hashed_identifier_key(
+        const TypeIdentifier* identifier,
+        HashedIdentifierKey& key)
+{
+    if (identifier == nullptr || (identifier->_d() != EK_MINIMAL && identifier->_d() != EK_COMPLETE))
+    {
+        return false;
+    }
+
+    key[0] = identifier->_d();
+    memcpy(key.data() + 1, identifier->equivalence_hash(), key.size() - 1);
+    return true;
+}
+
+TypeObjectFactory::HashedIdentifierShard& TypeObjectFactory::get_hashed_identifier_shard(
+        const HashedIdentifierKey& key) const
+{
+    return hashed_identifiers_[key[1] % hashed_identifier_shards];
+}
+
+void TypeObjectFactory::index_hashed_identifier(
+        const std::string& type_name,
+        const TypeIdentifier* identifier)
+{
+    HashedIdentifierKey key;
+    if (!get_hashed_identifier_key(identifier, key))
+    {
+        return;
+    }
+
+    HashedIdentifierShard& shard = get_hashed_identifier_shard(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    HashedIdentifierEntry& entry = shard.entries[key];
+    if (entry.identifier != identifier)
+    {
+        entry.identifier = identifier;
+        entry.object = nullptr;
+    }
+    entry.names.insert(type_name);
+}
+
+void TypeObjectFactory::unindex_hashed_identifier(
+        const std::string& type_name,
+        const TypeIdentifier* identifier)
+{
+    HashedIdentifierKey key;
+    if (!get_hashed_identifier_key(identifier, key))
+    {
+        return;
+    }
+
+    HashedIdentifierShard& shard = get_hashed_identifier_shard(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto entry = shard.entries.find(key);
+    if (entry != shard.entries.end() && entry->second.identifier == identifier)
+    {
+        entry->second.names.erase(type_name);
+        if (entry->second.names.empty())
+        {
+            shard.entries.erase(entry);
+        }
+    }
+}
+
+void TypeObjectFactory::index_hashed_object(
+        const TypeIdentifier* identifier,
+        const TypeObject* object)
+{
+    HashedIdentifierKey key;
+    if (!get_hashed_identifier_key(identifier, key))
+    {
+        return;
+    }
+
+    HashedIdentifierShard& shard = get_hashed_identifier_shard(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto entry = shard.entries.find(key);
+    if (entry != shard.entries.end() && entry->second.identifier == identifier)
+    {
+        entry->second.object = object;
+    }
+}
+
+const TypeIdentifier* TypeObjectFactory::find_hashed_identifier(
+        const TypeIdentifier* identifier,
+        std::string* name,
+        const TypeObject** object) const
+{
+    HashedIdentifierKey key;
+    if (!get_hashed_identifier_key(identifier, key))
+    {
+        return nullptr;
+    }
+
+    HashedIdentifierShard& shard = get_hashed_identifier_shard(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto entry = shard.entries.find(key);
+    if (entry == shard.entries.end())
+    {
+        return nullptr;
+    }
+
+    if (name != nullptr)
+    {
+        // Same name the ordered maps of identifiers would find first.
+        *name = *entry->second.names.begin();
+    }
+    if (object != nullptr)
+    {
+        *object = entry->second.object;
+    }
+    return entry->second.identifier;
+}
+
 const TypeInformation* TypeObjectFactory::get_type_information(
         const std::string& type_name) const
 {
@@ -873,11 +1005,18 @@ const TypeObject* TypeObjectFactory::get_type_object(
 const TypeObject* TypeObjectFactory::get_type_object(
         const TypeIdentifier* identifier) const
 {
-    std::unique_lock<std::recursive_mutex> scoped(m_MutexObjects);
     if (identifier == nullptr)
     {
         return nullptr;
     }
+
+    const TypeObject* object = nullptr;
+    if (find_hashed_identifier(identifier, nullptr, &object) != nullptr)
+    {
+        return object;
+    }
+
+    std::unique_lock<std::recursive_mutex> scoped(m_MutexObjects);
     if (identifier->_d() == EK_COMPLETE)
     {
         if (complete_objects_.find(identifier) != complete_objects_.end())
@@ -1116,11 +1255,16 @@ const TypeIdentifier* TypeObjectFactory::get_type_identifier_trying_complete(
 const TypeIdentifier* TypeObjectFactory::get_stored_type_identifier(
         const TypeIdentifier* identifier) const
 {
-    std::unique_lock<std::recursive_mutex> scoped(m_MutexIdentifiers);
     if (identifier == nullptr)
     {
         return nullptr;
     }
+    if (identifier->_d() == EK_MINIMAL || identifier->_d() == EK_COMPLETE)
+    {
+        return find_hashed_identifier(identifier, nullptr, nullptr);
+    }
+
+    std::unique_lock<std::recursive_mutex> scoped(m_MutexIdentifiers);
     if (identifier->_d() == EK_COMPLETE)
     {
         for (auto& it : complete_identifiers_)
@@ -1152,11 +1296,17 @@ const TypeIdentifier* TypeObjectFactory::get_stored_type_identifier(
 std::string TypeObjectFactory::get_type_name(
         const TypeIdentifier* identifier) const
 {
-    std::unique_lock<std::recursive_mutex> scoped(m_MutexIdentifiers);
     if (identifier == nullptr)
     {
         return "<NULLPTR>";
     }
+    if (identifier->_d() == EK_MINIMAL || identifier->_d() == EK_COMPLETE)
+    {
+        std::string name;
+        return find_hashed_identifier(identifier, &name, nullptr) != nullptr ? name : "UNDEF";
+    }
+
+    std::unique_lock<std::recursive_mutex> scoped(m_MutexIdentifiers);
     if (identifier->_d() == EK_COMPLETE)
     {
         for (auto& it : complete_identifiers_)
@@ -1338,22 +1488,24 @@ void TypeObjectFactory::add_type_identifier(
         const std::string& type_name,
         const TypeIdentifier* identifier)
 {
+    std::unique_lock<std::recursive_mutex> scoped(m_MutexIdentifiers);
+
     const TypeIdentifier* alreadyExists = get_stored_type_identifier(identifier);
     if (alreadyExists != nullptr && alreadyExists != identifier)
     {
         // Don't copy
-        if (is_type_identifier_complete(alreadyExists))
-        {
-            complete_identifiers_[type_name] = alreadyExists;
-        }
-        else
+        std::map<const std::string, const TypeIdentifier*>& names = is_type_identifier_complete(alreadyExists) ?
+                complete_identifiers_ : identifiers_;
+        auto previous = names.find(type_name);
+        if (previous != names.end() && previous->second != alreadyExists)
         {
-            identifiers_[type_name] = alreadyExists;
+            unindex_hashed_identifier(type_name, previous->second);
         }
+        names[type_name] = alreadyExists;
+        index_hashed_identifier(type_name, alreadyExists);
         return;
     }
 
-    std::unique_lock<std::recursive_mutex> scoped(m_MutexIdentifiers);
     //identifiers_.insert(std::pair<const std::string, const TypeIdentifier*>(type_name, identifier));
     if (is_type_identifier_complete(identifier))
     {
@@ -1363,6 +1515,7 @@ void TypeObjectFactory::add_type_identifier(
             identifiers_created_.push_back(id);
             *id = *identifier;
             complete_identifiers_[type_name] = id;
+            index_hashed_identifier(type_name, id);
         }
     }
     else
@@ -1373,6 +1526,7 @@ void TypeObjectFactory::add_type_identifier(
             identifiers_created_.push_back(id);
             *id = *identifier;
             identifiers_[type_name] = id;
+            index_hashed_identifier(type_name, id);
         }
     }
 }
@@ -1398,6 +1552,10 @@ void TypeObjectFactory::add_type_object(
                     TypeObject* obj = new TypeObject();
                     *obj = *object;
                     objects_[typeId] = obj;
+                    if (typeId != nullptr && typeId->_d() == EK_MINIMAL)
+                    {
+                        index_hashed_object(typeId, obj);
+                    }
                 }
             }
             else if (object->_d() == EK_COMPLETE)
@@ -1408,6 +1566,10 @@ void TypeObjectFactory::add_type_object(
                     TypeObject* obj = new TypeObject();
                     *obj = *object;
                     complete_objects_[typeId] = obj;
+                    if (typeId != nullptr && typeId->_d() == EK_COMPLETE)
+                    {
+                        index_hashed_object(typeId, obj);
+                    }
                 }
             }
         }
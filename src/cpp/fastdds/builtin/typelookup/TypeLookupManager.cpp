@@ -329,7 +329,8 @@ bool TypeLookupManager::create_endpoints()
 {
     // Built-in history attributes.
     HistoryAttributes hatt;
-    hatt.initialReservedCaches = 20;
+    // On a lazy startup the histories grow when the service is used
+    hatt.initialReservedCaches = participant_->lazy_startup() ? 1 : 20;
     hatt.maximumReservedCaches = 1000;
     hatt.payloadMaxSize = TYPELOOKUP_DATA_MAX_SIZE;
 
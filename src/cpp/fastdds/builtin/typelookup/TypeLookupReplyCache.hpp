@@ -0,0 +1,333 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TypeLookupReplyCache.hpp
+ *
+ */
+
+#ifndef _FASTDDS_BUILTIN_TYPELOOKUP_TYPELOOKUPREPLYCACHE_HPP_
+#define _FASTDDS_BUILTIN_TYPELOOKUP_TYPELOOKUPREPLYCACHE_HPP_
+
+#include <fastdds/dds/builtin/typelookup/common/TypeLookupTypes.hpp>
+#include <fastrtps/types/TypeObject.h>
+#include <fastrtps/types/TypeObjectFactory.h>
+#include <fastrtps/types/TypesBase.h>
+
+#include <array>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace builtin {
+
+/**
+ * Process-wide cache of the answers given by the TypeLookup service, shared by all the participants.
+ *
+ * Hashed type identifiers (EK_MINIMAL and EK_COMPLETE) are cached by their kind and equivalence hash, so answering
+ * a request for an already served type does not walk the TypeObjectFactory again.
+ * Only answers about known types are cached: the TypeObjectFactory never removes nor changes a registered type, so
+ * they cannot become stale.
+ */
+class TypeLookupReplyCache
+{
+public:
+
+    //! Maximum number of cached dependency answers. The cache is cleared when it is reached.
+    static constexpr size_t max_dependency_entries = 4096;
+
+    //! Cache shared by all the participants of the process.
+    static TypeLookupReplyCache& instance()
+    {
+        static TypeLookupReplyCache cache;
+        return cache;
+    }
+
+    TypeLookupReplyCache() = default;
+
+    /**
+     * Answers a getTypes request, from the cache when possible, and caches the new answers about known types.
+     * @param factory Factory where the types are registered.
+     * @param in Request.
+     * @param out Reply to fill.
+     */
+    void reply_types(
+            const fastrtps::types::TypeObjectFactory& factory,
+            const TypeLookup_getTypes_In& in,
+            TypeLookup_getTypes_Out& out)
+    {
+        for (const fastrtps::types::TypeIdentifier& type_id : in.type_ids)
+        {
+            // Types already served by any participant of the process are answered from the cache.
+            if (get_type(type_id, out))
+            {
+                continue;
+            }
+
+            fastrtps::types::TypeObject obj;
+            const fastrtps::types::TypeIdentifier* obj_ident = factory.typelookup_get_type(type_id, obj);
+
+            if (obj_ident != nullptr && obj._d() != 0)
+            {
+                fastrtps::types::TypeIdentifierTypeObjectPair pair;
+                pair.type_identifier(type_id);
+                pair.type_object(obj);
+                out.types.push_back(std::move(pair));
+            }
+
+            if (obj_ident != nullptr && !(type_id == *obj_ident))
+            {
+                fastrtps::types::TypeIdentifierPair pair;
+                pair.type_identifier1(*obj_ident);
+                pair.type_identifier2(type_id);
+                out.complete_to_minimal.push_back(std::move(pair));
+            }
+
+            if (obj_ident != nullptr && obj._d() != 0)
+            {
+                add_type(out.types.back(), !(type_id == *obj_ident) ? &out.complete_to_minimal.back() : nullptr);
+            }
+        }
+    }
+
+    /**
+     * Answers a getTypeDependencies request, from the cache when possible.
+     * The answer is cached only when the requested types and all their dependencies are registered, as the
+     * dependencies of a registered type never change. Otherwise the answer may be missing the dependencies of a type
+     * registered later.
+     * @param factory Factory where the types are registered.
+     * @param in Request.
+     * @param out Reply to fill.
+     */
+    void reply_type_dependencies(
+            const fastrtps::types::TypeObjectFactory& factory,
+            const TypeLookup_getTypeDependencies_In& in,
+            TypeLookup_getTypeDependencies_Out& out)
+    {
+        if (get_dependencies(in, out))
+        {
+            return;
+        }
+
+        out.dependent_typeids = factory.typelookup_get_type_dependencies(
+            in.type_ids, in.continuation_point, out.continuation_point, 255); // TODO: Make configurable?
+
+        bool all_known = true;
+        for (const fastrtps::types::TypeIdentifier& type_id : in.type_ids)
+        {
+            all_known = all_known && is_type_complete(factory, type_id);
+        }
+        for (const fastrtps::types::TypeIdentifierWithSize& dependency : out.dependent_typeids)
+        {
+            all_known = all_known && is_type_complete(factory, dependency.type_id());
+        }
+        if (all_known)
+        {
+            add_dependencies(in, out);
+        }
+    }
+
+    /**
+     * Appends the cached answer of a getTypes request for one identifier.
+     * @param type_id Requested identifier.
+     * @param out Reply where the answer is appended.
+     * @return true if the answer was cached.
+     */
+    bool get_type(
+            const fastrtps::types::TypeIdentifier& type_id,
+            TypeLookup_getTypes_Out& out)
+    {
+        HashKey key;
+        if (!hash_key(type_id, key))
+        {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> guard(mutex_);
+        auto it = types_.find(key);
+        if (types_.end() == it)
+        {
+            return false;
+        }
+
+        out.types.push_back(it->second.type);
+        if (it->second.has_complete_to_minimal)
+        {
+            out.complete_to_minimal.push_back(it->second.complete_to_minimal);
+        }
+        return true;
+    }
+
+    /**
+     * Stores the answer of a getTypes request for one identifier.
+     * @param type Identifier and object of the type.
+     * @param complete_to_minimal Pair of identifiers to answer too, or nullptr if there is none.
+     */
+    void add_type(
+            const fastrtps::types::TypeIdentifierTypeObjectPair& type,
+            const fastrtps::types::TypeIdentifierPair* complete_to_minimal)
+    {
+        HashKey key;
+        if (!hash_key(type.type_identifier(), key))
+        {
+            return;
+        }
+
+        TypeEntry entry;
+        entry.type = type;
+        entry.has_complete_to_minimal = (nullptr != complete_to_minimal);
+        if (entry.has_complete_to_minimal)
+        {
+            entry.complete_to_minimal = *complete_to_minimal;
+        }
+
+        std::lock_guard<std::mutex> guard(mutex_);
+        types_.emplace(key, std::move(entry));
+    }
+
+    /**
+     * Retrieves the cached answer of a getTypeDependencies request.
+     * @param in Request.
+     * @param out Reply to fill.
+     * @return true if the answer was cached.
+     */
+    bool get_dependencies(
+            const TypeLookup_getTypeDependencies_In& in,
+            TypeLookup_getTypeDependencies_Out& out)
+    {
+        DependenciesKey key;
+        if (!dependencies_key(in, key))
+        {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> guard(mutex_);
+        auto it = dependencies_.find(key);
+        if (dependencies_.end() == it)
+        {
+            return false;
+        }
+
+        out = it->second;
+        return true;
+    }
+
+    /**
+     * Stores the answer of a getTypeDependencies request whose identifiers are all known.
+     * @param in Request.
+     * @param out Reply.
+     */
+    void add_dependencies(
+            const TypeLookup_getTypeDependencies_In& in,
+            const TypeLookup_getTypeDependencies_Out& out)
+    {
+        DependenciesKey key;
+        if (!dependencies_key(in, key))
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> guard(mutex_);
+        if (dependencies_.size() >= max_dependency_entries)
+        {
+            dependencies_.clear();
+        }
+        dependencies_.emplace(std::move(key), out);
+    }
+
+private:
+
+    //! Kind of identifier and equivalence hash.
+    using HashKey = std::pair<fastrtps::types::octet, std::array<fastrtps::types::octet, 14>>;
+
+    //! Hashed identifiers and continuation point of a getTypeDependencies request.
+    using DependenciesKey = std::pair<std::vector<HashKey>, std::vector<uint8_t>>;
+
+    struct TypeEntry
+    {
+        fastrtps::types::TypeIdentifierTypeObjectPair type;
+
+        bool has_complete_to_minimal = false;
+
+        fastrtps::types::TypeIdentifierPair complete_to_minimal;
+    };
+
+    /**
+     * Checks whether a type is registered, together with the TypeObject from which its dependencies are taken.
+     * @param factory Factory where the types are registered.
+     * @param type_id Identifier of the type.
+     * @return true if the answers about the type cannot change anymore.
+     */
+    static bool is_type_complete(
+            const fastrtps::types::TypeObjectFactory& factory,
+            const fastrtps::types::TypeIdentifier& type_id)
+    {
+        if (!factory.typelookup_check_type_identifier(type_id))
+        {
+            return false;
+        }
+
+        // Hashed types also need their TypeObject, from which their own dependencies are taken.
+        return (type_id._d() != fastrtps::types::EK_MINIMAL && type_id._d() != fastrtps::types::EK_COMPLETE) ||
+               factory.get_type_object(&type_id) != nullptr;
+    }
+
+    static bool hash_key(
+            const fastrtps::types::TypeIdentifier& type_id,
+            HashKey& key)
+    {
+        if (fastrtps::types::EK_MINIMAL != type_id._d() && fastrtps::types::EK_COMPLETE != type_id._d())
+        {
+            return false;
+        }
+
+        key.first = type_id._d();
+        memcpy(key.second.data(), type_id.equivalence_hash(), key.second.size());
+        return true;
+    }
+
+    static bool dependencies_key(
+            const TypeLookup_getTypeDependencies_In& in,
+            DependenciesKey& key)
+    {
+        key.first.resize(in.type_ids.size());
+        for (size_t i = 0; i < in.type_ids.size(); ++i)
+        {
+            if (!hash_key(in.type_ids[i], key.first[i]))
+            {
+                return false;
+            }
+        }
+        key.second = in.continuation_point;
+        return true;
+    }
+
+    std::mutex mutex_;
+
+    std::map<HashKey, TypeEntry> types_;
+
+    std::map<DependenciesKey, TypeLookup_getTypeDependencies_Out> dependencies_;
+};
+
+} // namespace builtin
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_BUILTIN_TYPELOOKUP_TYPELOOKUPREPLYCACHE_HPP_
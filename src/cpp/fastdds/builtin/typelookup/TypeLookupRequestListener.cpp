@@ -23,6 +23,8 @@
 
 #include <fastrtps/types/TypeObjectFactory.h>
 
+#include "TypeLookupReplyCache.hpp"
+
 #include <fastrtps/rtps/reader/StatefulReader.h>
 #include <fastrtps/rtps/history/ReaderHistory.h>
 #include <fastdds/dds/log/Log.hpp>
@@ -88,28 +90,7 @@ void TypeLookupRequestListener::onNewCacheChangeAdded(
             {
                 const TypeLookup_getTypes_In in = request.data.getTypes();
                 TypeLookup_getTypes_Out out;
-
-                for (const TypeIdentifier& type_id : in.type_ids)
-                {
-                    TypeObject obj;
-                    const TypeIdentifier* obj_ident = factory_->typelookup_get_type(type_id, obj);
-
-                    if (obj_ident != nullptr && obj._d() != 0)
-                    {
-                        TypeIdentifierTypeObjectPair pair;
-                        pair.type_identifier(type_id);
-                        pair.type_object(obj);
-                        out.types.push_back(std::move(pair));
-                    }
-
-                    if (obj_ident != nullptr && !(type_id == *obj_ident))
-                    {
-                        TypeIdentifierPair pair;
-                        pair.type_identifier1(*obj_ident);
-                        pair.type_identifier2(type_id);
-                        out.complete_to_minimal.push_back(std::move(pair));
-                    }
-                }
+                TypeLookupReplyCache::instance().reply_types(*factory_, in, out);
 
                 TypeLookup_Reply* reply = static_cast<TypeLookup_Reply*>(tlm_->reply_type_.create_data());
                 TypeLookup_getTypes_Result result;
@@ -126,11 +107,7 @@ void TypeLookupRequestListener::onNewCacheChangeAdded(
             {
                 const TypeLookup_getTypeDependencies_In in = request.data.getTypeDependencies();
                 TypeLookup_getTypeDependencies_Out out;
-                //for (size_t index = 0; index < in.type_ids.size(); ++index)
-                {
-                    out.dependent_typeids = factory_->typelookup_get_type_dependencies(
-                        in.type_ids, in.continuation_point, out.continuation_point, 255); // TODO: Make configurable?
-                }
+                TypeLookupReplyCache::instance().reply_type_dependencies(*factory_, in, out);
 
                 TypeLookup_Reply* reply = static_cast<TypeLookup_Reply*>(tlm_->reply_type_.create_data());
                 TypeLookup_getTypeDependencies_Result result;
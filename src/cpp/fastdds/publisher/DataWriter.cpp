@@ -78,6 +78,28 @@ ReturnCode_t DataWriter::discard_loan(
     return impl_->discard_loan(sample);
 }
 
+ReturnCode_t DataWriter::loan_serialized_payload(
+        fastrtps::rtps::octet*& buffer,
+        uint32_t& buffer_size,
+        uint32_t max_size)
+{
+    return impl_->loan_serialized_payload(buffer, buffer_size, max_size);
+}
+
+ReturnCode_t DataWriter::write_serialized_loan(
+        fastrtps::rtps::octet*& buffer,
+        uint32_t length,
+        const InstanceHandle_t& handle)
+{
+    return impl_->write_serialized_loan(buffer, length, handle);
+}
+
+ReturnCode_t DataWriter::discard_serialized_loan(
+        fastrtps::rtps::octet*& buffer)
+{
+    return impl_->discard_serialized_loan(buffer);
+}
+
 bool DataWriter::write(
         void* data)
 {
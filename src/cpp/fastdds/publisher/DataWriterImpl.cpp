@@ -206,6 +206,24 @@ ReturnCode_t DataWriterImpl::enable()
         w_att.endpoint.properties.properties().push_back(std::move(property));
     }
 
+    // Timing constraint used by the earliest deadline first flow controller scheduler: the latency budget or, if not
+    // set, the deadline period.
+    if (nullptr == PropertyPolicyHelper::find_property(w_att.endpoint.properties, "fastdds.sfc.latency_budget_us"))
+    {
+        Duration_t latency_budget = qos_.latency_budget().duration;
+        if (latency_budget == c_TimeZero)
+        {
+            latency_budget = qos_.deadline().period;
+        }
+
+        if (latency_budget != c_TimeZero && latency_budget != c_TimeInfinite)
+        {
+            property.name("fastdds.sfc.latency_budget_us");
+            property.value(std::to_string(static_cast<uint64_t>(latency_budget.to_ns() / 1000)));
+            w_att.endpoint.properties.properties().push_back(std::move(property));
+        }
+    }
+
     if (qos_.reliable_writer_qos().disable_positive_acks.enabled &&
             qos_.reliable_writer_qos().disable_positive_acks.duration != c_TimeInfinite)
     {
@@ -460,6 +478,147 @@ ReturnCode_t DataWriterImpl::discard_loan(
     return ReturnCode_t::RETCODE_OK;
 }
 
+ReturnCode_t DataWriterImpl::loan_serialized_payload(
+        octet*& buffer,
+        uint32_t& buffer_size,
+        uint32_t max_size)
+{
+    // Buffer should have space for the representation header
+    if (SerializedPayload_t::representation_header_size > max_size)
+    {
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+
+    // Writer should be enabled
+    if (nullptr == writer_)
+    {
+        return ReturnCode_t::RETCODE_NOT_ENABLED;
+    }
+
+    std::lock_guard<RecursiveTimedMutex> lock(writer_->getMutex());
+
+    // Get one payload from the pool
+    PayloadInfo_t payload;
+    if (!get_free_payload_from_pool([max_size]()
+            {
+                return max_size;
+            }, payload))
+    {
+        return ReturnCode_t::RETCODE_OUT_OF_RESOURCES;
+    }
+
+    // Preallocated pools may have been configured with smaller payloads
+    if (payload.payload.max_size < max_size)
+    {
+        return_payload_to_pool(payload);
+        return ReturnCode_t::RETCODE_OUT_OF_RESOURCES;
+    }
+
+    payload.payload.length = 0;
+    payload.payload.pos = 0;
+
+    // Loans are indexed by the position after the representation header
+    buffer = payload.payload.data;
+    buffer_size = payload.payload.max_size;
+    if (!add_loan(buffer + SerializedPayload_t::representation_header_size, payload))
+    {
+        buffer = nullptr;
+        buffer_size = 0;
+        return_payload_to_pool(payload);
+        return ReturnCode_t::RETCODE_OUT_OF_RESOURCES;
+    }
+
+    return ReturnCode_t::RETCODE_OK;
+}
+
+ReturnCode_t DataWriterImpl::write_serialized_loan(
+        octet*& buffer,
+        uint32_t length,
+        const InstanceHandle_t& handle)
+{
+    // Writer should be enabled
+    if (nullptr == writer_)
+    {
+        return ReturnCode_t::RETCODE_NOT_ENABLED;
+    }
+
+    // The key cannot be computed from the serialized buffer
+    if (type_->m_isGetKeyDefined && !handle.isDefined())
+    {
+        return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+    }
+
+    if (nullptr == buffer)
+    {
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+
+    void* sample = buffer + SerializedPayload_t::representation_header_size;
+
+    {
+        std::lock_guard<RecursiveTimedMutex> lock(writer_->getMutex());
+
+        // Leave payload state as if serialization has already been performed
+        PayloadInfo_t payload;
+        if (!check_and_remove_loan(sample, payload))
+        {
+            return ReturnCode_t::RETCODE_BAD_PARAMETER;
+        }
+
+        bool valid_length = SerializedPayload_t::representation_header_size <= length &&
+                length <= payload.payload.max_size;
+        if (valid_length)
+        {
+            payload.payload.length = length;
+            payload.payload.pos = length;
+            payload.payload.encapsulation = payload.payload.data[1];
+        }
+
+        add_loan(sample, payload);
+
+        if (!valid_length)
+        {
+            return ReturnCode_t::RETCODE_BAD_PARAMETER;
+        }
+    }
+
+    // The loaned payload is taken by perform_create_new_change, skipping serialization
+    WriteParams wparams;
+    ReturnCode_t ret = create_new_change_with_params(ALIVE, sample, wparams, handle);
+    if (ReturnCode_t::RETCODE_OK == ret)
+    {
+        buffer = nullptr;
+    }
+
+    return ret;
+}
+
+ReturnCode_t DataWriterImpl::discard_serialized_loan(
+        octet*& buffer)
+{
+    // Writer should be enabled
+    if (nullptr == writer_)
+    {
+        return ReturnCode_t::RETCODE_NOT_ENABLED;
+    }
+
+    std::lock_guard<RecursiveTimedMutex> lock(writer_->getMutex());
+
+    // Remove buffer from loans collection
+    PayloadInfo_t payload;
+    if ((nullptr == buffer) ||
+            !check_and_remove_loan(buffer + SerializedPayload_t::representation_header_size, payload))
+    {
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+
+    // Return payload to pool
+    return_payload_to_pool(payload);
+    buffer = nullptr;
+
+    return ReturnCode_t::RETCODE_OK;
+}
+
 bool DataWriterImpl::write(
         void* data)
 {
@@ -1531,11 +1690,8 @@ std::shared_ptr<IPayloadPool> DataWriterImpl::get_payload_pool()
             }
         }
 
-        // Prepare loans collection for plain types only
-        if (type_->is_plain())
-        {
-            loans_.reset(new LoanCollection(config));
-        }
+        // Prepare loans collection. Non-plain types can only loan serialized payloads
+        loans_.reset(new LoanCollection(config));
     }
 
     return payload_pool_;
@@ -138,6 +138,49 @@ public:
     ReturnCode_t discard_loan(
             void*& sample);
 
+    /**
+     * Get a buffer on the internal pool where the user could directly serialize a sample.
+     *
+     * @param [out] buffer       Pointer to the buffer on the internal pool, starting with the representation header.
+     * @param [out] buffer_size  Size of the loaned buffer.
+     * @param [in]  max_size     Maximum serialized size the user will write.
+     *
+     * @return ReturnCode_t::RETCODE_BAD_PARAMETER if max_size cannot hold the representation header.
+     * @return ReturnCode_t::RETCODE_OUT_OF_RESOURCES if the pool has been exhausted or cannot hold max_size bytes.
+     * @return ReturnCode_t::RETCODE_OK if a buffer is successfully obtained.
+     */
+    ReturnCode_t loan_serialized_payload(
+            fastrtps::rtps::octet*& buffer,
+            uint32_t& buffer_size,
+            uint32_t max_size);
+
+    /**
+     * Publishes a loaned serialized buffer.
+     *
+     * @param [in,out] buffer  Pointer to the previously loaned buffer.
+     * @param [in]     length  Number of bytes serialized on the buffer.
+     * @param [in]     handle  Instance handle of the sample.
+     *
+     * @return ReturnCode_t::RETCODE_BAD_PARAMETER if the pointer does not correspond to a loaned buffer.
+     * @return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET if the topic is keyed and no handle is provided.
+     * @return ReturnCode_t::RETCODE_OK if the sample is correctly sent.
+     */
+    ReturnCode_t write_serialized_loan(
+            fastrtps::rtps::octet*& buffer,
+            uint32_t length,
+            const InstanceHandle_t& handle);
+
+    /**
+     * Discards a loaned serialized buffer.
+     *
+     * @param [in,out] buffer  Pointer to the previously loaned buffer.
+     *
+     * @return ReturnCode_t::RETCODE_BAD_PARAMETER if the pointer does not correspond to a loaned buffer.
+     * @return ReturnCode_t::RETCODE_OK if the loan is successfully discarded.
+     */
+    ReturnCode_t discard_serialized_loan(
+            fastrtps::rtps::octet*& buffer);
+
     /**
      * Write data to the topic.
      * @param data Pointer to the data
@@ -246,6 +246,8 @@ bool PublisherHistory::find_or_add_key(
     if (static_cast<int>(keyed_changes_.size()) < resource_limited_qos_.max_instances)
     {
         *vit_out = keyed_changes_.insert(std::make_pair(instance_handle, KeyedChanges())).first;
+        (*vit_out)->second.deadline_position =
+                keyed_deadlines_.emplace((*vit_out)->second.next_deadline_us, instance_handle);
         return true;
     }
 
@@ -386,6 +388,7 @@ bool PublisherHistory::remove_instance_changes(
 
     if (vit->second.cache_changes.empty())
     {
+        keyed_deadlines_.erase(vit->second.deadline_position);
         keyed_changes_.erase(vit);
     }
 
@@ -410,12 +413,15 @@ bool PublisherHistory::set_next_deadline(
     }
     else if (topic_att_.getTopicKind() == WITH_KEY)
     {
-        if (keyed_changes_.find(handle) == keyed_changes_.end())
+        auto vit = keyed_changes_.find(handle);
+        if (vit == keyed_changes_.end())
         {
             return false;
         }
 
-        keyed_changes_[handle].next_deadline_us = next_deadline_us;
+        keyed_deadlines_.erase(vit->second.deadline_position);
+        vit->second.deadline_position = keyed_deadlines_.emplace(next_deadline_us, handle);
+        vit->second.next_deadline_us = next_deadline_us;
         return true;
     }
 
@@ -435,18 +441,14 @@ bool PublisherHistory::get_next_deadline(
 
     if (topic_att_.getTopicKind() == WITH_KEY)
     {
-        auto min = std::min_element(
-            keyed_changes_.begin(),
-            keyed_changes_.end(),
-            [](
-                const std::pair<InstanceHandle_t, KeyedChanges>& lhs,
-                const std::pair<InstanceHandle_t, KeyedChanges>& rhs)
-            {
-                return lhs.second.next_deadline_us < rhs.second.next_deadline_us;
-            });
+        if (keyed_deadlines_.empty())
+        {
+            return false;
+        }
 
-        handle = min->first;
-        next_deadline_us = min->second.next_deadline_us;
+        auto min = keyed_deadlines_.begin();
+        handle = min->second;
+        next_deadline_us = min->first;
         return true;
     }
     else if (topic_att_.getTopicKind() == NO_KEY)
@@ -453,6 +453,8 @@ bool SubscriberHistory::find_key(
     if (keyed_changes_.size() < static_cast<size_t>(resource_limited_qos_.max_instances))
     {
         *vit_out = keyed_changes_.insert(std::make_pair(a_change->instanceHandle, KeyedChanges())).first;
+        (*vit_out)->second.deadline_position =
+                keyed_deadlines_.emplace((*vit_out)->second.next_deadline_us, a_change->instanceHandle);
         return true;
     }
     else
@@ -461,8 +463,11 @@ bool SubscriberHistory::find_key(
         {
             if (vit->second.cache_changes.size() == 0)
             {
+                keyed_deadlines_.erase(vit->second.deadline_position);
                 keyed_changes_.erase(vit);
                 *vit_out = keyed_changes_.insert(std::make_pair(a_change->instanceHandle, KeyedChanges())).first;
+                (*vit_out)->second.deadline_position =
+                        keyed_deadlines_.emplace((*vit_out)->second.next_deadline_us, a_change->instanceHandle);
                 return true;
             }
         }
@@ -582,12 +587,15 @@ bool SubscriberHistory::set_next_deadline(
     }
     else if (topic_att_.getTopicKind() == WITH_KEY)
     {
-        if (keyed_changes_.find(handle) == keyed_changes_.end())
+        auto vit = keyed_changes_.find(handle);
+        if (vit == keyed_changes_.end())
         {
             return false;
         }
 
-        keyed_changes_[handle].next_deadline_us = next_deadline_us;
+        keyed_deadlines_.erase(vit->second.deadline_position);
+        vit->second.deadline_position = keyed_deadlines_.emplace(next_deadline_us, handle);
+        vit->second.next_deadline_us = next_deadline_us;
         return true;
     }
 
@@ -612,16 +620,14 @@ bool SubscriberHistory::get_next_deadline(
     }
     else if (topic_att_.getTopicKind() == WITH_KEY)
     {
-        auto min = std::min_element(keyed_changes_.begin(),
-                        keyed_changes_.end(),
-                        [](
-                            const std::pair<InstanceHandle_t, KeyedChanges>& lhs,
-                            const std::pair<InstanceHandle_t, KeyedChanges>& rhs)
-                        {
-                            return lhs.second.next_deadline_us < rhs.second.next_deadline_us;
-                        });
-        handle = min->first;
-        next_deadline_us = min->second.next_deadline_us;
+        if (keyed_deadlines_.empty())
+        {
+            return false;
+        }
+
+        auto min = keyed_deadlines_.begin();
+        handle = min->second;
+        next_deadline_us = min->first;
         return true;
     }
 
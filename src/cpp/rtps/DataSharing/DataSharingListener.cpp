@@ -19,6 +19,7 @@
 #include <rtps/DataSharing/DataSharingListener.hpp>
 #include <fastdds/rtps/reader/RTPSReader.h>
 
+#include <chrono>
 #include <memory>
 #include <mutex>
 
@@ -31,13 +32,17 @@ DataSharingListener::DataSharingListener(
         std::shared_ptr<DataSharingNotification> notification,
         const std::string& datasharing_pools_directory,
         ResourceLimitedContainerConfig limits,
-        RTPSReader* reader)
+        RTPSReader* reader,
+        uint32_t busy_poll_us,
+        bool busy_poll_only)
     : notification_(notification)
     , is_running_(false)
     , reader_(reader)
     , writer_pools_(limits)
     , writer_pools_changed_(false)
     , datasharing_pools_directory_(datasharing_pools_directory)
+    , busy_poll_us_(busy_poll_us)
+    , busy_poll_only_(busy_poll_only)
 {
 }
 
@@ -52,13 +57,19 @@ void DataSharingListener::run()
     std::unique_lock<Segment::mutex> lock(notification_->notification_->notification_mutex, std::defer_lock);
     while (is_running_.load())
     {
-        lock.lock();
-        notification_->notification_->notification_cv.wait(lock, [&]
-                {
-                    return !is_running_.load() || notification_->notification_->new_data.load();
-                });
+        if (!busy_poll())
+        {
+            lock.lock();
+            notification_->waiting_listeners_->fetch_add(1);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            notification_->notification_->notification_cv.wait(lock, [&]
+                    {
+                        return !is_running_.load() || notification_->notification_->new_data.load();
+                    });
+            notification_->waiting_listeners_->fetch_sub(1);
 
-        lock.unlock();
+            lock.unlock();
+        }
 
         if (!is_running_.load())
         {
@@ -77,6 +88,28 @@ void DataSharingListener::run()
     }
 }
 
+bool DataSharingListener::busy_poll()
+{
+    if (!busy_poll_only_ && 0 == busy_poll_us_)
+    {
+        return false;
+    }
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(busy_poll_us_);
+    uint32_t spins = 0;
+
+    while (is_running_.load() && !notification_->notification_->new_data.load())
+    {
+        // Check the clock only once every 64 spins
+        if (!busy_poll_only_ && 0 == (++spins & 0x3F) && std::chrono::steady_clock::now() >= deadline)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 void DataSharingListener::start()
 {
     std::lock_guard<std::mutex> guard(mutex_);
@@ -161,8 +194,16 @@ void DataSharingListener::process_new_data ()
             {
                 if (last_sequence != c_SequenceNumber_Unknown && ch.sequenceNumber != last_sequence + 1)
                 {
-                    logWarning(RTPS_READER, "GAP (" << last_sequence + 1 << " - " << ch.sequenceNumber - 1 << ")"
-                                                    << " detected on datasharing writer " << pool->writer());
+                    if (pool->filtered_since_last_read())
+                    {
+                        logInfo(RTPS_READER, "Changes (" << last_sequence + 1 << " - " << ch.sequenceNumber - 1 << ")"
+                                                         << " filtered out by datasharing writer " << pool->writer());
+                    }
+                    else
+                    {
+                        logWarning(RTPS_READER, "GAP (" << last_sequence + 1 << " - " << ch.sequenceNumber - 1 << ")"
+                                                        << " detected on datasharing writer " << pool->writer());
+                    }
                     reader_->processGapMsg(pool->writer(), last_sequence + 1, SequenceNumberSet_t(ch.sequenceNumber));
                 }
 
@@ -220,6 +261,7 @@ bool DataSharingListener::add_datasharing_writer(
             std::static_pointer_cast<ReaderPool>(DataSharingPayloadPool::get_reader_pool(is_volatile));
     if (pool->init_shared_memory(writer_guid, datasharing_pools_directory_))
     {
+        pool->reader_guid(reader_->getGuid());
         if (0 >= reader_history_max_samples ||
                 reader_history_max_samples >= static_cast<int32_t>(pool->history_size()))
         {
@@ -43,11 +43,22 @@ public:
     typedef DataSharingNotification::Notification Notification;
     typedef DataSharingNotification::Segment Segment;
 
+    /**
+     * @param notification Shared notification the writers use to signal new data.
+     * @param datasharing_pools_directory Shared memory directory of the writers' pools.
+     * @param limits Allocation limits for the matched writers.
+     * @param reader Reader receiving the data.
+     * @param busy_poll_us Time, in microseconds, the listening thread spins waiting for
+     * new data before blocking on the notification.
+     * @param busy_poll_only When true the listening thread spins and never blocks.
+     */
     DataSharingListener(
             std::shared_ptr<DataSharingNotification> notification,
             const std::string& datasharing_pools_directory,
             ResourceLimitedContainerConfig limits,
-            RTPSReader* reader);
+            RTPSReader* reader,
+            uint32_t busy_poll_us = 0,
+            bool busy_poll_only = false);
 
     virtual ~DataSharingListener();
 
@@ -92,6 +103,12 @@ protected:
      */
     void process_new_data();
 
+    /**
+     * Spins until new data is notified, the listener is stopped or the busy-poll time elapses.
+     * @return true if new data is available or the listener was stopped.
+     */
+    bool busy_poll();
+
     struct WriterInfo
     {
         std::shared_ptr<ReaderPool> pool;
@@ -116,6 +133,8 @@ protected:
     std::atomic<bool> writer_pools_changed_;
     std::string datasharing_pools_directory_;
     mutable std::mutex mutex_;
+    uint32_t busy_poll_us_;
+    bool busy_poll_only_;
 
 };
 
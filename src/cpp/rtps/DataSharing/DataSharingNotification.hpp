@@ -49,14 +49,25 @@ public:
     virtual ~DataSharingNotification() = default;
 
     /**
-     * Notifies of new data
+     * Notifies of new data.
+     * The condition variable is only signaled if the listener is blocked on it,
+     * so a busy-polling listener does not cost a notification on every sample.
+     * Listeners that do not publish the number of blocked listeners are always signaled.
      */
     inline void notify()
     {
-        std::unique_lock<Segment::mutex> lock(notification_->notification_mutex);
         notification_->new_data.store(true);
-        lock.unlock();
-        notification_->notification_cv.notify_all();
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (nullptr == waiting_listeners_ || waiting_listeners_->load() > 0)
+        {
+            // Taking the mutex guarantees the listener is already blocked on notification_cv
+            // or has not evaluated its wait predicate yet.
+            {
+                std::lock_guard<Segment::mutex> lock(notification_->notification_mutex);
+            }
+            notification_->notification_cv.notify_all();
+        }
     }
 
     /**
@@ -89,6 +100,11 @@ public:
         return "fast_datasharing";
     }
 
+    constexpr static const char* waiting_listeners_chunk_name()
+    {
+        return "waiting_listeners";
+    }
+
 protected:
 
 #pragma warning(push)
@@ -137,7 +153,8 @@ protected:
 
         uint32_t per_allocation_extra_size = T::compute_per_allocation_extra_size(
             alignof(Notification), DataSharingNotification::domain_name());
-        uint32_t segment_size = static_cast<uint32_t>(sizeof(Notification)) + per_allocation_extra_size;
+        uint32_t segment_size = static_cast<uint32_t>(sizeof(Notification)) + per_allocation_extra_size +
+                static_cast<uint32_t>(sizeof(std::atomic<uint32_t>)) + per_allocation_extra_size;
 
         //Open the segment
         T::remove(segment_name_);
@@ -161,6 +178,10 @@ protected:
             // Alloc and initialize the Node
             notification_ = local_segment->get().template construct<Notification>("notification_node")();
             notification_->new_data.store(false);
+
+            // Kept out of the Notification node, so the node keeps its layout for writers not aware of it
+            waiting_listeners_ = local_segment->get().template construct<std::atomic<uint32_t>>(
+                waiting_listeners_chunk_name())(0u);
         }
         catch (std::exception& e)
         {
@@ -210,6 +231,10 @@ protected:
             return false;
         }
 
+        // The counter of blocked listeners is optional. Without it every notification is signaled
+        waiting_listeners_ = local_segment->get().template find<std::atomic<uint32_t>>(
+            waiting_listeners_chunk_name()).first;
+
         segment_ = std::move(local_segment);
         return true;
     }
@@ -219,6 +244,7 @@ protected:
 
     std::unique_ptr<Segment> segment_;  //< Shared memory segment
     Notification* notification_;        //< The notification data
+    std::atomic<uint32_t>* waiting_listeners_ = nullptr;  //< Number of listeners blocked on notification_cv
     bool owned_ = false;                //< Whether the shared segment is owned by this instance
 };
 
@@ -26,6 +26,8 @@
 #include <utils/shared_memory/SharedDir.hpp>
 #include <utils/shared_memory/SharedMemSegment.hpp>
 
+#include <atomic>
+#include <cstring>
 #include <memory>
 
 namespace eprosima {
@@ -101,6 +103,19 @@ public:
         return "history";
     }
 
+    constexpr static const char* filtered_chunk_name()
+    {
+        return "filtered";
+    }
+
+    constexpr static const char* reader_slots_chunk_name()
+    {
+        return "reader_slots";
+    }
+
+    //! Maximum number of readers that can be told apart on the per-entry filter masks
+    static constexpr uint32_t MAX_FILTERED_READERS = 64;
+
     uint32_t history_size() const
     {
         return descriptor_->history_size;
@@ -345,6 +360,63 @@ protected:
         uint64_t notified_end;          //< The index of the history entry that will be notified next
         uint32_t liveliness_sequence;   //< The ID of the last liveliness assertion sent by the writer
     };
+
+    /**
+     * GUID of the reader owning a bit of the filter masks.
+     * Only the writer changes it, while the readers may be reading it.
+     * Readers retry while the version is odd (update in progress) or changes during the read.
+     */
+    class alignas (uint64_t) ReaderSlot
+    {
+    public:
+
+        ReaderSlot()
+            : version_(0u)
+        {
+            // c_Guid_Unknown is all zeros
+            words_[0].store(0u);
+            words_[1].store(0u);
+        }
+
+        void store(
+                const GUID_t& guid)
+        {
+            uint64_t words[2];
+            std::memcpy(words, &guid, sizeof(words));
+
+            version_.fetch_add(1u, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            words_[0].store(words[0], std::memory_order_relaxed);
+            words_[1].store(words[1], std::memory_order_relaxed);
+            version_.fetch_add(1u, std::memory_order_release);
+        }
+
+        bool holds(
+                const GUID_t& guid) const
+        {
+            uint64_t words[2];
+            std::memcpy(words, &guid, sizeof(words));
+
+            bool same = false;
+            uint32_t version = 0u;
+            do
+            {
+                version = version_.load(std::memory_order_acquire);
+                same = words_[0].load(std::memory_order_relaxed) == words[0] &&
+                        words_[1].load(std::memory_order_relaxed) == words[1];
+                std::atomic_thread_fence(std::memory_order_acquire);
+            } while (0u != (version & 1u) || version != version_.load(std::memory_order_relaxed));
+
+            return same;
+        }
+
+    private:
+
+        static_assert(sizeof(GUID_t) == 2 * sizeof(uint64_t), "A GUID should fit in two words");
+
+        std::atomic<uint32_t> version_;     //< Odd while the writer is updating the slot
+        std::atomic<uint64_t> words_[2];    //< Contents of the GUID
+    };
 #pragma warning(pop)
 
     static std::string generate_segment_name(
@@ -376,6 +448,11 @@ protected:
     Segment::Offset* history_;      //< Offsets of the payloads that are currently in the writer's history
     PoolDescriptor* descriptor_;    //< Shared descriptor of the pool
 
+    //! Per history entry, bitmask of the reader slots for which the entry is not relevant
+    std::atomic<uint64_t>* filtered_ = nullptr;
+    //! GUIDs of the readers owning each bit of the filter masks
+    ReaderSlot* reader_slots_ = nullptr;
+
 };
 
 
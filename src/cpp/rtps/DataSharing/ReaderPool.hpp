@@ -39,6 +39,9 @@ public:
             bool is_volatile)
         : is_volatile_(is_volatile)
         , last_sn_(c_SequenceNumber_Unknown)
+        , reader_guid_(c_Guid_Unknown)
+        , reader_slot_(MAX_FILTERED_READERS)
+        , filtered_since_last_read_(false)
     {
     }
 
@@ -124,6 +127,15 @@ public:
             return false;
         }
 
+        // The filter masks are optional. Without them every entry is read
+        filtered_ = local_segment->get().template find<std::atomic<uint64_t>>(filtered_chunk_name()).first;
+        reader_slots_ = local_segment->get().template find<ReaderSlot>(reader_slots_chunk_name()).first;
+        if (!filtered_ || !reader_slots_)
+        {
+            filtered_ = nullptr;
+            reader_slots_ = nullptr;
+        }
+
         // Set the reading pointer
         if (is_volatile_)
         {
@@ -175,6 +187,14 @@ public:
                 break;
             }
 
+            if (is_filtered_out(next_payload_))
+            {
+                // The writer flagged the entry as not relevant for this reader. Skip it without touching the payload
+                advance(next_payload_);
+                filtered_since_last_read_ = true;
+                continue;
+            }
+
             // history_[next_payload_] contains the offset to the payload
             PayloadNode* payload = static_cast<PayloadNode*>(
                 segment_->get_address_from_offset(history_[static_cast<uint32_t>(next_payload_)]));
@@ -238,6 +258,7 @@ public:
 
     bool advance_to_next_payload()
     {
+        filtered_since_last_read_ = false;
         if (next_payload_ < end())
         {
             advance(next_payload_);
@@ -246,6 +267,25 @@ public:
         return false;
     }
 
+    /**
+     * Sets the GUID of the reader owning this pool, used to find its slot on the writer's filter masks
+     */
+    void reader_guid(
+            const GUID_t& reader_guid)
+    {
+        reader_guid_ = reader_guid;
+        reader_slot_ = MAX_FILTERED_READERS;
+    }
+
+    /**
+     * @return whether entries filtered out by the writer were skipped after the last processed payload.
+     * In that case a jump on the sequence numbers is expected.
+     */
+    bool filtered_since_last_read() const
+    {
+        return filtered_since_last_read_;
+    }
+
 protected:
 
     bool ensure_reading_reference_is_in_bounds()
@@ -270,9 +310,49 @@ protected:
 
 private:
 
+    bool is_filtered_out(
+            uint64_t index)
+    {
+        // Free slots hold the unknown GUID, so a pool without a reader GUID is never filtered
+        if (nullptr == filtered_ || c_Guid_Unknown == reader_guid_)
+        {
+            return false;
+        }
+
+        uint64_t filtered = filtered_[static_cast<uint32_t>(index)].load();
+        if (0u == filtered)
+        {
+            return false;
+        }
+
+        // The slot may have been released and reassigned by the writer
+        if (reader_slot_ >= MAX_FILTERED_READERS || !reader_slots_[reader_slot_].holds(reader_guid_))
+        {
+            reader_slot_ = MAX_FILTERED_READERS;
+            for (uint32_t slot = 0; slot < MAX_FILTERED_READERS; ++slot)
+            {
+                if (reader_slots_[slot].holds(reader_guid_))
+                {
+                    reader_slot_ = slot;
+                    break;
+                }
+            }
+
+            if (reader_slot_ >= MAX_FILTERED_READERS)
+            {
+                return false;
+            }
+        }
+
+        return 0u != (filtered & (uint64_t(1) << reader_slot_));
+    }
+
     bool is_volatile_;              //< Whether the reader is volatile or not
     uint64_t next_payload_;         //< Index of the next history position to read
     SequenceNumber_t last_sn_;      //< Sequence number of the last read payload
+    GUID_t reader_guid_;            //< GUID of the reader owning the pool
+    uint32_t reader_slot_;          //< Slot of the reader on the filter masks
+    bool filtered_since_last_read_; //< Whether filtered entries were skipped since the last processed payload
 };
 
 }  // namespace rtps
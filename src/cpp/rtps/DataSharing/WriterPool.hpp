@@ -165,9 +165,23 @@ public:
         uint32_t size_for_history = static_cast<uint32_t>(estimated_size_for_history);
 
         uint32_t descriptor_size = static_cast<uint32_t>(sizeof(PoolDescriptor));
+
+        //Filter masks are parallel to the history
+        uint64_t estimated_size_for_filtered = (pool_size_ + 1) * sizeof(std::atomic<uint64_t>);
+        overflow |= (estimated_size_for_filtered != static_cast<uint32_t>(estimated_size_for_filtered));
+        uint32_t size_for_filtered = static_cast<uint32_t>(estimated_size_for_filtered);
+        uint32_t size_for_reader_slots = static_cast<uint32_t>(MAX_FILTERED_READERS * sizeof(ReaderSlot));
+
         uint64_t estimated_segment_size = size_for_payloads_pool + per_allocation_extra_size +
                 size_for_history + per_allocation_extra_size +
-                descriptor_size + per_allocation_extra_size;
+                descriptor_size + per_allocation_extra_size +
+                size_for_filtered + per_allocation_extra_size +
+                size_for_reader_slots + per_allocation_extra_size;
+        if (huge_pages_)
+        {
+            estimated_segment_size = T::round_to_huge_pages(
+                static_cast<size_t>(estimated_segment_size + T::EXTRA_SEGMENT_SIZE)) - T::EXTRA_SEGMENT_SIZE;
+        }
         overflow |= (estimated_segment_size != static_cast<uint32_t>(estimated_segment_size));
         uint32_t segment_size = static_cast<uint32_t>(estimated_segment_size);
 
@@ -197,6 +211,18 @@ public:
             return false;
         }
 
+        if (huge_pages_)
+        {
+            // Advice must be given before the pages are touched.
+            // Prefaulting here keeps page faults out of the first samples written.
+            if (!local_segment->advise_huge_pages())
+            {
+                logWarning(DATASHARING_PAYLOADPOOL, "Huge pages not available for segment " << segment_name_
+                                                                                            << ", using regular pages");
+            }
+            local_segment->prefault();
+        }
+
         try
         {
             // Alloc the memory for the pool
@@ -223,6 +249,12 @@ public:
             //Alloc the memory for the descriptor
             descriptor_ = local_segment->get().template construct<PoolDescriptor>(descriptor_chunk_name())();
 
+            //Alloc the memory for the reader filters. Nothing is filtered until a reader registers
+            filtered_ = local_segment->get().template construct<std::atomic<uint64_t>>(filtered_chunk_name())[
+                pool_size_ + 1](0u);
+            reader_slots_ = local_segment->get().template construct<ReaderSlot>(reader_slots_chunk_name())[
+                MAX_FILTERED_READERS]();
+
             // Initialize the data in the descriptor
             descriptor_->history_size = pool_size_ + 1;
             descriptor_->notified_begin = 0u;
@@ -262,9 +294,13 @@ public:
     /**
      * Fills the metadata of the shared payload from the cache change information
      * and adds the payload's offset to the shared history
+     * @param cache_change The change to add
+     * @param filtered_readers Mask of the reader slots (see @ref reader_mask) for which the change is not relevant.
+     * Those readers will skip the entry without reading the payload.
      */
     void add_to_shared_history(
-            const CacheChange_t* cache_change)
+            const CacheChange_t* cache_change,
+            uint64_t filtered_readers = 0u)
     {
         assert(cache_change);
         assert(cache_change->serializedPayload.data);
@@ -286,7 +322,8 @@ public:
         // Set the sequence number last, it signals the data is ready
         node->sequence_number(cache_change->sequenceNumber);
 
-        // Add it to the history
+        // Add it to the history. The filter mask must be ready before the entry is published
+        filtered_[static_cast<uint32_t>(descriptor_->notified_end)].store(filtered_readers);
         history_[static_cast<uint32_t>(descriptor_->notified_end)] = segment_->get_offset_from_address(node);
         logInfo(DATASHARING_PAYLOADPOOL, "Change added to shared history"
                 << " with SN " << cache_change->sequenceNumber);
@@ -340,11 +377,98 @@ public:
         ++descriptor_->liveliness_sequence;
     }
 
+    /**
+     * Reserves a slot on the filter masks for a datasharing reader
+     * @param reader_guid GUID of the reader
+     * @return false if all the slots are in use. The reader will then receive every change.
+     */
+    bool register_reader(
+            const GUID_t& reader_guid)
+    {
+        if (!is_initialized_)
+        {
+            return false;
+        }
+
+        for (uint32_t slot = 0; slot < MAX_FILTERED_READERS; ++slot)
+        {
+            if (reader_slots_[slot].holds(c_Guid_Unknown))
+            {
+                // Entries still in the history may carry the flags of the previous owner of the slot
+                uint64_t mask = uint64_t(1) << slot;
+                for (uint32_t i = 0; i < descriptor_->history_size; ++i)
+                {
+                    filtered_[i].fetch_and(~mask);
+                }
+
+                reader_slots_[slot].store(reader_guid);
+                return true;
+            }
+        }
+
+        logInfo(DATASHARING_PAYLOADPOOL, "No filter slot available for reader " << reader_guid);
+        return false;
+    }
+
+    /**
+     * Releases the slot a datasharing reader had on the filter masks
+     * @param reader_guid GUID of the reader
+     */
+    void unregister_reader(
+            const GUID_t& reader_guid)
+    {
+        if (!is_initialized_)
+        {
+            return;
+        }
+
+        for (uint32_t slot = 0; slot < MAX_FILTERED_READERS; ++slot)
+        {
+            if (reader_slots_[slot].holds(reader_guid))
+            {
+                reader_slots_[slot].store(c_Guid_Unknown);
+                return;
+            }
+        }
+    }
+
+    /**
+     * @param reader_guid GUID of the reader
+     * @return The bit that represents the reader on the filter masks, or 0 if it has no slot
+     */
+    uint64_t reader_mask(
+            const GUID_t& reader_guid) const
+    {
+        if (!is_initialized_)
+        {
+            return 0u;
+        }
+
+        for (uint32_t slot = 0; slot < MAX_FILTERED_READERS; ++slot)
+        {
+            if (reader_slots_[slot].holds(reader_guid))
+            {
+                return uint64_t(1) << slot;
+            }
+        }
+        return 0u;
+    }
+
     bool is_initialized() const
     {
         return is_initialized_;
     }
 
+    /**
+     * Configures whether the shared segment should be backed by huge pages.
+     * Only takes effect if called before @ref init_shared_memory.
+     */
+    void huge_pages(
+            bool huge_pages)
+    {
+        huge_pages_ = huge_pages;
+    }
+
 private:
 
     octet* payloads_pool_;          //< Shared pool of payloads
@@ -359,6 +483,8 @@ private:
 
     bool is_initialized_ = false;   //< Whether the pool has been initialized on shared memory
 
+    bool huge_pages_ = false;       //< Whether the shared segment should be backed by huge pages
+
 };
 
 
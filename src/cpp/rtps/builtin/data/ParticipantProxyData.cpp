@@ -37,8 +37,9 @@
 #include "ProxyDataFilters.hpp"
 #include "ProxyHashTables.hpp"
 
-#include <mutex>
+#include <algorithm>
 #include <chrono>
+#include <mutex>
 
 using namespace eprosima::fastrtps;
 using ParameterList = eprosima::fastdds::dds::ParameterList;
@@ -698,6 +699,7 @@ void ParticipantProxyData::clear()
     m_properties.length = 0;
     m_userData.clear();
     m_userData.length = 0;
+    last_announcement_.clear();
 }
 
 void ParticipantProxyData::copy(
@@ -853,6 +855,19 @@ void ParticipantProxyData::assert_liveliness()
     last_received_message_tm_ = std::chrono::steady_clock::now();
 }
 
+bool ParticipantProxyData::is_same_announcement(
+        const SerializedPayload_t& payload) const
+{
+    return !last_announcement_.empty() && last_announcement_.size() == payload.length &&
+           std::equal(last_announcement_.begin(), last_announcement_.end(), payload.data);
+}
+
+void ParticipantProxyData::store_announcement(
+        const SerializedPayload_t& payload)
+{
+    last_announcement_.assign(payload.data, payload.data + payload.length);
+}
+
 } /* namespace rtps */
 } /* namespace fastrtps */
 } /* namespace eprosima */
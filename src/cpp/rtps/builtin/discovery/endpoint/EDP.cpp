@@ -34,8 +34,6 @@
 
 #include <fastrtps/attributes/TopicAttributes.h>
 
-#include <fastrtps/utils/StringMatching.h>
-
 #include <fastrtps/types/TypeObjectFactory.h>
 
 #include <fastdds/core/policy/ParameterList.hpp>
@@ -44,6 +42,7 @@
 #include <foonathan/memory/memory_pool.hpp>
 
 #include <rtps/builtin/data/ProxyHashTables.hpp>
+#include <rtps/builtin/discovery/endpoint/PartitionMatcher.hpp>
 #include <rtps/participant/RTPSParticipantImpl.h>
 
 #include <utils/collections/node_size_helpers.hpp>
@@ -520,6 +519,7 @@ bool EDP::updatedLocalWriter(
 bool EDP::unpairWriterProxy(
         const GUID_t& participant_guid,
         const GUID_t& writer_guid,
+        const std::string& topic_name,
         bool removed_by_lease)
 {
     (void)participant_guid;
@@ -527,8 +527,8 @@ bool EDP::unpairWriterProxy(
     logInfo(RTPS_EDP, writer_guid);
 
     std::lock_guard<std::recursive_mutex> guard(*mp_RTPSParticipant->getParticipantMutex());
-    for (std::vector<RTPSReader*>::iterator rit = mp_RTPSParticipant->userReadersListBegin();
-            rit != mp_RTPSParticipant->userReadersListEnd(); ++rit)
+    const std::vector<RTPSReader*>& readers = mp_RTPSParticipant->user_readers_on_topic(topic_name);
+    for (std::vector<RTPSReader*>::const_iterator rit = readers.begin(); rit != readers.end(); ++rit)
     {
         if ((*rit)->matched_writer_remove(writer_guid, removed_by_lease))
         {
@@ -557,15 +557,16 @@ bool EDP::unpairWriterProxy(
 
 bool EDP::unpairReaderProxy(
         const GUID_t& participant_guid,
-        const GUID_t& reader_guid)
+        const GUID_t& reader_guid,
+        const std::string& topic_name)
 {
     (void)participant_guid;
 
     logInfo(RTPS_EDP, reader_guid);
 
     std::lock_guard<std::recursive_mutex> guard(*mp_RTPSParticipant->getParticipantMutex());
-    for (std::vector<RTPSWriter*>::iterator wit = mp_RTPSParticipant->userWritersListBegin();
-            wit != mp_RTPSParticipant->userWritersListEnd(); ++wit)
+    const std::vector<RTPSWriter*>& writers = mp_RTPSParticipant->user_writers_on_topic(topic_name);
+    for (std::vector<RTPSWriter*>::const_iterator wit = writers.begin(); wit != writers.end(); ++wit)
     {
         if ((*wit)->matched_reader_remove(reader_guid))
         {
@@ -735,23 +736,7 @@ bool EDP::valid_matching(
     }
     else
     {
-        for (auto wnameit = wdata->m_qos.m_partition.begin();
-                wnameit !=  wdata->m_qos.m_partition.end(); ++wnameit)
-        {
-            for (auto rnameit = rdata->m_qos.m_partition.begin();
-                    rnameit != rdata->m_qos.m_partition.end(); ++rnameit)
-            {
-                if (StringMatching::matchString(wnameit->name(), rnameit->name()))
-                {
-                    matched = true;
-                    break;
-                }
-            }
-            if (matched)
-            {
-                break;
-            }
-        }
+        matched = partitions_match(wdata->m_qos.m_partition, rdata->m_qos.m_partition);
     }
     if (!matched) //Different partitions
     {
@@ -762,6 +747,59 @@ bool EDP::valid_matching(
     return matched;
 }
 
+bool EDP::partitions_match(
+        const fastdds::dds::PartitionQosPolicy& writer_partitions,
+        const fastdds::dds::PartitionQosPolicy& reader_partitions)
+{
+    // Upper bound on the number of cached results, so unrelated partition sets cannot grow it indefinitely.
+    constexpr size_t max_cached_partition_matches = 4096;
+    // Upper bound on the number of compiled partition sets.
+    constexpr size_t max_partition_matchers = 1024;
+
+    std::lock_guard<std::mutex> guard(partition_matches_mutex_);
+
+    // Make room for both sets before looking them up, so compiling the second one cannot drop the first one.
+    // Cached results refer to the matchers by address, so they are dropped with them.
+    if (partition_matchers_.size() + 2 > max_partition_matchers)
+    {
+        partition_matches_.clear();
+        partition_matchers_.clear();
+    }
+
+    std::shared_ptr<const PartitionMatcher> writer_matcher = partition_matcher(writer_partitions);
+    std::shared_ptr<const PartitionMatcher> reader_matcher = partition_matcher(reader_partitions);
+
+    std::pair<const PartitionMatcher*, const PartitionMatcher*> key(writer_matcher.get(), reader_matcher.get());
+    auto it = partition_matches_.find(key);
+    if (it != partition_matches_.end())
+    {
+        return it->second;
+    }
+
+    bool matched = writer_matcher->matches(*reader_matcher);
+    if (partition_matches_.size() >= max_cached_partition_matches)
+    {
+        partition_matches_.clear();
+    }
+    partition_matches_.emplace(key, matched);
+    return matched;
+}
+
+std::shared_ptr<const PartitionMatcher> EDP::partition_matcher(
+        const fastdds::dds::PartitionQosPolicy& partitions)
+{
+    std::string key = PartitionMatcher::key(partitions);
+    auto it = partition_matchers_.find(key);
+    if (it != partition_matchers_.end())
+    {
+        return it->second;
+    }
+
+    auto matcher = std::make_shared<const PartitionMatcher>(partitions);
+    partition_matchers_.emplace(std::move(key), matcher);
+    return matcher;
+}
+
 /**
  * @brief EDP::checkDataRepresentationQos
  * Table 7.57 XTypes document 1.2
@@ -961,23 +999,7 @@ bool EDP::valid_matching(
     }
     else
     {
-        for (auto wnameit = rdata->m_qos.m_partition.begin();
-                wnameit !=  rdata->m_qos.m_partition.end(); ++wnameit)
-        {
-            for (auto rnameit = wdata->m_qos.m_partition.begin();
-                    rnameit != wdata->m_qos.m_partition.end(); ++rnameit)
-            {
-                if (StringMatching::matchString(wnameit->name(), rnameit->name()))
-                {
-                    matched = true;
-                    break;
-                }
-            }
-            if (matched)
-            {
-                break;
-            }
-        }
+        matched = partitions_match(wdata->m_qos.m_partition, rdata->m_qos.m_partition);
     }
     if (!matched) //Different partitions
     {
@@ -1179,8 +1201,8 @@ bool EDP::pairing_reader_proxy_with_any_local_writer(
     logInfo(RTPS_EDP, rdata->guid() << " in topic: \"" << rdata->topicName() << "\"");
     std::lock_guard<std::recursive_mutex> pguard(*mp_PDP->getMutex());
     std::lock_guard<std::recursive_mutex> guard(*mp_RTPSParticipant->getParticipantMutex());
-    for (std::vector<RTPSWriter*>::iterator wit = mp_RTPSParticipant->userWritersListBegin();
-            wit != mp_RTPSParticipant->userWritersListEnd(); ++wit)
+    const std::vector<RTPSWriter*>& writers = mp_RTPSParticipant->user_writers_on_topic(rdata->topicName().to_string());
+    for (std::vector<RTPSWriter*>::const_iterator wit = writers.begin(); wit != writers.end(); ++wit)
     {
         (*wit)->getMutex().lock();
         GUID_t writerGUID = (*wit)->getGuid();
@@ -1264,8 +1286,8 @@ bool EDP::pairing_reader_proxy_with_local_writer(
     logInfo(RTPS_EDP, rdata.guid() << " in topic: \"" << rdata.topicName() << "\"");
     std::lock_guard<std::recursive_mutex> pguard(*mp_PDP->getMutex());
     std::lock_guard<std::recursive_mutex> guard(*mp_RTPSParticipant->getParticipantMutex());
-    for (std::vector<RTPSWriter*>::iterator wit = mp_RTPSParticipant->userWritersListBegin();
-            wit != mp_RTPSParticipant->userWritersListEnd(); ++wit)
+    const std::vector<RTPSWriter*>& writers = mp_RTPSParticipant->user_writers_on_topic(rdata.topicName().to_string());
+    for (std::vector<RTPSWriter*>::const_iterator wit = writers.begin(); wit != writers.end(); ++wit)
     {
         (*wit)->getMutex().lock();
         GUID_t writerGUID = (*wit)->getGuid();
@@ -1326,8 +1348,9 @@ bool EDP::pairing_remote_reader_with_local_writer_after_security(
         const ReaderProxyData& remote_reader_data)
 {
     std::lock_guard<std::recursive_mutex> guard(*mp_RTPSParticipant->getParticipantMutex());
-    for (std::vector<RTPSWriter*>::iterator wit = mp_RTPSParticipant->userWritersListBegin();
-            wit != mp_RTPSParticipant->userWritersListEnd(); ++wit)
+    const std::vector<RTPSWriter*>& writers =
+            mp_RTPSParticipant->user_writers_on_topic(remote_reader_data.topicName().to_string());
+    for (std::vector<RTPSWriter*>::const_iterator wit = writers.begin(); wit != writers.end(); ++wit)
     {
         (*wit)->getMutex().lock();
         GUID_t writerGUID = (*wit)->getGuid();
@@ -1374,8 +1397,8 @@ bool EDP::pairing_writer_proxy_with_any_local_reader(
     logInfo(RTPS_EDP, wdata->guid() << " in topic: \"" << wdata->topicName() << "\"");
     std::lock_guard<std::recursive_mutex> pguard(*mp_PDP->getMutex());
     std::lock_guard<std::recursive_mutex> guard(*mp_RTPSParticipant->getParticipantMutex());
-    for (std::vector<RTPSReader*>::iterator rit = mp_RTPSParticipant->userReadersListBegin();
-            rit != mp_RTPSParticipant->userReadersListEnd(); ++rit)
+    const std::vector<RTPSReader*>& readers = mp_RTPSParticipant->user_readers_on_topic(wdata->topicName().to_string());
+    for (std::vector<RTPSReader*>::const_iterator rit = readers.begin(); rit != readers.end(); ++rit)
     {
         GUID_t readerGUID;
         (*rit)->getMutex().lock();
@@ -1459,8 +1482,8 @@ bool EDP::pairing_writer_proxy_with_local_reader(
     logInfo(RTPS_EDP, wdata.guid() << " in topic: \"" << wdata.topicName() << "\"");
     std::lock_guard<std::recursive_mutex> pguard(*mp_PDP->getMutex());
     std::lock_guard<std::recursive_mutex> guard(*mp_RTPSParticipant->getParticipantMutex());
-    for (std::vector<RTPSReader*>::iterator rit = mp_RTPSParticipant->userReadersListBegin();
-            rit != mp_RTPSParticipant->userReadersListEnd(); ++rit)
+    const std::vector<RTPSReader*>& readers = mp_RTPSParticipant->user_readers_on_topic(wdata.topicName().to_string());
+    for (std::vector<RTPSReader*>::const_iterator rit = readers.begin(); rit != readers.end(); ++rit)
     {
         GUID_t readerGUID;
         (*rit)->getMutex().lock();
@@ -1521,8 +1544,9 @@ bool EDP::pairing_remote_writer_with_local_reader_after_security(
         const WriterProxyData& remote_writer_data)
 {
     std::lock_guard<std::recursive_mutex> guard(*mp_RTPSParticipant->getParticipantMutex());
-    for (std::vector<RTPSReader*>::iterator rit = mp_RTPSParticipant->userReadersListBegin();
-            rit != mp_RTPSParticipant->userReadersListEnd(); ++rit)
+    const std::vector<RTPSReader*>& readers =
+            mp_RTPSParticipant->user_readers_on_topic(remote_writer_data.topicName().to_string());
+    for (std::vector<RTPSReader*>::const_iterator rit = readers.begin(); rit != readers.end(); ++rit)
     {
         GUID_t readerGUID;
         (*rit)->getMutex().lock();
@@ -0,0 +1,150 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PartitionMatcher.hpp
+ */
+
+#ifndef _RTPS_BUILTIN_DISCOVERY_ENDPOINT_PARTITIONMATCHER_HPP_
+#define _RTPS_BUILTIN_DISCOVERY_ENDPOINT_PARTITIONMATCHER_HPP_
+
+#include <fastdds/dds/core/policy/QosPolicies.hpp>
+#include <fastrtps/utils/StringMatching.h>
+
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Set of partition names prepared to be matched against other sets.
+ *
+ * Names without wildcards are kept in a hash set, so two sets of literal names are matched without comparing every
+ * pair of names. Only the names with wildcards are matched with StringMatching.
+ */
+class PartitionMatcher
+{
+public:
+
+    explicit PartitionMatcher(
+            const fastdds::dds::PartitionQosPolicy& partitions)
+    {
+        for (auto it = partitions.begin(); it != partitions.end(); ++it)
+        {
+            names_.emplace_back(it->name());
+            if (is_literal(names_.back()))
+            {
+                literals_.insert(names_.back());
+            }
+            else
+            {
+                patterns_.push_back(names_.back());
+            }
+        }
+    }
+
+    /**
+     * Builds a key which identifies the names of a set of partitions.
+     * @param partitions Set of partitions.
+     * @return The names of the partitions, each one followed by a null character.
+     */
+    static std::string key(
+            const fastdds::dds::PartitionQosPolicy& partitions)
+    {
+        std::string key;
+        for (auto it = partitions.begin(); it != partitions.end(); ++it)
+        {
+            key.append(it->name());
+            key.push_back('\0');
+        }
+        return key;
+    }
+
+    /**
+     * Checks whether any name of this set matches any name of another set, as StringMatching::matchString does.
+     * @param other Another set of partitions.
+     * @return True if any pair of names match.
+     */
+    bool matches(
+            const PartitionMatcher& other) const
+    {
+        const PartitionMatcher& smaller = literals_.size() < other.literals_.size() ? *this : other;
+        const PartitionMatcher& larger = literals_.size() < other.literals_.size() ? other : *this;
+        for (const std::string& name : smaller.literals_)
+        {
+            if (larger.literals_.count(name) != 0)
+            {
+                return true;
+            }
+        }
+
+        // Patterns are checked against every name of the other set, and only against the literals of this set, as
+        // the pairs of patterns have already been checked.
+        for (const std::string& pattern : patterns_)
+        {
+            for (const std::string& name : other.names_)
+            {
+                if (StringMatching::matchString(pattern.c_str(), name.c_str()))
+                {
+                    return true;
+                }
+            }
+        }
+
+        for (const std::string& pattern : other.patterns_)
+        {
+            for (const std::string& name : literals_)
+            {
+                if (StringMatching::matchString(name.c_str(), pattern.c_str()))
+                {
+                    return true;
+                }
+            }
+        }
+
+        return false;
+    }
+
+private:
+
+    static bool is_literal(
+            const std::string& name)
+    {
+#if defined(_WIN32)
+        // Matching is case insensitive on Windows, so every name is matched with StringMatching.
+        (void)name;
+        return false;
+#else
+        return std::string::npos == name.find_first_of("*?[");
+#endif // if defined(_WIN32)
+    }
+
+    //! All the names of the set.
+    std::vector<std::string> names_;
+
+    //! Names without wildcards.
+    std::unordered_set<std::string> literals_;
+
+    //! Names with wildcards.
+    std::vector<std::string> patterns_;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // _RTPS_BUILTIN_DISCOVERY_ENDPOINT_PARTITIONMATCHER_HPP_
@@ -102,6 +102,22 @@ bool DirectMessageSender::send(
                    Locators(locators_->begin()), Locators(locators_->end()), max_blocking_time_point);
 }
 
+/**
+ * Send a message made of several slices through this interface.
+ *
+ * @param buffers List of slices composing the message.
+ * @param total_bytes Sum of the sizes of all the slices.
+ * @param max_blocking_time_point Future timepoint where blocking send should end.
+ */
+bool DirectMessageSender::send(
+        const std::vector<NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        std::chrono::steady_clock::time_point max_blocking_time_point) const
+{
+    return participant_->sendSync(buffers, total_bytes, participant_->getGuid(),
+                   Locators(locators_->begin()), Locators(locators_->end()), max_blocking_time_point);
+}
+
 } /* namespace rtps */
 } /* namespace fastrtps */
 } /* namespace eprosima */
@@ -599,7 +599,7 @@ bool PDP::removeReaderProxyData(
             if (rit != pit->m_readers->end())
             {
                 ReaderProxyData* pR = rit->second;
-                mp_EDP->unpairReaderProxy(pit->m_guid, reader_guid);
+                mp_EDP->unpairReaderProxy(pit->m_guid, reader_guid, pR->topicName().to_string());
 
                 RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
                 if (listener)
@@ -636,7 +636,7 @@ bool PDP::removeWriterProxyData(
             if (wit != pit->m_writers->end())
             {
                 WriterProxyData* pW = wit->second;
-                mp_EDP->unpairWriterProxy(pit->m_guid, writer_guid, false);
+                mp_EDP->unpairWriterProxy(pit->m_guid, writer_guid, pW->topicName().to_string(), false);
 
                 RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
                 if (listener)
@@ -920,7 +920,7 @@ bool PDP::remove_remote_participant(
                 GUID_t reader_guid(rit->guid());
                 if (reader_guid != c_Guid_Unknown)
                 {
-                    mp_EDP->unpairReaderProxy(partGUID, reader_guid);
+                    mp_EDP->unpairReaderProxy(partGUID, reader_guid, rit->topicName().to_string());
 
                     if (listener)
                     {
@@ -936,7 +936,7 @@ bool PDP::remove_remote_participant(
                 GUID_t writer_guid(wit->guid());
                 if (writer_guid != c_Guid_Unknown)
                 {
-                    mp_EDP->unpairWriterProxy(partGUID, writer_guid,
+                    mp_EDP->unpairWriterProxy(partGUID, writer_guid, wit->topicName().to_string(),
                             reason == ParticipantDiscoveryInfo::DISCOVERY_STATUS::DROPPED_PARTICIPANT);
 
                     if (listener)
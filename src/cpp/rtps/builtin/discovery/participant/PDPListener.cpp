@@ -21,6 +21,7 @@
 
 #include <fastdds/dds/log/Log.hpp>
 
+#include <fastdds/rtps/attributes/PropertyPolicy.h>
 #include <fastdds/rtps/builtin/discovery/endpoint/EDP.h>
 #include <fastdds/rtps/builtin/discovery/participant/PDP.h>
 #include <fastdds/rtps/history/ReaderHistory.h>
@@ -42,10 +43,25 @@ namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
+/*
+ * Participant property:
+ * - fastdds.discovery.skip_unchanged_announcements: "false" to parse every announcement of a known participant, even
+ *   when it is identical to the last one received from it.
+ */
+static bool should_skip_unchanged_announcements(
+        const RTPSParticipantAttributes& att)
+{
+    const std::string* property = PropertyPolicyHelper::find_property(att.properties,
+                    "fastdds.discovery.skip_unchanged_announcements");
+    return nullptr == property || "false" != *property;
+}
+
 PDPListener::PDPListener(
         PDP* parent)
     : parent_pdp_(parent)
     , temp_participant_data_(parent->getRTPSParticipant()->getRTPSParticipantAttributes().allocation)
+    , skip_unchanged_announcements_(should_skip_unchanged_announcements(
+                parent->getRTPSParticipant()->getRTPSParticipantAttributes()))
 {
 }
 
@@ -95,6 +111,24 @@ void PDPListener::onNewCacheChangeAdded(
             return;
         }
 
+        // Periodic announcements of a known participant are usually identical to the last one received from it.
+        // There is nothing to update in that case, and its liveliness was asserted on reception of the message.
+        if (skip_unchanged_announcements_)
+        {
+            for (ParticipantProxyData* it : parent_pdp_->participant_proxies_)
+            {
+                if (guid == it->m_guid)
+                {
+                    if (it->is_same_announcement(change->serializedPayload))
+                    {
+                        parent_pdp_->mp_PDPReaderHistory->remove_change(change);
+                        return;
+                    }
+                    break;
+                }
+            }
+        }
+
         // Access to temp_participant_data_ is protected by reader lock
 
         // Load information on temp_participant_data_
@@ -125,6 +159,10 @@ void PDPListener::onNewCacheChangeAdded(
             {
                 // Create a new one when not found
                 pdata = parent_pdp_->createParticipantProxyData(temp_participant_data_, writer_guid);
+                if (pdata != nullptr && skip_unchanged_announcements_)
+                {
+                    pdata->store_announcement(change->serializedPayload);
+                }
 
                 reader->getMutex().unlock();
                 lock.unlock();
@@ -153,6 +191,10 @@ void PDPListener::onNewCacheChangeAdded(
             {
                 pdata->updateData(temp_participant_data_);
                 pdata->isAlive = true;
+                if (skip_unchanged_announcements_)
+                {
+                    pdata->store_announcement(change->serializedPayload);
+                }
                 reader->getMutex().unlock();
 
                 logInfo(RTPS_PDP_DISCOVERY, "Update participant "
@@ -676,6 +676,10 @@ bool WLP::add_local_writer(
         {
             logError(RTPS_LIVELINESS, "Could not add writer " << W->getGuid() << " to liveliness manager");
         }
+        W->liveliness_data_ = pub_liveliness_manager_->get_writer(
+            W->getGuid(),
+            wqos.m_liveliness.kind,
+            wqos.m_liveliness.lease_duration);
     }
     else if (wqos.m_liveliness.kind == MANUAL_BY_TOPIC_LIVELINESS_QOS)
     {
@@ -688,6 +692,10 @@ bool WLP::add_local_writer(
         {
             logError(RTPS_LIVELINESS, "Could not add writer " << W->getGuid() << " to liveliness manager");
         }
+        W->liveliness_data_ = pub_liveliness_manager_->get_writer(
+            W->getGuid(),
+            wqos.m_liveliness.kind,
+            wqos.m_liveliness.lease_duration);
     }
 
     return true;
@@ -749,6 +757,7 @@ bool WLP::remove_local_writer(
         }
 
         manual_by_participant_writers_.erase(it);
+        W->liveliness_data_ = nullptr;
 
         if (!pub_liveliness_manager_->remove_writer(
                     W->getGuid(),
@@ -791,6 +800,7 @@ bool WLP::remove_local_writer(
         }
 
         manual_by_topic_writers_.erase(it);
+        W->liveliness_data_ = nullptr;
 
         if (!pub_liveliness_manager_->remove_writer(
                     W->getGuid(),
@@ -954,6 +964,12 @@ bool WLP::assert_liveliness(
         lease_duration);
 }
 
+bool WLP::assert_liveliness(
+        LivelinessData* writer)
+{
+    return pub_liveliness_manager_->assert_liveliness(writer);
+}
+
 bool WLP::assert_liveliness_manual_by_participant()
 {
     if (manual_by_participant_writers_.size() > 0)
@@ -1,5 +1,6 @@
 #include "FlowControllerFactory.hpp"
 #include "FlowControllerImpl.hpp"
+#include "FlowControllerShards.hpp"
 
 #include <fastdds/dds/log/Log.hpp>
 
@@ -11,8 +12,64 @@ const char* const pure_sync_flow_controller_name = "PureSyncFlowController";
 const char* const sync_flow_controller_name = "SyncFlowController";
 const char* const async_flow_controller_name = "AsyncFlowController";
 
+/*!
+ * Create a flow controller with the given publish mode and the scheduler selected on its descriptor.
+ */
+template<typename PublishMode>
+static FlowController* create_flow_controller(
+        fastrtps::rtps::RTPSParticipantImpl* participant,
+        const FlowControllerDescriptor& flow_controller_descr)
+{
+    switch (flow_controller_descr.scheduler)
+    {
+        case FlowControllerSchedulerPolicy::FIFO:
+            return new FlowControllerImpl<PublishMode, FlowControllerFifoSchedule>(participant,
+                           &flow_controller_descr);
+        case FlowControllerSchedulerPolicy::ROUND_ROBIN:
+            return new FlowControllerImpl<PublishMode, FlowControllerRoundRobinSchedule>(participant,
+                           &flow_controller_descr);
+        case FlowControllerSchedulerPolicy::HIGH_PRIORITY:
+            return new FlowControllerImpl<PublishMode, FlowControllerHighPrioritySchedule>(participant,
+                           &flow_controller_descr);
+        case FlowControllerSchedulerPolicy::PRIORITY_WITH_RESERVATION:
+            return new FlowControllerImpl<PublishMode, FlowControllerPriorityWithReservationSchedule>(participant,
+                           &flow_controller_descr);
+        case FlowControllerSchedulerPolicy::EARLIEST_DEADLINE_FIRST:
+            return new FlowControllerImpl<PublishMode, FlowControllerEarliestDeadlineFirstSchedule>(participant,
+                           &flow_controller_descr);
+        default:
+            assert(false);
+    }
+
+    return nullptr;
+}
+
+/*!
+ * Create an asynchronous flow controller without bandwidth limitation, which uses the given number of threads.
+ */
+static FlowController* create_async_flow_controller(
+        fastrtps::rtps::RTPSParticipantImpl* participant,
+        const FlowControllerDescriptor& flow_controller_descr,
+        uint32_t sender_threads)
+{
+    if (1 >= sender_threads)
+    {
+        return create_flow_controller<FlowControllerAsyncPublishMode>(participant, flow_controller_descr);
+    }
+
+    std::vector<std::unique_ptr<FlowController>> shards;
+    for (uint32_t i = 0; i < sender_threads; ++i)
+    {
+        shards.emplace_back(create_flow_controller<FlowControllerAsyncPublishMode>(participant,
+                flow_controller_descr));
+    }
+
+    return new FlowControllerShards(std::move(shards));
+}
+
 void FlowControllerFactory::init(
-        fastrtps::rtps::RTPSParticipantImpl* participant)
+        fastrtps::rtps::RTPSParticipantImpl* participant,
+        uint32_t async_sender_threads)
 {
     participant_ = participant;
     // Create default flow controllers.
@@ -28,10 +85,10 @@ void FlowControllerFactory::init(
                                   new FlowControllerImpl<FlowControllerSyncPublishMode,
                                   FlowControllerFifoSchedule>(participant_, nullptr))});
     // AsyncFlowController
+    FlowControllerDescriptor async_descr;
     flow_controllers_.insert({async_flow_controller_name,
                               std::unique_ptr<FlowController>(
-                                  new FlowControllerImpl<FlowControllerAsyncPublishMode,
-                                  FlowControllerFifoSchedule>(participant_, nullptr))});
+                                  create_async_flow_controller(participant_, async_descr, async_sender_threads))});
 }
 
 void FlowControllerFactory::register_flow_controller (
@@ -44,75 +101,33 @@ void FlowControllerFactory::register_flow_controller (
         return;
     }
 
-    if (0 < flow_controller_descr.max_bytes_per_period)
+    if (1 < flow_controller_descr.sender_threads && 0 < flow_controller_descr.max_bytes_per_period)
     {
-        switch (flow_controller_descr.scheduler)
-        {
-            case FlowControllerSchedulerPolicy::FIFO:
-                flow_controllers_.insert({flow_controller_descr.name,
-                                          std::unique_ptr<FlowController>(
-                                              new FlowControllerImpl<FlowControllerLimitedAsyncPublishMode,
-                                              FlowControllerFifoSchedule>(participant_, &flow_controller_descr))});
-                break;
-            case FlowControllerSchedulerPolicy::ROUND_ROBIN:
-                flow_controllers_.insert({flow_controller_descr.name,
-                                          std::unique_ptr<FlowController>(
-                                              new FlowControllerImpl<FlowControllerLimitedAsyncPublishMode,
-                                              FlowControllerRoundRobinSchedule>(participant_,
-                                              &flow_controller_descr))});
-                break;
-            case FlowControllerSchedulerPolicy::HIGH_PRIORITY:
-                flow_controllers_.insert({flow_controller_descr.name,
-                                          std::unique_ptr<FlowController>(
-                                              new FlowControllerImpl<FlowControllerLimitedAsyncPublishMode,
-                                              FlowControllerHighPrioritySchedule>(participant_,
-                                              &flow_controller_descr))});
-                break;
-            case FlowControllerSchedulerPolicy::PRIORITY_WITH_RESERVATION:
-                flow_controllers_.insert({flow_controller_descr.name,
-                                          std::unique_ptr<FlowController>(
-                                              new FlowControllerImpl<FlowControllerLimitedAsyncPublishMode,
-                                              FlowControllerPriorityWithReservationSchedule>(participant_,
-                                              &flow_controller_descr))});
-                break;
-            default:
-                assert(false);
-        }
+        logWarning(RTPS_PARTICIPANT, "FlowController " << flow_controller_descr.name <<
+                " limits its bandwidth, so it will use only one sender thread");
+    }
+
+    FlowController* flow_controller = nullptr;
+
+    if (0 < flow_controller_descr.max_bytes_per_period && 0 < flow_controller_descr.burst_bytes)
+    {
+        flow_controller = create_flow_controller<FlowControllerTokenBucketPublishMode>(participant_,
+                        flow_controller_descr);
+    }
+    else if (0 < flow_controller_descr.max_bytes_per_period)
+    {
+        flow_controller = create_flow_controller<FlowControllerLimitedAsyncPublishMode>(participant_,
+                        flow_controller_descr);
     }
     else
     {
-        switch (flow_controller_descr.scheduler)
-        {
-            case FlowControllerSchedulerPolicy::FIFO:
-                flow_controllers_.insert({flow_controller_descr.name,
-                                          std::unique_ptr<FlowController>(
-                                              new FlowControllerImpl<FlowControllerAsyncPublishMode,
-                                              FlowControllerFifoSchedule>(participant_, &flow_controller_descr))});
-                break;
-            case FlowControllerSchedulerPolicy::ROUND_ROBIN:
-                flow_controllers_.insert({flow_controller_descr.name,
-                                          std::unique_ptr<FlowController>(
-                                              new FlowControllerImpl<FlowControllerAsyncPublishMode,
-                                              FlowControllerRoundRobinSchedule>(participant_,
-                                              &flow_controller_descr))});
-                break;
-            case FlowControllerSchedulerPolicy::HIGH_PRIORITY:
-                flow_controllers_.insert({flow_controller_descr.name,
-                                          std::unique_ptr<FlowController>(
-                                              new FlowControllerImpl<FlowControllerAsyncPublishMode,
-                                              FlowControllerHighPrioritySchedule>(participant_,
-                                              &flow_controller_descr))});
-                break;
-            case FlowControllerSchedulerPolicy::PRIORITY_WITH_RESERVATION:
-                flow_controllers_.insert({flow_controller_descr.name,
-                                          std::unique_ptr<FlowController>(
-                                              new FlowControllerImpl<FlowControllerAsyncPublishMode,
-                                              FlowControllerPriorityWithReservationSchedule>(participant_,
-                                              &flow_controller_descr))});
-                break;
-            default:
-                assert(false);
-        }
+        flow_controller = create_async_flow_controller(participant_, flow_controller_descr,
+                        flow_controller_descr.sender_threads);
+    }
+
+    if (nullptr != flow_controller)
+    {
+        flow_controllers_.insert({flow_controller_descr.name, std::unique_ptr<FlowController>(flow_controller)});
     }
 }
 
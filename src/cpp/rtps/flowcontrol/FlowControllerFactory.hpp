@@ -36,9 +36,11 @@ public:
      * Call always before use it.
      *
      * @param participant Pointer to the participant owner of this object.
+     * @param async_sender_threads Number of threads used by the default asynchronous flow controller.
      */
     void init(
-            fastrtps::rtps::RTPSParticipantImpl* participant);
+            fastrtps::rtps::RTPSParticipantImpl* participant,
+            uint32_t async_sender_threads = 1);
 
     /*!
      * Registers a new flow controller.
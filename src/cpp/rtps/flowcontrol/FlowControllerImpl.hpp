@@ -2,9 +2,12 @@
 #define _RTPS_FLOWCONTROL_FLOWCONTROLLERIMPL_HPP_
 
 #include "FlowController.hpp"
+#include "LocatorTrafficShaper.hpp"
 #include <fastdds/rtps/common/Guid.h>
 #include <fastdds/rtps/writer/RTPSWriter.h>
 
+#include <algorithm>
+#include <cmath>
 #include <map>
 #include <unordered_map>
 #include <thread>
@@ -233,6 +236,16 @@ struct FlowControllerAsyncPublishMode
     {
     }
 
+    void register_writer(
+            fastrtps::rtps::RTPSWriter*)
+    {
+    }
+
+    void unregister_writer(
+            fastrtps::rtps::RTPSWriter*)
+    {
+    }
+
     std::thread thread;
 
     bool running = false;
@@ -363,6 +376,317 @@ private:
 };
 
 
+//! Token bucket used to shape the traffic of a flow controller.
+struct FlowControllerTokenBucket
+{
+    using clock = std::chrono::steady_clock;
+
+    /*!
+     * @param bytes_per_period Number of tokens added to the bucket each period.
+     * @param period Period on which bytes_per_period tokens are added.
+     * @param capacity Maximum number of tokens in the bucket. The bucket starts full.
+     */
+    FlowControllerTokenBucket(
+            int32_t bytes_per_period,
+            std::chrono::milliseconds period,
+            int32_t capacity)
+        : rate_(static_cast<double>(bytes_per_period) /
+                static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(period).count()))
+        , capacity_(static_cast<double>(capacity))
+        , tokens_(capacity_)
+        , last_refill_(clock::now())
+    {
+    }
+
+    //! Add the tokens accumulated since the last refill.
+    void refill(
+            const clock::time_point& now)
+    {
+        if (now > last_refill_)
+        {
+            auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(now - last_refill_);
+            tokens_ = (std::min)(capacity_, tokens_ + rate_ * static_cast<double>(elapsed.count()));
+            last_refill_ = now;
+        }
+    }
+
+    //! Take tokens for a message, which is accepted when there are enough tokens or the bucket is full.
+    bool consume(
+            uint32_t bytes)
+    {
+        double needed = (std::min)(static_cast<double>(bytes), capacity_);
+        if (tokens_ < needed)
+        {
+            return false;
+        }
+
+        tokens_ -= static_cast<double>(bytes);
+        return true;
+    }
+
+    //! Time to wait until the bucket has the requested number of tokens, which is limited by its capacity.
+    std::chrono::nanoseconds time_to_have(
+            double bytes) const
+    {
+        double needed = (std::min)(bytes, capacity_) - tokens_;
+        if (0 >= needed)
+        {
+            return std::chrono::nanoseconds(0);
+        }
+
+        return std::chrono::nanoseconds(static_cast<int64_t>(std::ceil(needed / rate_)));
+    }
+
+    double tokens() const
+    {
+        return tokens_;
+    }
+
+    //! Whether the bucket was already full at the given time, having not been used since then.
+    bool full_at(
+            const clock::time_point& time) const
+    {
+        if (time < last_refill_)
+        {
+            return false;
+        }
+
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(time - last_refill_);
+        return tokens_ + rate_ * static_cast<double>(elapsed.count()) >= capacity_;
+    }
+
+    void take(
+            double bytes)
+    {
+        tokens_ -= bytes;
+    }
+
+private:
+
+    //! Tokens added per nanosecond.
+    double rate_ = 0;
+
+    double capacity_ = 0;
+
+    double tokens_ = 0;
+
+    clock::time_point last_refill_;
+};
+
+/*!
+ * Sends all samples asynchronously, shaping the traffic with a token bucket.
+ * Unlike FlowControllerLimitedAsyncPublishMode, the bandwidth is replenished continuously instead of at the beginning
+ * of each period, so the output is not bursty at the period boundaries.
+ * Optionally, the traffic sent to each destination locator is also shaped with its own token bucket.
+ */
+struct FlowControllerTokenBucketPublishMode : public FlowControllerAsyncPublishMode,
+    public LocatorTrafficShaper
+{
+    FlowControllerTokenBucketPublishMode(
+            fastrtps::rtps::RTPSParticipantImpl* participant,
+            const FlowControllerDescriptor* descriptor)
+        : FlowControllerAsyncPublishMode(participant, descriptor)
+        , period_ms(descriptor->period_ms)
+        , bucket_(descriptor->max_bytes_per_period, period_ms, descriptor->burst_bytes)
+    {
+        assert(nullptr != descriptor);
+        assert(0 < descriptor->max_bytes_per_period);
+        assert(0 < descriptor->burst_bytes);
+
+        // Nothing bigger than the bucket can be sent at once.
+        max_bytes_per_period = descriptor->burst_bytes;
+        group.set_sent_bytes_limitation(static_cast<uint32_t>(max_bytes_per_period));
+
+        if (0 < descriptor->max_bytes_per_period_per_locator)
+        {
+            max_bytes_per_period_per_locator_ = descriptor->max_bytes_per_period_per_locator;
+            burst_bytes_per_locator_ = 0 < descriptor->burst_bytes_per_locator ?
+                    descriptor->burst_bytes_per_locator : descriptor->max_bytes_per_period_per_locator;
+        }
+    }
+
+    void register_writer(
+            fastrtps::rtps::RTPSWriter* writer)
+    {
+        if (0 < max_bytes_per_period_per_locator_)
+        {
+            writer->traffic_shaper(this);
+        }
+    }
+
+    void unregister_writer(
+            fastrtps::rtps::RTPSWriter* writer)
+    {
+        if (this == writer->traffic_shaper_)
+        {
+            writer->traffic_shaper(nullptr);
+        }
+    }
+
+    bool fast_check_is_there_slot_for_change(
+            fastrtps::rtps::CacheChange_t* change)
+    {
+        // Not fragmented sample, the fast check is if the serialized payload fit.
+        uint32_t size_to_check = change->serializedPayload.length;
+
+        if (0 != change->getFragmentCount())
+        {
+            // For fragmented sample, the fast check is the minor fragments fit.
+            size_to_check = change->serializedPayload.length % change->getFragmentSize();
+
+            if (0 == size_to_check)
+            {
+                size_to_check = change->getFragmentSize();
+            }
+        }
+
+        pending_bytes_ = size_to_check;
+        bool ret = (bucket_.tokens() - static_cast<double>(group.get_current_bytes_processed())) > size_to_check;
+
+        if (!ret)
+        {
+            force_wait_ = true;
+        }
+
+        return ret;
+    }
+
+    /*!
+     * Wait until there is a new change added (notified by other thread) or, when the bucket ran out of tokens, until
+     * it has enough tokens for the pending change.
+     *
+     * @return true when a period has elapsed since the last time true was returned, so the bandwidth reservations of
+     * the scheduler can be reset.
+     */
+    bool wait(
+            std::unique_lock<std::mutex>& lock)
+    {
+        // Take the tokens of what was sent since the last wait.
+        bucket_.take(static_cast<double>(group.get_current_bytes_processed()) - discarded_bytes_);
+        discarded_bytes_ = 0;
+        group.reset_current_bytes_processed();
+        bucket_.refill(std::chrono::steady_clock::now());
+
+        if (force_wait_)
+        {
+            std::chrono::nanoseconds lapse = bucket_.time_to_have(static_cast<double>(pending_bytes_) + 1);
+            if (std::chrono::nanoseconds(0) < lapse)
+            {
+                cv.wait_for(lock, lapse);
+            }
+        }
+        else
+        {
+            cv.wait(lock);
+        }
+
+        auto now = std::chrono::steady_clock::now();
+        bucket_.refill(now);
+        if (bucket_.tokens() > pending_bytes_)
+        {
+            force_wait_ = false;
+        }
+        group.set_sent_bytes_limitation(static_cast<uint32_t>((std::max)(1.0, bucket_.tokens())));
+
+        bool reset_limit = false;
+        if (now - last_period_ >= period_ms)
+        {
+            last_period_ = now;
+            reset_limit = true;
+            remove_idle_locator_buckets(now);
+        }
+
+        return reset_limit;
+    }
+
+    bool force_wait() const
+    {
+        return force_wait_;
+    }
+
+    void process_deliver_retcode(
+            const fastrtps::rtps::DeliveryRetCode& ret_value)
+    {
+        if (fastrtps::rtps::DeliveryRetCode::EXCEEDED_LIMIT == ret_value)
+        {
+            force_wait_ = true;
+        }
+    }
+
+    bool consume(
+            const fastrtps::rtps::Locator_t& locator,
+            uint32_t bytes) override
+    {
+        // Called by the asynchronous thread while delivering a sample, so no protection is needed.
+        auto it = locator_buckets_.find(locator);
+        if (locator_buckets_.end() == it)
+        {
+            it = locator_buckets_.emplace(locator, FlowControllerTokenBucket(max_bytes_per_period_per_locator_,
+                            period_ms, burst_bytes_per_locator_)).first;
+        }
+
+        it->second.refill(std::chrono::steady_clock::now());
+        return it->second.consume(bytes);
+    }
+
+    void discarded(
+            uint32_t bytes) override
+    {
+        // The message was not sent, so its tokens are given back.
+        discarded_bytes_ += static_cast<double>(bytes);
+    }
+
+    //! Number of locators with their own bucket.
+    size_t shaped_locators() const
+    {
+        return locator_buckets_.size();
+    }
+
+    int32_t max_bytes_per_period = 0;
+
+    std::chrono::milliseconds period_ms;
+
+private:
+
+    /*!
+     * Remove the buckets of the locators that have been idle for more than a period.
+     * Their buckets are full, which is also how a new bucket starts, so the shaping is not affected.
+     */
+    void remove_idle_locator_buckets(
+            const std::chrono::steady_clock::time_point& now)
+    {
+        auto idle_since = now - period_ms;
+        for (auto it = locator_buckets_.begin(); it != locator_buckets_.end();)
+        {
+            if (it->second.full_at(idle_since))
+            {
+                it = locator_buckets_.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+
+    FlowControllerTokenBucket bucket_;
+
+    bool force_wait_ = false;
+
+    uint32_t pending_bytes_ = 0;
+
+    double discarded_bytes_ = 0;
+
+    int32_t max_bytes_per_period_per_locator_ = 0;
+
+    int32_t burst_bytes_per_locator_ = 0;
+
+    std::map<fastrtps::rtps::Locator_t, FlowControllerTokenBucket> locator_buckets_;
+
+    std::chrono::steady_clock::time_point last_period_ = std::chrono::steady_clock::now();
+};
+
+
 /** Classes used to specify FlowController's sample scheduling **/
 
 //! Fifo scheduling
@@ -911,6 +1235,148 @@ private:
     uint32_t size_being_processed_ = 0;
 };
 
+//! Earliest deadline first scheduling
+struct FlowControllerEarliestDeadlineFirstSchedule
+{
+    using element = std::tuple<fastrtps::rtps::RTPSWriter*, FlowQueue, int64_t>;
+    using container = std::vector<element>;
+    using iterator = container::iterator;
+
+    void register_writer(
+            fastrtps::rtps::RTPSWriter* writer)
+    {
+        assert(nullptr != writer);
+        int64_t latency_budget = no_latency_budget;
+        auto property = fastrtps::rtps::PropertyPolicyHelper::find_property(
+            writer->getAttributes().properties, "fastdds.sfc.latency_budget_us");
+
+        if (nullptr != property)
+        {
+            char* ptr = nullptr;
+            unsigned long long value = strtoull(property->c_str(), &ptr, 10);
+
+            if (property->c_str() != ptr && max_latency_budget_us >= value)     // A valid integer was read.
+            {
+                latency_budget = static_cast<int64_t>(value) * 1000;
+            }
+            else
+            {
+                logError(RTPS_WRITER,
+                        "Wrong value for fastdds.sfc.latency_budget_us property. Samples scheduled after the ones with a latency budget");
+            }
+        }
+
+        assert(writers_queue_.end() == find(writer));
+        writers_queue_.emplace_back(writer, FlowQueue(), latency_budget);
+    }
+
+    void unregister_writer(
+            fastrtps::rtps::RTPSWriter* writer)
+    {
+        auto it = find(writer);
+        assert(it != writers_queue_.end());
+        assert(std::get<1>(*it).is_empty());
+        writers_queue_.erase(it);
+    }
+
+    void work_done() const
+    {
+        // Do nothing
+    }
+
+    void add_new_sample(
+            fastrtps::rtps::RTPSWriter* writer,
+            fastrtps::rtps::CacheChange_t* change)
+    {
+        auto it = find(writer);
+        assert(it != writers_queue_.end());
+        std::get<1>(*it).add_new_sample(change);
+    }
+
+    void add_old_sample(
+            fastrtps::rtps::RTPSWriter* writer,
+            fastrtps::rtps::CacheChange_t* change)
+    {
+        auto it = find(writer);
+        assert(it != writers_queue_.end());
+        std::get<1>(*it).add_old_sample(change);
+    }
+
+    /*!
+     * Returns the first sample of the writer whose first sample has the earliest deadline.
+     * The deadline of a sample is its source timestamp plus the latency budget of its writer.
+     * Samples of writers without latency budget are sent after the rest, in order of source timestamp.
+     *
+     * @return Pointer to next change to be sent. nullptr implies there is no sample to be sent.
+     */
+    fastrtps::rtps::CacheChange_t* get_next_change_nts()
+    {
+        fastrtps::rtps::CacheChange_t* ret_change = nullptr;
+        int64_t ret_deadline = 0;
+        int64_t ret_timestamp = 0;
+
+        for (auto& queue : writers_queue_)
+        {
+            fastrtps::rtps::CacheChange_t* change = std::get<1>(queue).get_next_change();
+
+            if (nullptr != change)
+            {
+                int64_t timestamp = change->sourceTimestamp.to_ns();
+                int64_t latency_budget = std::get<2>(queue);
+                int64_t deadline = no_latency_budget == latency_budget ?
+                        std::numeric_limits<int64_t>::max() : timestamp + latency_budget;
+
+                if (nullptr == ret_change || deadline < ret_deadline ||
+                        (deadline == ret_deadline && timestamp < ret_timestamp))
+                {
+                    ret_change = change;
+                    ret_deadline = deadline;
+                    ret_timestamp = timestamp;
+                }
+            }
+        }
+
+        return ret_change;
+    }
+
+    void add_interested_changes_to_queue_nts()
+    {
+        // This function should be called with mutex_  and interested_lock locked, because the queue is changed.
+        for (auto& queue : writers_queue_)
+        {
+            std::get<1>(queue).add_interested_changes_to_queue();
+        }
+    }
+
+    void set_bandwith_limitation(
+            uint32_t) const
+    {
+    }
+
+    void trigger_bandwidth_limit_reset() const
+    {
+    }
+
+private:
+
+    static constexpr int64_t no_latency_budget = -1;
+
+    //! One day, which keeps deadlines far from overflowing.
+    static constexpr unsigned long long max_latency_budget_us = 86400000000ull;
+
+    iterator find(
+            const fastrtps::rtps::RTPSWriter* writer)
+    {
+        return std::find_if(writers_queue_.begin(), writers_queue_.end(),
+                       [writer](const element& current_writer) -> bool
+                       {
+                           return writer == std::get<0>(current_writer);
+                       });
+    }
+
+    container writers_queue_;
+};
+
 template<typename PublishMode, typename SampleScheduling>
 class FlowControllerImpl : public FlowController
 {
@@ -1062,6 +1528,7 @@ private:
     {
         std::unique_lock<std::mutex> in_lock(async_mode.changes_interested_mutex);
         sched.register_writer(writer);
+        async_mode.register_writer(writer);
     }
 
     template<typename PubMode = PublishMode>
@@ -1079,6 +1546,7 @@ private:
     {
         std::unique_lock<std::mutex> in_lock(async_mode.changes_interested_mutex);
         sched.unregister_writer(writer);
+        async_mode.unregister_writer(writer);
     }
 
     template<typename PubMode = PublishMode>
@@ -1349,11 +1817,14 @@ private:
 
                     async_mode.process_deliver_retcode(ret_delivery);
 
+                    // The group cannot keep references to the writer's payloads once it is unlocked.
+                    async_mode.group.flush_referenced_payloads();
                     current_writer->getMutex().unlock();
                     // Unlock mutex_ and try again.
                     break;
                 }
 
+                async_mode.group.flush_referenced_payloads();
                 current_writer->getMutex().unlock();
 
                 sched.work_done();
@@ -1378,14 +1849,16 @@ private:
     }
 
     template<typename PubMode = PublishMode>
-    typename std::enable_if<std::is_base_of<FlowControllerLimitedAsyncPublishMode, PubMode>::value, uint32_t>::type
+    typename std::enable_if<std::is_base_of<FlowControllerLimitedAsyncPublishMode, PubMode>::value ||
+            std::is_base_of<FlowControllerTokenBucketPublishMode, PubMode>::value, uint32_t>::type
     get_max_payload_impl()
     {
         return static_cast<uint32_t>(async_mode.max_bytes_per_period);
     }
 
     template<typename PubMode = PublishMode>
-    typename std::enable_if<!std::is_base_of<FlowControllerLimitedAsyncPublishMode, PubMode>::value, uint32_t>::type
+    typename std::enable_if<!std::is_base_of<FlowControllerLimitedAsyncPublishMode, PubMode>::value &&
+            !std::is_base_of<FlowControllerTokenBucketPublishMode, PubMode>::value, uint32_t>::type
     constexpr get_max_payload_impl() const
     {
         return std::numeric_limits<uint32_t>::max();
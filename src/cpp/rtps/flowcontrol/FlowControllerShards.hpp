@@ -0,0 +1,172 @@
+#ifndef _RTPS_FLOWCONTROL_FLOWCONTROLLERSHARDS_HPP_
+#define _RTPS_FLOWCONTROL_FLOWCONTROLLERSHARDS_HPP_
+
+#include "FlowController.hpp"
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/writer/RTPSWriter.h>
+
+#include <cassert>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/*!
+ * Flow controller which distributes its writers among several flow controllers, each one with its own sending thread.
+ *
+ * Each writer is assigned to the flow controller with less writers when it is registered, so all the samples of a
+ * writer are sent in order by the same thread.
+ * The scheduling policy of each flow controller applies among the writers assigned to it.
+ */
+class FlowControllerShards : public FlowController
+{
+public:
+
+    FlowControllerShards(
+            std::vector<std::unique_ptr<FlowController>>&& shards)
+        : shards_(std::move(shards))
+        , writers_per_shard_(shards_.size(), 0)
+    {
+        assert(!shards_.empty());
+    }
+
+    virtual ~FlowControllerShards() noexcept
+    {
+    }
+
+    /*!
+     * Initializes the flow controllers.
+     */
+    void init() override
+    {
+        for (auto& shard : shards_)
+        {
+            shard->init();
+        }
+    }
+
+    /*!
+     * Registers a writer on the flow controller with less writers.
+     *
+     * @param writer Pointer to the writer to be registered. Cannot be nullptr.
+     */
+    void register_writer(
+            fastrtps::rtps::RTPSWriter* writer) override
+    {
+        FlowController* shard = nullptr;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            size_t index = 0;
+            for (size_t i = 1; i < writers_per_shard_.size(); ++i)
+            {
+                if (writers_per_shard_[i] < writers_per_shard_[index])
+                {
+                    index = i;
+                }
+            }
+
+            auto ret = assignments_.insert({writer->getGuid().entityId, index});
+            (void)ret;
+            assert(ret.second);
+            ++writers_per_shard_[index];
+            shard = shards_[index].get();
+        }
+
+        shard->register_writer(writer);
+    }
+
+    /*!
+     * Unregister a writer.
+     *
+     * @param writer Pointer to the writer to be unregistered. Cannot be nullptr.
+     */
+    void unregister_writer(
+            fastrtps::rtps::RTPSWriter* writer) override
+    {
+        FlowController* shard = nullptr;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = assignments_.find(writer->getGuid().entityId);
+            if (assignments_.end() == it)
+            {
+                return;
+            }
+
+            --writers_per_shard_[it->second];
+            shard = shards_[it->second].get();
+            assignments_.erase(it);
+        }
+
+        shard->unregister_writer(writer);
+    }
+
+    bool add_new_sample(
+            fastrtps::rtps::RTPSWriter* writer,
+            fastrtps::rtps::CacheChange_t* change,
+            const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time) override
+    {
+        FlowController* shard = shard_of(writer->getGuid().entityId);
+        return nullptr != shard && shard->add_new_sample(writer, change, max_blocking_time);
+    }
+
+    bool add_old_sample(
+            fastrtps::rtps::RTPSWriter* writer,
+            fastrtps::rtps::CacheChange_t* change) override
+    {
+        FlowController* shard = shard_of(writer->getGuid().entityId);
+        return nullptr != shard && shard->add_old_sample(writer, change);
+    }
+
+    void remove_change(
+            fastrtps::rtps::CacheChange_t* change) override
+    {
+        FlowController* shard = shard_of(change->writerGUID.entityId);
+        if (nullptr != shard)
+        {
+            shard->remove_change(change);
+        }
+    }
+
+    uint32_t get_max_payload() override
+    {
+        return shards_.front()->get_max_payload();
+    }
+
+    //! Number of flow controllers among which the writers are distributed.
+    size_t number_of_shards() const
+    {
+        return shards_.size();
+    }
+
+private:
+
+    FlowController* shard_of(
+            const fastrtps::rtps::EntityId_t& writer_id)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = assignments_.find(writer_id);
+        return assignments_.end() != it ? shards_[it->second].get() : nullptr;
+    }
+
+    std::vector<std::unique_ptr<FlowController>> shards_;
+
+    //! Protects the assignment of writers to flow controllers.
+    std::mutex mutex_;
+
+    std::unordered_map<fastrtps::rtps::EntityId_t, size_t> assignments_;
+
+    std::vector<size_t> writers_per_shard_;
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _RTPS_FLOWCONTROL_FLOWCONTROLLERSHARDS_HPP_
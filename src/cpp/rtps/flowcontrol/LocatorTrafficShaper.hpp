@@ -0,0 +1,48 @@
+#ifndef _RTPS_FLOWCONTROL_LOCATORTRAFFICSHAPER_HPP_
+#define _RTPS_FLOWCONTROL_LOCATORTRAFFICSHAPER_HPP_
+
+#include <fastdds/rtps/common/Locator.h>
+
+#include <cstdint>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/*!
+ * Interface used to limit the traffic a writer sends to each destination locator.
+ */
+class LocatorTrafficShaper
+{
+public:
+
+    /*!
+     * Check whether a message can be sent to a locator, accounting it when it can.
+     *
+     * @param locator Destination locator.
+     * @param bytes Size of the message.
+     * @return true when the message can be sent to the locator.
+     */
+    virtual bool consume(
+            const fastrtps::rtps::Locator_t& locator,
+            uint32_t bytes) = 0;
+
+    /*!
+     * Inform that a message was not sent to any of its destination locators.
+     *
+     * @param bytes Size of the message.
+     */
+    virtual void discarded(
+            uint32_t bytes) = 0;
+
+protected:
+
+    // Shapers are not owned through this interface.
+    ~LocatorTrafficShaper() = default;
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _RTPS_FLOWCONTROL_LOCATORTRAFFICSHAPER_HPP_
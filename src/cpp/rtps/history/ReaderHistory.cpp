@@ -24,6 +24,7 @@
 #include <fastdds/rtps/reader/RTPSReader.h>
 #include <fastdds/rtps/reader/ReaderListener.h>
 
+#include <algorithm>
 #include <mutex>
 
 namespace eprosima {
@@ -73,6 +74,7 @@ bool ReaderHistory::add_change(
 
     auto it = get_first_change_with_minimum_ts(a_change->sourceTimestamp);
     m_changes.insert(it, a_change);
+    changes_index_.emplace(std::make_pair(a_change->writerGUID, a_change->sequenceNumber), a_change);
 
     logInfo(RTPS_READER_HISTORY,
             "Change " << a_change->sequenceNumber << " added with " << a_change->serializedPayload.length << " bytes");
@@ -95,6 +97,58 @@ bool ReaderHistory::matches_change(
            inner_change->writerGUID == outer_change->writerGUID;
 }
 
+History::const_iterator ReaderHistory::find_change_nts(
+        CacheChange_t* ch)
+{
+    if (nullptr == mp_reader || nullptr == mp_mutex)
+    {
+        logError(RTPS_READER_HISTORY, "You need to create a Reader with this History before using it");
+        return const_iterator();
+    }
+
+    if (nullptr == ch)
+    {
+        logError(RTPS_READER_HISTORY, "Pointer is not valid");
+        return changesEnd();
+    }
+
+    auto index_it = changes_index_.find(std::make_pair(ch->writerGUID, ch->sequenceNumber));
+    if (index_it == changes_index_.end())
+    {
+        return changesEnd();
+    }
+
+    // Changes are kept ordered by source timestamp, so the stored change is among those sharing its timestamp.
+    CacheChange_t* stored = index_it->second;
+    auto range = std::equal_range(m_changes.cbegin(), m_changes.cend(), stored,
+                    [](const CacheChange_t* c1, const CacheChange_t* c2)
+                    {
+                        return c1->sourceTimestamp < c2->sourceTimestamp;
+                    });
+
+    const_iterator it = std::find(range.first, range.second, stored);
+    return it != range.second ? it : changesEnd();
+}
+
+bool ReaderHistory::remove_change(
+        CacheChange_t* ch)
+{
+    std::lock_guard<RecursiveTimedMutex> guard(*mp_mutex);
+
+    const_iterator it = find_change_nts(ch);
+
+    if (it == changesEnd())
+    {
+        logInfo(RTPS_READER_HISTORY, "Trying to remove a change not in history");
+        return false;
+    }
+
+    // remove using the virtual method
+    remove_change_nts(it);
+
+    return true;
+}
+
 History::iterator ReaderHistory::remove_change_nts(
         const_iterator removal,
         bool release)
@@ -112,6 +166,7 @@ History::iterator ReaderHistory::remove_change_nts(
     }
 
     CacheChange_t* change = *removal;
+    remove_from_index(change);
     auto ret_val = m_changes.erase(removal);
     m_isHistoryFull = false;
 
@@ -170,29 +225,36 @@ bool ReaderHistory::remove_fragmented_changes_until(
     }
 
     std::lock_guard<RecursiveTimedMutex> guard(*mp_mutex);
+    // Compact the kept changes in a single pass instead of erasing them one by one
+    std::vector<CacheChange_t*>::iterator new_end = m_changes.begin();
     std::vector<CacheChange_t*>::iterator chit = m_changes.begin();
-    while (chit != m_changes.end())
+    for (; chit != m_changes.end(); ++chit)
     {
         CacheChange_t* item = *chit;
         if (item->writerGUID == writer_guid)
         {
-            if (item->sequenceNumber < seq_num)
+            if (!(item->sequenceNumber < seq_num))
             {
-                if (item->is_fully_assembled() == false)
-                {
-                    logInfo(RTPS_READER_HISTORY, "Removing change " << item->sequenceNumber);
-                    mp_reader->change_removed_by_history(item);
-                    mp_reader->releaseCache(item);
-                    chit = m_changes.erase(chit);
-                    continue;
-                }
+                break;
             }
-            else
+
+            if (item->is_fully_assembled() == false)
             {
-                break;
+                logInfo(RTPS_READER_HISTORY, "Removing change " << item->sequenceNumber);
+                remove_from_index(item);
+                mp_reader->change_removed_by_history(item);
+                mp_reader->releaseCache(item);
+                continue;
             }
         }
-        ++chit;
+        *new_end++ = item;
+    }
+
+    if (new_end != chit)
+    {
+        new_end = std::move(chit, m_changes.end(), new_end);
+        m_changes.erase(new_end, m_changes.end());
+        m_isHistoryFull = false;
     }
 
     return true;
@@ -247,6 +309,16 @@ History::iterator ReaderHistory::get_first_change_with_minimum_ts(
     return m_changes.end();
 }
 
+void ReaderHistory::remove_from_index(
+        const CacheChange_t* change)
+{
+    auto it = changes_index_.find(std::make_pair(change->writerGUID, change->sequenceNumber));
+    if (it != changes_index_.end() && it->second == change)
+    {
+        changes_index_.erase(it);
+    }
+}
+
 } /* namespace rtps */
 } /* namespace fastrtps */
 } /* namespace eprosima */
@@ -23,6 +23,7 @@
 #include <fastdds/rtps/common/WriteParams.h>
 #include <fastdds/core/policy//ParameterSerializer.hpp>
 
+#include <algorithm>
 #include <mutex>
 
 namespace eprosima {
@@ -141,6 +142,36 @@ bool WriterHistory::matches_change(
     return inner_change->sequenceNumber == outer_change->sequenceNumber;
 }
 
+History::const_iterator WriterHistory::find_change_nts(
+        CacheChange_t* ch)
+{
+    if (nullptr == mp_writer || nullptr == mp_mutex)
+    {
+        logError(RTPS_WRITER_HISTORY, "You need to create a Writer with this History before using it");
+        return const_iterator();
+    }
+
+    if (nullptr == ch)
+    {
+        logError(RTPS_WRITER_HISTORY, "Pointer is not valid");
+        return changesEnd();
+    }
+
+    // Changes are always appended with increasing sequence numbers
+    const_iterator it = std::lower_bound(m_changes.cbegin(), m_changes.cend(), ch->sequenceNumber,
+                    [](const CacheChange_t* c, const SequenceNumber_t& seq)
+                    {
+                        return c->sequenceNumber < seq;
+                    });
+
+    if (it != m_changes.cend() && matches_change(*it, ch))
+    {
+        return it;
+    }
+
+    return changesEnd();
+}
+
 History::iterator WriterHistory::remove_change_nts(
         const_iterator removal,
         bool release)
@@ -208,7 +239,8 @@ CacheChange_t* WriterHistory::remove_change_and_reuse(
     ch.sequenceNumber = sequence_number;
     ch.writerGUID = mp_writer->getGuid();
 
-    auto it = find_change(&ch);
+    std::lock_guard<RecursiveTimedMutex> guard(*mp_mutex);
+    auto it = find_change_nts(&ch);
 
     if ( it == changesEnd())
     {
@@ -200,6 +200,7 @@ RTPSMessageGroup::~RTPSMessageGroup() noexcept(false)
     }
     catch (...)
     {
+        release_referenced_payloads();
         if (!internal_buffer_)
         {
             participant_->return_send_buffer(std::move(send_buffer_));
@@ -207,6 +208,7 @@ RTPSMessageGroup::~RTPSMessageGroup() noexcept(false)
         throw;
     }
 
+    release_referenced_payloads();
     if (!internal_buffer_)
     {
         participant_->return_send_buffer(std::move(send_buffer_));
@@ -215,6 +217,7 @@ RTPSMessageGroup::~RTPSMessageGroup() noexcept(false)
 
 void RTPSMessageGroup::reset_to_header()
 {
+    release_referenced_payloads();
     CDRMessage::initCDRMsg(full_msg_);
     full_msg_->pos = RTPSMESSAGE_HEADER_SIZE;
     full_msg_->length = RTPSMESSAGE_HEADER_SIZE;
@@ -261,17 +264,77 @@ void RTPSMessageGroup::send()
 
             eprosima::fastdds::statistics::rtps::add_statistics_submessage(msgToSend);
 
-            if (!sender_->send(msgToSend,
+            std::chrono::steady_clock::time_point max_blocking_time_point =
                     max_blocking_time_is_set_ ? max_blocking_time_point_ : (std::chrono::steady_clock::now() +
-                    std::chrono::hours(24))))
+                    std::chrono::hours(24));
+
+            if (referenced_payloads_.empty())
+            {
+                if (!sender_->send(msgToSend, max_blocking_time_point))
+                {
+                    throw timeout();
+                }
+                current_sent_bytes_ += msgToSend->length;
+            }
+            else
             {
-                throw timeout();
+                // Interleave the serialized submessages with the payloads they reference
+                buffers_to_send_.clear();
+                uint32_t from = 0;
+                for (const std::pair<uint32_t, NetworkBuffer>& referenced : referenced_payloads_)
+                {
+                    buffers_to_send_.emplace_back(&msgToSend->buffer[from], referenced.first - from);
+                    buffers_to_send_.push_back(referenced.second);
+                    from = referenced.first;
+                }
+                if (from < msgToSend->length)
+                {
+                    buffers_to_send_.emplace_back(&msgToSend->buffer[from], msgToSend->length - from);
+                }
+
+                uint32_t total_bytes = msgToSend->length + referenced_payloads_size_;
+                if (!sender_->send(buffers_to_send_, total_bytes, max_blocking_time_point))
+                {
+                    throw timeout();
+                }
+                current_sent_bytes_ += total_bytes;
             }
-            current_sent_bytes_ += msgToSend->length;
         }
     }
 }
 
+bool RTPSMessageGroup::can_reference_payload(
+        uint32_t payload_size) const
+{
+#ifdef FASTDDS_STATISTICS
+    // The transports fill the statistics submessage in place, which needs a contiguous message
+    static_cast<void>(payload_size);
+    return false;
+#else
+    if (payload_size < min_referenced_payload_size_)
+    {
+        return false;
+    }
+
+#if HAVE_SECURITY
+    // Protected messages are transformed as a whole
+    if (participant_->security_attributes().is_rtps_protected && endpoint_->supports_rtps_protection())
+    {
+        return false;
+    }
+#endif // if HAVE_SECURITY
+
+    return true;
+#endif // FASTDDS_STATISTICS
+}
+
+void RTPSMessageGroup::release_referenced_payloads()
+{
+    full_msg_->max_size += referenced_payloads_size_;
+    referenced_payloads_size_ = 0;
+    referenced_payloads_.clear();
+}
+
 void RTPSMessageGroup::flush_and_reset()
 {
     // Flush
@@ -321,6 +384,111 @@ bool RTPSMessageGroup::insert_submessage(
     return true;
 }
 
+bool RTPSMessageGroup::serialize_data_submessage(
+        const CacheChange_t& change,
+        uint32_t fragment_number,
+        const SerializedPayload_t& payload,
+        const EntityId_t& reader_id,
+        bool expects_inline_qos,
+        InlineQosWriter* inline_qos,
+        bool reference_payload,
+        bool* is_big_submessage)
+{
+    uint32_t initial_length = full_msg_->length;
+    uint32_t initial_pos = full_msg_->pos;
+
+    // A referenced payload takes no room on the buffer, but it counts for the size of the message
+    uint32_t payload_position = 0;
+    uint32_t* payload_position_ptr = reference_payload ? &payload_position : nullptr;
+    uint32_t referenced_size = reference_payload ? payload.length : 0;
+    if (referenced_size >= full_msg_->max_size - full_msg_->length)
+    {
+        return false;
+    }
+
+#ifdef FASTDDS_STATISTICS
+    // Keep room for the statistics submessage by reducing max_size while appending submessages
+    full_msg_->max_size -= eprosima::fastdds::statistics::rtps::statistics_submessage_length;
+#endif // FASTDDS_STATISTICS
+    full_msg_->max_size -= referenced_size;
+
+    bool ret_val = CDRMessage::appendMsg(full_msg_, submessage_msg_);
+    if (ret_val && 0 == fragment_number)
+    {
+        ret_val = RTPSMessageCreator::addSubmessageData(full_msg_, &change, endpoint_->getAttributes().topicKind,
+                        reader_id, expects_inline_qos, inline_qos, is_big_submessage, payload_position_ptr);
+    }
+    else if (ret_val)
+    {
+        ret_val = RTPSMessageCreator::addSubmessageDataFrag(full_msg_, &change, fragment_number, payload,
+                        endpoint_->getAttributes().topicKind, reader_id, expects_inline_qos, inline_qos,
+                        payload_position_ptr);
+    }
+
+    full_msg_->max_size += referenced_size;
+#ifdef FASTDDS_STATISTICS
+    full_msg_->max_size += eprosima::fastdds::statistics::rtps::statistics_submessage_length;
+#endif // FASTDDS_STATISTICS
+
+    if (ret_val)
+    {
+        full_msg_->length = full_msg_->pos;
+
+        // Position 0 is never a payload position, as the message starts with the RTPS header
+        if (0 != payload_position)
+        {
+            // Keep the room of the payload reserved until the message is sent
+            referenced_payloads_.emplace_back(payload_position, NetworkBuffer(payload.data, payload.length));
+            referenced_payloads_size_ += payload.length;
+            full_msg_->max_size -= payload.length;
+        }
+    }
+    else
+    {
+        // Discard whatever was partially serialized
+        full_msg_->length = initial_length;
+        full_msg_->pos = initial_pos;
+    }
+
+    return ret_val;
+}
+
+bool RTPSMessageGroup::insert_data_submessage(
+        const CacheChange_t& change,
+        uint32_t fragment_number,
+        const SerializedPayload_t& payload,
+        const EntityId_t& reader_id,
+        bool expects_inline_qos,
+        InlineQosWriter* inline_qos,
+        bool reference_payload)
+{
+    bool is_big_submessage = false;
+
+    if (!serialize_data_submessage(change, fragment_number, payload, reader_id, expects_inline_qos, inline_qos,
+            reference_payload, &is_big_submessage))
+    {
+        // Retry
+        flush_and_reset();
+        add_info_dst_in_buffer(full_msg_, sender_->destination_guid_prefix());
+
+        if (!serialize_data_submessage(change, fragment_number, payload, reader_id, expects_inline_qos,
+                inline_qos, reference_payload, &is_big_submessage))
+        {
+            logError(RTPS_WRITER, "Cannot add " << (0 == fragment_number ? "DATA" : "DATA_FRAG") <<
+                    " submsg to the CDRMessage. Buffer too small");
+            return false;
+        }
+    }
+
+    // Messages with a submessage bigger than 64KB cannot have more submessages and should be flushed
+    if (is_big_submessage)
+    {
+        flush();
+    }
+
+    return true;
+}
+
 bool RTPSMessageGroup::add_info_dst_in_buffer(
         CDRMessage_t* buffer,
         const GuidPrefix_t& destination_guid_prefix)
@@ -400,7 +568,7 @@ bool RTPSMessageGroup::add_data(
 
     // Check limitation
     if (0 < sent_bytes_limitation_ &&
-            (change.serializedPayload.length > (sent_bytes_limitation_ - (current_sent_bytes_ + full_msg_->length))))
+            (change.serializedPayload.length > (sent_bytes_limitation_ - get_current_bytes_processed())))
     {
         flush_and_reset();
         throw limit_exceeded();
@@ -422,6 +590,17 @@ bool RTPSMessageGroup::add_data(
 #endif // if HAVE_SECURITY
     const EntityId_t& readerId = get_entity_id(sender_->remote_guids());
 
+#if HAVE_SECURITY
+    if (!endpoint_->getAttributes().security_attributes().is_payload_protected &&
+            !endpoint_->getAttributes().security_attributes().is_submessage_protected)
+#endif // if HAVE_SECURITY
+    {
+        bool reference_payload = ALIVE == change.kind && nullptr != change.serializedPayload.data &&
+                can_reference_payload(change.serializedPayload.length);
+        return insert_data_submessage(change, 0, change.serializedPayload, readerId, expectsInlineQos, inlineQos,
+                       reference_payload);
+    }
+
     CacheChange_t change_to_add;
     change_to_add.copy_not_memcpy(&change);
     change_to_add.serializedPayload.data = change.serializedPayload.data;
@@ -506,7 +685,7 @@ bool RTPSMessageGroup::add_data_frag(
             change.serializedPayload.length - fragment_start;
     // Check limitation
     if (0 < sent_bytes_limitation_ &&
-            (fragment_size > (sent_bytes_limitation_ - (current_sent_bytes_ + full_msg_->length))))
+            (fragment_size > (sent_bytes_limitation_ - get_current_bytes_processed())))
     {
         flush_and_reset();
         throw limit_exceeded();
@@ -534,6 +713,17 @@ bool RTPSMessageGroup::add_data_frag(
     change_to_add.serializedPayload.data = change.serializedPayload.data + fragment_start;
     change_to_add.serializedPayload.length = fragment_size;
 
+#if HAVE_SECURITY
+    if (!endpoint_->getAttributes().security_attributes().is_payload_protected &&
+            !endpoint_->getAttributes().security_attributes().is_submessage_protected)
+#endif // if HAVE_SECURITY
+    {
+        bool ret_val = insert_data_submessage(change, fragment_number, change_to_add.serializedPayload, readerId,
+                        expectsInlineQos, inlineQos, ALIVE == change.kind && can_reference_payload(fragment_size));
+        change_to_add.serializedPayload.data = nullptr;
+        return ret_val;
+    }
+
 #if HAVE_SECURITY
     if (endpoint_->getAttributes().security_attributes().is_payload_protected)
     {
@@ -809,7 +999,7 @@ bool RTPSMessageGroup::add_acknack(
 
     // Notify the statistics module, note that only readers add acknacks
     assert(nullptr != dynamic_cast<RTPSReader*>(endpoint_));
-    static_cast<fastdds::statistics::StatisticsReaderImpl*>(static_cast<RTPSReader*>(endpoint_))->on_acknack(count);
+    static_cast<RTPSReader*>(endpoint_)->on_acknack(count);
 
     return insert_submessage(false);
 }
@@ -104,6 +104,9 @@ public:
 #if HAVE_SECURITY
     CDRMessage_t rtpsmsg_encrypt_;
 #endif
+
+    //! Position of this buffer on the SendBuffersManager that created it
+    uint32_t pool_index_ = 0;
 };
 
 } // namespace rtps
@@ -17,18 +17,68 @@
  */
 
 #include "SendBuffersManager.hpp"
-#include "../participant/RTPSParticipantImpl.h"
+#include <rtps/participant/RTPSParticipantImpl.h>
+
+#include <chrono>
 
 namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
+static uint32_t thread_cache_index()
+{
+    // Threads are spread among the cache slots in the order they first use a pool
+    static std::atomic<uint32_t> next_index{0};
+    static thread_local uint32_t index = next_index.fetch_add(1u, std::memory_order_relaxed);
+    return index;
+}
+
+static inline uint32_t head_index(
+        uint64_t head)
+{
+    return static_cast<uint32_t>(head);
+}
+
+static inline uint64_t make_head(
+        uint32_t index,
+        uint64_t previous_head)
+{
+    // Increase the counter on the high bits to avoid ABA problems
+    return (((previous_head >> 32) + 1) << 32) | index;
+}
+
 SendBuffersManager::SendBuffersManager(
         size_t reserved_size,
         bool allow_growing)
-    : allow_growing_(allow_growing)
+    : reserved_size_(reserved_size)
+    , allow_growing_(allow_growing)
 {
-    pool_.reserve(reserved_size);
+}
+
+SendBuffersManager::~SendBuffersManager()
+{
+    uint32_t n_created = n_created_.load();
+
+#ifndef NDEBUG
+    uint32_t n_free = 0;
+    for (uint32_t index = pop(); invalid_index != index; index = pop())
+    {
+        ++n_free;
+    }
+    for (CacheSlot& cache : caches_)
+    {
+        if (invalid_index != cache.index.load())
+        {
+            ++n_free;
+        }
+    }
+    assert(n_free == n_created);
+#endif // ifndef NDEBUG
+
+    for (uint32_t index = 0; index < n_created; ++index)
+    {
+        delete slot(index).buffer;
+    }
 }
 
 void SendBuffersManager::init(
@@ -36,7 +86,8 @@ void SendBuffersManager::init(
 {
     std::lock_guard<std::mutex> guard(mutex_);
 
-    if (n_created_ < pool_.capacity())
+    uint32_t n_created = n_created_.load();
+    if (n_created < reserved_size_)
     {
         const GuidPrefix_t& guid_prefix = participant->getGuid().guidPrefix;
 
@@ -54,21 +105,22 @@ void SendBuffersManager::init(
 #else
         advance *= 2;
 #endif
-        size_t data_size = advance * (pool_.capacity() - n_created_);
+        size_t data_size = advance * (reserved_size_ - n_created);
         common_buffer_.assign(data_size, 0);
 
         octet* raw_buffer = common_buffer_.data();
-        while(n_created_ < pool_.capacity())
+        while (n_created < reserved_size_)
         {
-            pool_.emplace_back(new RTPSMessageGroup_t(
+            RTPSMessageGroup_t* new_item = new RTPSMessageGroup_t(
                 raw_buffer,
 #if HAVE_SECURITY
                 secure,
 #endif
                 payload_size, guid_prefix
-            ));
+                );
+            push(add_slot(new_item));
             raw_buffer += advance;
-            ++n_created_;
+            ++n_created;
         }
     }
 }
@@ -76,38 +128,86 @@ void SendBuffersManager::init(
 std::unique_ptr<RTPSMessageGroup_t> SendBuffersManager::get_buffer(
         const RTPSParticipantImpl* participant)
 {
+    // Fast path: the cache slot of this thread, then the free list
+    CacheSlot& cache = caches_[thread_cache_index() % num_caches];
+    uint32_t index = cache.index.exchange(invalid_index, std::memory_order_acquire);
+    if (invalid_index == index)
+    {
+        index = pop();
+    }
+
+    if (invalid_index != index)
+    {
+        return take_slot(index);
+    }
+
+    // Slow path: the pool is exhausted
+    ++exhausted_count_;
+
     std::unique_lock<std::mutex> lock(mutex_);
 
-    std::unique_ptr<RTPSMessageGroup_t> ret_val;
+    uint32_t n_created = n_created_.load();
+    if ((allow_growing_ || n_created < reserved_size_) && (n_created < chunk_size * max_chunks))
+    {
+        return take_slot(add_one_buffer(participant));
+    }
 
-    while (pool_.empty())
+    // Register as waiting before looking for a returned buffer. Paired with the fence on return_buffer.
+    ++n_waiting_;
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    index = take_any();
+    if (invalid_index == index)
     {
-        if (allow_growing_ || n_created_ < pool_.capacity())
+        logInfo(RTPS_PARTICIPANT, "Waiting for send buffer");
+        ++wait_count_;
+        auto wait_start = std::chrono::steady_clock::now();
+        do
         {
-            add_one_buffer(participant);
-        }
-        else
-        {
-            logInfo(RTPS_PARTICIPANT, "Waiting for send buffer");
             available_cv_.wait(lock);
-        }
+            index = take_any();
+        } while (invalid_index == index);
+        total_wait_ns_ += static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - wait_start).count());
     }
+    --n_waiting_;
 
-    ret_val = std::move(pool_.back());
-    pool_.pop_back();
-
-    return ret_val;
+    return take_slot(index);
 }
 
 void SendBuffersManager::return_buffer(
         std::unique_ptr <RTPSMessageGroup_t>&& buffer)
 {
-    std::lock_guard<std::mutex> guard(mutex_);
-    pool_.push_back(std::move(buffer));
-    available_cv_.notify_one();
+    uint32_t index = buffer.release()->pool_index_;
+
+    // Try to keep the buffer on the cache slot of this thread, so it can get it again without contention
+    CacheSlot& cache = caches_[thread_cache_index() % num_caches];
+    uint32_t expected = invalid_index;
+    if (!cache.index.compare_exchange_strong(expected, index))
+    {
+        push(index);
+    }
+
+    // Waiting threads register themselves before looking for a buffer, so either they find this one or it is
+    // notified to them.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (0u < n_waiting_.load())
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        available_cv_.notify_one();
+    }
 }
 
-void SendBuffersManager::add_one_buffer(
+SendBuffersStatistics SendBuffersManager::get_statistics() const
+{
+    SendBuffersStatistics ret_val;
+    ret_val.created_buffers = n_created_.load();
+    ret_val.exhausted_count = exhausted_count_.load();
+    ret_val.wait_count = wait_count_.load();
+    ret_val.total_wait_time = std::chrono::nanoseconds(total_wait_ns_.load());
+    return ret_val;
+}
+
+uint32_t SendBuffersManager::add_one_buffer(
         const RTPSParticipantImpl* participant)
 {
     RTPSMessageGroup_t* new_item = new RTPSMessageGroup_t(
@@ -115,8 +215,70 @@ void SendBuffersManager::add_one_buffer(
         participant->is_secure(),
 #endif
         participant->getMaxMessageSize(), participant->getGuid().guidPrefix);
-    pool_.emplace_back(new_item);
-    ++n_created_;
+    return add_slot(new_item);
+}
+
+uint32_t SendBuffersManager::add_slot(
+        RTPSMessageGroup_t* buffer)
+{
+    // Should be called with the mutex taken
+    uint32_t index = n_created_.load();
+    std::unique_ptr<Slot[]>& chunk = chunks_[index / chunk_size];
+    if (!chunk)
+    {
+        chunk.reset(new Slot[chunk_size]);
+    }
+
+    buffer->pool_index_ = index;
+    chunk[index % chunk_size].buffer = buffer;
+    n_created_.store(index + 1);
+    return index;
+}
+
+void SendBuffersManager::push(
+        uint32_t index)
+{
+    Slot& item = slot(index);
+    uint64_t head = free_head_.load(std::memory_order_relaxed);
+    uint64_t new_head;
+    do
+    {
+        item.next.store(head_index(head), std::memory_order_relaxed);
+        new_head = make_head(index, head);
+    } while (!free_head_.compare_exchange_weak(head, new_head, std::memory_order_seq_cst,
+            std::memory_order_relaxed));
+}
+
+uint32_t SendBuffersManager::pop()
+{
+    uint64_t head = free_head_.load(std::memory_order_acquire);
+    while (invalid_index != head_index(head))
+    {
+        uint32_t next = slot(head_index(head)).next.load(std::memory_order_relaxed);
+        if (free_head_.compare_exchange_weak(head, make_head(next, head), std::memory_order_acquire,
+                std::memory_order_acquire))
+        {
+            return head_index(head);
+        }
+    }
+
+    return invalid_index;
+}
+
+uint32_t SendBuffersManager::take_any()
+{
+    uint32_t index = pop();
+    for (uint32_t n = 0; (invalid_index == index) && (n < num_caches); ++n)
+    {
+        index = caches_[n].index.exchange(invalid_index);
+    }
+    return index;
+}
+
+std::unique_ptr<RTPSMessageGroup_t> SendBuffersManager::take_slot(
+        uint32_t index) const
+{
+    return std::unique_ptr<RTPSMessageGroup_t>(slot(index).buffer);
 }
 
 } /* namespace rtps */
@@ -22,7 +22,10 @@
 
 #include "RTPSMessageGroup_t.hpp"
 #include <fastdds/rtps/common/GuidPrefix_t.hpp>
+#include <fastdds/rtps/participant/SendBuffersStatistics.hpp>
 
+#include <array>               // std::array
+#include <atomic>              // std::atomic
 #include <vector>              // std::vector
 #include <memory>              // std::unique_ptr
 #include <mutex>               // std::mutex
@@ -37,6 +40,10 @@ class RTPSParticipantImpl;
 
 /**
  * Manages a pool of send buffers.
+ *
+ * Free buffers are kept on a lock-free stack and on a small set of per-thread cache slots, so getting and
+ * returning a buffer doesn't take any lock while the pool has buffers available.
+ * The mutex is only taken when a new buffer should be created or when a thread should wait for one.
  * @ingroup WRITER_MODULE
  */
 class SendBuffersManager
@@ -52,10 +59,7 @@ public:
             size_t reserved_size,
             bool allow_growing);
 
-    ~SendBuffersManager()
-    {
-        assert(pool_.size() == n_created_);
-    }
+    ~SendBuffersManager();
 
     /**
      * Initialization of pool.
@@ -80,23 +84,87 @@ public:
     void return_buffer(
             std::unique_ptr <RTPSMessageGroup_t>&& buffer);
 
+    /**
+     * Get the usage statistics of the pool.
+     * @return A copy of the statistics collected by this pool.
+     */
+    SendBuffersStatistics get_statistics() const;
+
 private:
 
-    void add_one_buffer(
+    //! Value used to mark the end of the free list and the empty cache slots
+    static constexpr uint32_t invalid_index = 0xFFFFFFFFu;
+
+    //! Number of buffers on each chunk of slots
+    static constexpr uint32_t chunk_size = 64u;
+
+    //! Maximum number of chunks of slots
+    static constexpr uint32_t max_chunks = 1024u;
+
+    //! Number of cache slots shared by the threads using the pool
+    static constexpr uint32_t num_caches = 16u;
+
+    struct Slot
+    {
+        //! Buffer owned by the slot
+        RTPSMessageGroup_t* buffer = nullptr;
+        //! Index of the next free slot, when this one is on the free list
+        std::atomic<uint32_t> next{invalid_index};
+    };
+
+    struct alignas(64) CacheSlot
+    {
+        std::atomic<uint32_t> index{invalid_index};
+    };
+
+    Slot& slot(
+            uint32_t index) const
+    {
+        return chunks_[index / chunk_size][index % chunk_size];
+    }
+
+    uint32_t add_one_buffer(
             const RTPSParticipantImpl* participant);
 
-    //!Protects all data
+    uint32_t add_slot(
+            RTPSMessageGroup_t* buffer);
+
+    void push(
+            uint32_t index);
+
+    uint32_t pop();
+
+    uint32_t take_any();
+
+    std::unique_ptr<RTPSMessageGroup_t> take_slot(
+            uint32_t index) const;
+
+    //!Reserved size for the pool
+    size_t reserved_size_ = 0;
+    //!Protects the creation of buffers and the waiting for a returned buffer
     std::mutex mutex_;
-    //!Send buffers pool
-    std::vector<std::unique_ptr<RTPSMessageGroup_t>> pool_;
+    //!Slots for the buffers created by the pool
+    std::array<std::unique_ptr<Slot[]>, max_chunks> chunks_;
+    //!Head of the free list. Index of the first free slot on the low 32 bits, ABA counter on the high ones
+    std::atomic<uint64_t> free_head_{invalid_index};
+    //!Per-thread cache slots
+    std::array<CacheSlot, num_caches> caches_;
     //!Raw buffer shared by the buffers created inside init()
     std::vector<octet> common_buffer_;
     //!Creation counter
-    std::size_t n_created_ = 0;
-    //!Whether we allow n_created_ to grow beyond the pool_ capacity.
+    std::atomic<uint32_t> n_created_{0};
+    //!Whether we allow n_created_ to grow beyond the reserved size.
     bool allow_growing_ = true;
+    //!Number of threads waiting for a buffer to be returned to the pool.
+    std::atomic<uint32_t> n_waiting_{0};
     //!To wait for a buffer to be returned to the pool.
     std::condition_variable available_cv_;
+    //!Number of times the pool had no buffers available
+    std::atomic<uint64_t> exhausted_count_{0};
+    //!Number of times a thread waited for a buffer
+    std::atomic<uint64_t> wait_count_{0};
+    //!Accumulated waiting time in nanoseconds
+    std::atomic<uint64_t> total_wait_ns_{0};
 };
 
 } /* namespace rtps */
@@ -138,6 +138,11 @@ ResourceEvent& RTPSParticipant::get_resource_event() const
     return mp_impl->getEventResource();
 }
 
+SendBuffersStatistics RTPSParticipant::get_send_buffers_statistics() const
+{
+    return mp_impl->get_send_buffers_statistics();
+}
+
 WLP* RTPSParticipant::wlp() const
 {
     return mp_impl->wlp();
@@ -96,6 +96,38 @@ static bool should_be_intraprocess_only(
         (ParticipantFilteringFlags::FILTER_DIFFERENT_HOST | ParticipantFilteringFlags::FILTER_DIFFERENT_PROCESS);
 }
 
+/*
+ * Participant property:
+ * - fastdds.lazy_startup: "true" to defer the resources that are not needed until they are first used.
+ */
+static bool should_start_lazily(
+        const RTPSParticipantAttributes& att)
+{
+    const std::string* property = PropertyPolicyHelper::find_property(att.properties, "fastdds.lazy_startup");
+    return nullptr != property && "true" == *property;
+}
+
+template<typename EndpointType>
+static void remove_from_topic_index(
+        std::unordered_map<std::string, std::vector<EndpointType*>>& index,
+        const Endpoint* endpoint)
+{
+    for (auto topic_it = index.begin(); topic_it != index.end(); ++topic_it)
+    {
+        auto& endpoints = topic_it->second;
+        auto it = std::find(endpoints.begin(), endpoints.end(), endpoint);
+        if (it != endpoints.end())
+        {
+            endpoints.erase(it);
+            if (endpoints.empty())
+            {
+                index.erase(topic_it);
+            }
+            return;
+        }
+    }
+}
+
 static bool get_unique_flows_parameters(
         const RTPSParticipantAttributes& part_att,
         const EndpointAttributes& att,
@@ -147,6 +179,7 @@ RTPSParticipantImpl::RTPSParticipantImpl(
     , mp_mutex(new std::recursive_mutex())
     , is_intraprocess_only_(should_be_intraprocess_only(PParam))
     , has_shm_transport_(false)
+    , lazy_startup_(should_start_lazily(PParam))
 {
     if (c_GuidPrefix_Unknown != persistence_guid)
     {
@@ -169,6 +202,8 @@ RTPSParticipantImpl::RTPSParticipantImpl(
         shm_transport.segment_size(segment_size_udp_equivalent);
         // Use same default max_message_size on both UDP and SHM
         shm_transport.max_message_size(descriptor.max_message_size());
+        // The segment pages are only needed when sending to local participants
+        shm_transport.lazy_segment(lazy_startup_);
         has_shm_transport_ |= m_network_Factory.RegisterTransport(&shm_transport);
 #endif // ifdef SHM_TRANSPORT_BUILTIN
     }
@@ -392,7 +427,25 @@ RTPSParticipantImpl::RTPSParticipantImpl(
 
     // Initialize flow controller factory.
     // This must be done after initiate network layer.
-    flow_controller_factory_.init(this);
+    uint32_t async_sender_threads = 1;
+    const std::string* async_sender_threads_property = PropertyPolicyHelper::find_property(m_att.properties,
+                    "fastdds.async_flow_controller.sender_threads");
+    if (nullptr != async_sender_threads_property)
+    {
+        char* ptr = nullptr;
+        unsigned long value = strtoul(async_sender_threads_property->c_str(), &ptr, 10);
+
+        if (async_sender_threads_property->c_str() != ptr && 0 < value)     // A valid integer was read.
+        {
+            async_sender_threads = static_cast<uint32_t>(value);
+        }
+        else
+        {
+            logError(RTPS_PARTICIPANT,
+                    "Wrong value for fastdds.async_flow_controller.sender_threads property. Using one thread");
+        }
+    }
+    flow_controller_factory_.init(this, async_sender_threads);
 
     // Support old API
     if (PParam.throughputController.bytesPerPeriod != UINT32_MAX && PParam.throughputController.periodMillisecs != 0)
@@ -1162,6 +1215,10 @@ bool RTPSParticipantImpl::registerWriter(
         const TopicAttributes& topicAtt,
         const WriterQos& wqos)
 {
+    {
+        std::lock_guard<std::recursive_mutex> guard(*mp_mutex);
+        m_userWritersByTopic[topicAtt.topicName.to_string()].push_back(Writer);
+    }
     return this->mp_builtinProtocols->addLocalWriter(Writer, topicAtt, wqos);
 }
 
@@ -1170,9 +1227,29 @@ bool RTPSParticipantImpl::registerReader(
         const TopicAttributes& topicAtt,
         const ReaderQos& rqos)
 {
+    {
+        std::lock_guard<std::recursive_mutex> guard(*mp_mutex);
+        m_userReadersByTopic[topicAtt.topicName.to_string()].push_back(reader);
+    }
     return this->mp_builtinProtocols->addLocalReader(reader, topicAtt, rqos);
 }
 
+const std::vector<RTPSReader*>& RTPSParticipantImpl::user_readers_on_topic(
+        const std::string& topic_name) const
+{
+    static const std::vector<RTPSReader*> no_readers;
+    auto it = m_userReadersByTopic.find(topic_name);
+    return it != m_userReadersByTopic.end() ? it->second : no_readers;
+}
+
+const std::vector<RTPSWriter*>& RTPSParticipantImpl::user_writers_on_topic(
+        const std::string& topic_name) const
+{
+    static const std::vector<RTPSWriter*> no_writers;
+    auto it = m_userWritersByTopic.find(topic_name);
+    return it != m_userWritersByTopic.end() ? it->second : no_writers;
+}
+
 void RTPSParticipantImpl::update_attributes(
         const RTPSParticipantAttributes& patt)
 {
@@ -1535,6 +1612,7 @@ bool RTPSParticipantImpl::deleteUserEndpoint(
                     break;
                 }
             }
+            remove_from_topic_index(m_userWritersByTopic, p_endpoint);
             for (auto wit = m_allWriterList.begin(); wit != m_allWriterList.end(); ++wit)
             {
                 if ((*wit)->getGuid().entityId == p_endpoint->getGuid().entityId) //Found it
@@ -1557,6 +1635,7 @@ bool RTPSParticipantImpl::deleteUserEndpoint(
                     break;
                 }
             }
+            remove_from_topic_index(m_userReadersByTopic, p_endpoint);
             for (auto rit = m_allReaderList.begin(); rit != m_allReaderList.end(); ++rit)
             {
                 if ((*rit)->getGuid().entityId == p_endpoint->getGuid().entityId) //Found it
@@ -1955,6 +2034,11 @@ void RTPSParticipantImpl::return_send_buffer(
     send_buffers_->return_buffer(std::move(buffer));
 }
 
+SendBuffersStatistics RTPSParticipantImpl::get_send_buffers_statistics() const
+{
+    return send_buffers_->get_statistics();
+}
+
 uint32_t RTPSParticipantImpl::get_domain_id() const
 {
     return domain_id_;
@@ -24,6 +24,8 @@
 #include <list>
 #include <sys/types.h>
 #include <mutex>
+#include <string>
+#include <unordered_map>
 #include <atomic>
 #include <chrono>
 #include <fastrtps/utils/Semaphore.h>
@@ -303,6 +305,59 @@ public:
         return ret_code;
     }
 
+    /**
+     * Send a message made of several slices to several locations
+     * @param buffers List of slices composing the message.
+     * @param total_bytes Sum of the sizes of all the slices.
+     * @param sender_guid GUID of the producer of the message.
+     * @param destination_locators_begin Iterator at the first destination locator.
+     * @param destination_locators_end Iterator at the end destination locator.
+     * @param max_blocking_time_point execution time limit timepoint.
+     * @return true if at least one locator has been sent.
+     */
+    template<class LocatorIteratorT>
+    bool sendSync(
+            const std::vector<NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            const GUID_t& sender_guid,
+            const LocatorIteratorT& destination_locators_begin,
+            const LocatorIteratorT& destination_locators_end,
+            std::chrono::steady_clock::time_point& max_blocking_time_point)
+    {
+        bool ret_code = false;
+        std::unique_lock<std::timed_mutex> lock(m_send_resources_mutex_, std::defer_lock);
+
+        if (lock.try_lock_until(max_blocking_time_point))
+        {
+            ret_code = true;
+
+            for (auto& send_resource : send_resource_list_)
+            {
+                LocatorIteratorT locators_begin = destination_locators_begin;
+                LocatorIteratorT locators_end = destination_locators_end;
+                send_resource->send(buffers, total_bytes, &locators_begin, &locators_end,
+                        max_blocking_time_point);
+            }
+
+            lock.unlock();
+
+            // notify statistics module
+            on_rtps_send(
+                sender_guid,
+                destination_locators_begin,
+                destination_locators_end,
+                total_bytes);
+
+            // checkout if sender is a discovery endpoint
+            on_discovery_packet(
+                sender_guid,
+                destination_locators_begin,
+                destination_locators_end);
+        }
+
+        return ret_code;
+    }
+
     //!Get the participant Mutex
     std::recursive_mutex* getParticipantMutex() const
     {
@@ -422,6 +477,12 @@ public:
         return has_shm_transport_;
     }
 
+    //! Whether the resources that are not needed until they are first used should be deferred.
+    bool lazy_startup() const
+    {
+        return lazy_startup_;
+    }
+
     uint32_t get_min_network_send_buffer_size()
     {
         return m_network_Factory.get_min_send_buffer_size();
@@ -473,6 +534,12 @@ public:
     void return_send_buffer(
             std::unique_ptr <RTPSMessageGroup_t>&& buffer);
 
+    /**
+     * Get the usage statistics of the pool of send buffers.
+     * @return Statistics of the pool of send buffers.
+     */
+    SendBuffersStatistics get_send_buffers_statistics() const;
+
     uint32_t get_domain_id() const;
 
     //!Compare metatraffic locators list searching for mutations
@@ -511,6 +578,10 @@ private:
     std::vector<RTPSWriter*> m_userWriterList;
     //!Reader List
     std::vector<RTPSReader*> m_userReaderList;
+    //!User writers indexed by the name of their topic.
+    std::unordered_map<std::string, std::vector<RTPSWriter*>> m_userWritersByTopic;
+    //!User readers indexed by the name of their topic.
+    std::unordered_map<std::string, std::vector<RTPSReader*>> m_userReadersByTopic;
     //!Network Factory
     NetworkFactory m_network_Factory;
     //! Type cheking function
@@ -626,6 +697,9 @@ private:
     //! Indicates whether the participant has shared-memory transport
     bool has_shm_transport_;
 
+    //! Indicates whether the participant defers the resources that are not needed until they are first used
+    bool lazy_startup_;
+
     /**
      * Get persistence service from factory, using endpoint attributes (or participant
      * attributes if endpoint does not define a persistence service config)
@@ -880,6 +954,24 @@ public:
         return m_userWriterList.end();
     }
 
+    /**
+     * Get the user readers registered on a topic.
+     * The participant mutex should be locked while the returned list is used.
+     * @param topic_name Name of the topic.
+     * @return List of the user readers registered on the topic.
+     */
+    const std::vector<RTPSReader*>& user_readers_on_topic(
+            const std::string& topic_name) const;
+
+    /**
+     * Get the user writers registered on a topic.
+     * The participant mutex should be locked while the returned list is used.
+     * @param topic_name Name of the topic.
+     * @return List of the user writers registered on the topic.
+     */
+    const std::vector<RTPSWriter*>& user_writers_on_topic(
+            const std::string& topic_name) const;
+
     /** Helper function that creates ReceiverResources based on a Locator_t List, possibly mutating
      * some and updating the list. DOES NOT associate endpoints with it.
      * @param Locator_list - Locator list to be used to create the ReceiverResources
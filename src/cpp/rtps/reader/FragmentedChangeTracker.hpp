@@ -0,0 +1,221 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file FragmentedChangeTracker.hpp
+ */
+
+#ifndef FASTRTPS_RTPS_READER_FRAGMENTEDCHANGETRACKER_HPP_
+#define FASTRTPS_RTPS_READER_FRAGMENTEDCHANGETRACKER_HPP_
+
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/reader/FragmentReassemblyStatistics.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Keeps track of the changes of a reader that are being reassembled from DATA_FRAG submessages.
+ *
+ * It bounds the number of partially received changes and the payload memory they hold, selects the ones
+ * that should be discarded when those bounds would be exceeded or when they stop receiving fragments, and
+ * collects statistics on reassembly times.
+ *
+ * @remarks Not thread safe. It should be protected by the reader's mutex.
+ */
+class FragmentedChangeTracker
+{
+public:
+
+    using clock = std::chrono::steady_clock;
+
+    /**
+     * Configure the limits of the tracker.
+     * @param max_samples Maximum number of changes being reassembled at the same time. 0 means no limit.
+     * @param max_bytes Maximum payload memory held by the changes being reassembled. 0 means no limit.
+     * @param stale_timeout Time without receiving fragments after which a change is discarded. 0 means never.
+     */
+    void configure(
+            uint32_t max_samples,
+            uint64_t max_bytes,
+            clock::duration stale_timeout)
+    {
+        max_samples_ = max_samples;
+        max_bytes_ = max_bytes;
+        stale_timeout_ = stale_timeout;
+    }
+
+    /**
+     * Start tracking a change which has just received its first fragments.
+     * @param change Pointer to the change being reassembled.
+     * @param now Reception time of the fragments.
+     */
+    void started(
+            CacheChange_t* change,
+            const clock::time_point& now)
+    {
+        entries_.push_back({change, now, now});
+        statistics_.pending_samples++;
+        statistics_.pending_bytes += change->serializedPayload.max_size;
+    }
+
+    /**
+     * Inform that a tracked change received more fragments.
+     * @param change Pointer to the change being reassembled.
+     * @param now Reception time of the fragments.
+     */
+    void progressed(
+            CacheChange_t* change,
+            const clock::time_point& now)
+    {
+        auto it = find(change);
+        if (it != entries_.end())
+        {
+            it->last_fragment = now;
+        }
+    }
+
+    /**
+     * Stop tracking a change which has been completely reassembled.
+     * @param change Pointer to the reassembled change.
+     * @param now Reception time of the last fragments.
+     */
+    void completed(
+            CacheChange_t* change,
+            const clock::time_point& now)
+    {
+        auto it = find(change);
+        if (it != entries_.end())
+        {
+            auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(now - it->first_fragment);
+            statistics_.completed_samples++;
+            statistics_.total_reassembly_time += elapsed;
+            statistics_.max_reassembly_time = (std::max)(statistics_.max_reassembly_time, elapsed);
+            erase(it);
+        }
+    }
+
+    /**
+     * Stop tracking a change which has been removed from the history.
+     * @param change Pointer to the removed change.
+     */
+    void removed(
+            const CacheChange_t* change)
+    {
+        auto it = find(change);
+        if (it != entries_.end())
+        {
+            erase(it);
+        }
+    }
+
+    /**
+     * Stop tracking the changes that should be discarded, either because they are stale or to make room
+     * for a new change that is about to be reassembled.
+     * The stalest changes are selected first.
+     *
+     * @param incoming_size Payload size of the change about to be reassembled. 0 to only check for stale changes.
+     * @param now Current time.
+     * @param discard Functor called with each of the changes to discard.
+     */
+    template<typename Functor>
+    void evict(
+            uint32_t incoming_size,
+            const clock::time_point& now,
+            Functor discard)
+    {
+        while (!entries_.empty())
+        {
+            auto stalest = std::min_element(entries_.begin(), entries_.end(),
+                            [](const Entry& a, const Entry& b)
+                            {
+                                return a.last_fragment < b.last_fragment;
+                            });
+
+            bool is_stale = (stale_timeout_ > clock::duration::zero()) &&
+                    (now - stalest->last_fragment > stale_timeout_);
+            bool over_limits = (incoming_size > 0) &&
+                    ((max_samples_ > 0 && statistics_.pending_samples + 1 > max_samples_) ||
+                    (max_bytes_ > 0 && statistics_.pending_bytes + incoming_size > max_bytes_));
+            if (!is_stale && !over_limits)
+            {
+                break;
+            }
+
+            CacheChange_t* change = stalest->change;
+            statistics_.evicted_samples++;
+            erase(stalest);
+            discard(change);
+        }
+    }
+
+    /**
+     * Get the reassembly statistics.
+     * @return A reference to the statistics collected by this tracker.
+     */
+    const FragmentReassemblyStatistics& statistics() const
+    {
+        return statistics_;
+    }
+
+private:
+
+    struct Entry
+    {
+        CacheChange_t* change;
+        clock::time_point first_fragment;
+        clock::time_point last_fragment;
+    };
+
+    std::vector<Entry>::iterator find(
+            const CacheChange_t* change)
+    {
+        return std::find_if(entries_.begin(), entries_.end(),
+                       [change](const Entry& entry)
+                       {
+                           return entry.change == change;
+                       });
+    }
+
+    void erase(
+            std::vector<Entry>::iterator it)
+    {
+        statistics_.pending_samples--;
+        statistics_.pending_bytes -= it->change->serializedPayload.max_size;
+        *it = entries_.back();
+        entries_.pop_back();
+    }
+
+    std::vector<Entry> entries_;
+
+    uint32_t max_samples_ = 0;
+
+    uint64_t max_bytes_ = 0;
+
+    clock::duration stale_timeout_ = clock::duration::zero();
+
+    FragmentReassemblyStatistics statistics_;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // FASTRTPS_RTPS_READER_FRAGMENTEDCHANGETRACKER_HPP_
@@ -36,6 +36,7 @@
 #include <fastdds/rtps/history/ReaderHistory.h>
 #include <fastdds/rtps/reader/ReaderListener.h>
 #include <fastdds/rtps/resources/ResourceEvent.h>
+#include <fastdds/rtps/attributes/PropertyPolicy.h>
 
 #include <foonathan/memory/namespace_alias.hpp>
 
@@ -105,6 +106,39 @@ RTPSReader::RTPSReader(
     init(payload_pool, change_pool, att);
 }
 
+/**
+ * Reads the busy-poll mode of the data-sharing listener from the endpoint properties:
+ * - fastdds.datasharing.busy_poll_us: microseconds to spin before blocking on the notification.
+ * - fastdds.datasharing.busy_poll_only: "true" to spin without ever blocking.
+ */
+static void get_datasharing_busy_poll_configuration(
+        const ReaderAttributes& att,
+        uint32_t& busy_poll_us,
+        bool& busy_poll_only)
+{
+    const std::string* property = PropertyPolicyHelper::find_property(
+        att.endpoint.properties, "fastdds.datasharing.busy_poll_us");
+
+    if (nullptr != property)
+    {
+        char* ptr = nullptr;
+        unsigned long value = strtoul(property->c_str(), &ptr, 10);
+
+        if (property->c_str() != ptr)     // A valid integer was read.
+        {
+            busy_poll_us = static_cast<uint32_t>(value);
+        }
+        else
+        {
+            logError(RTPS_READER,
+                    "Not numerical value for fastdds.datasharing.busy_poll_us property. Busy-poll disabled");
+        }
+    }
+
+    property = PropertyPolicyHelper::find_property(att.endpoint.properties, "fastdds.datasharing.busy_poll_only");
+    busy_poll_only = (nullptr != property && "true" == *property);
+}
+
 void RTPSReader::init(
         const std::shared_ptr<IPayloadPool>& payload_pool,
         const std::shared_ptr<IChangePool>& change_pool,
@@ -126,12 +160,18 @@ void RTPSReader::init(
             getGuid(), att.endpoint.data_sharing_configuration().shm_directory());
         if (notification)
         {
+            uint32_t busy_poll_us = 0;
+            bool busy_poll_only = false;
+            get_datasharing_busy_poll_configuration(att, busy_poll_us, busy_poll_only);
+
             is_datasharing_compatible_ = true;
             datasharing_listener_.reset(new DataSharingListener(
                         notification,
                         att.endpoint.data_sharing_configuration().shm_directory(),
                         att.matched_writers_allocation,
-                        this));
+                        this,
+                        busy_poll_us,
+                        busy_poll_only));
 
             // We can start the listener here, as no writer can be matched already,
             // so no notification will occur until the non-virtual instance is constructed.
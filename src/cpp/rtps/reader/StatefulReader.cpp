@@ -22,8 +22,10 @@
 #include <fastdds/rtps/history/ReaderHistory.h>
 #include <fastdds/dds/log/Log.hpp>
 #include <fastdds/rtps/messages/RTPSMessageCreator.h>
+#include <fastdds/rtps/attributes/PropertyPolicy.h>
 #include <rtps/participant/RTPSParticipantImpl.h>
 #include <rtps/reader/WriterProxy.h>
+#include <rtps/reader/FragmentedChangeTracker.hpp>
 #include <fastrtps/utils/TimeConversion.h>
 #include <rtps/history/HistoryAttributesExtension.hpp>
 #include <rtps/DataSharing/DataSharingListener.hpp>
@@ -38,6 +40,7 @@
 #include <thread>
 
 #include <cassert>
+#include <cstdlib>
 
 #define IDSTRING "(ID:" << std::this_thread::get_id() << ") " <<
 
@@ -87,6 +90,7 @@ StatefulReader::StatefulReader(
     , proxy_changes_config_(resource_limits_from_history(hist->m_att, 0))
     , disable_positive_acks_(att.disable_positive_acks)
     , is_alive_(true)
+    , fragmented_changes_(new FragmentedChangeTracker())
 {
     init(pimpl, att);
 }
@@ -107,6 +111,7 @@ StatefulReader::StatefulReader(
     , proxy_changes_config_(resource_limits_from_history(hist->m_att, 0))
     , disable_positive_acks_(att.disable_positive_acks)
     , is_alive_(true)
+    , fragmented_changes_(new FragmentedChangeTracker())
 {
     init(pimpl, att);
 }
@@ -128,10 +133,39 @@ StatefulReader::StatefulReader(
     , proxy_changes_config_(resource_limits_from_history(hist->m_att, 0))
     , disable_positive_acks_(att.disable_positive_acks)
     , is_alive_(true)
+    , fragmented_changes_(new FragmentedChangeTracker())
 {
     init(pimpl, att);
 }
 
+/**
+ * Reads a numeric endpoint property.
+ * @return true when the property exists and holds a valid integer.
+ */
+static bool get_numeric_property(
+        const ReaderAttributes& att,
+        const char* name,
+        uint64_t& value)
+{
+    const std::string* property = PropertyPolicyHelper::find_property(att.endpoint.properties, name);
+
+    if (nullptr != property)
+    {
+        char* ptr = nullptr;
+        unsigned long long read_value = strtoull(property->c_str(), &ptr, 10);
+
+        if (property->c_str() != ptr)     // A valid integer was read.
+        {
+            value = static_cast<uint64_t>(read_value);
+            return true;
+        }
+
+        logError(RTPS_READER, "Not numerical value for " << name << " property. Ignoring it");
+    }
+
+    return false;
+}
+
 void StatefulReader::init(
         RTPSParticipantImpl* pimpl,
         const ReaderAttributes& att)
@@ -141,6 +175,20 @@ void StatefulReader::init(
     {
         matched_writers_pool_.push_back(new WriterProxy(this, part_att.allocation.locators, proxy_changes_config_));
     }
+
+    // Limits for the reassembly of fragmented samples:
+    // - fastdds.reassembly.max_samples: maximum number of samples being reassembled at the same time.
+    // - fastdds.reassembly.max_bytes: maximum payload memory held by the samples being reassembled.
+    // - fastdds.reassembly.stale_timeout_ms: partially received samples without new fragments for this
+    //   long are discarded, and will be requested again to the writer.
+    uint64_t max_samples = 0;
+    uint64_t max_bytes = 0;
+    uint64_t stale_timeout_ms = 0;
+    get_numeric_property(att, "fastdds.reassembly.max_samples", max_samples);
+    get_numeric_property(att, "fastdds.reassembly.max_bytes", max_bytes);
+    get_numeric_property(att, "fastdds.reassembly.stale_timeout_ms", stale_timeout_ms);
+    fragmented_changes_->configure(
+        static_cast<uint32_t>(max_samples), max_bytes, std::chrono::milliseconds(stale_timeout_ms));
 }
 
 bool StatefulReader::matched_writer_add(
@@ -526,11 +574,15 @@ bool StatefulReader::processDataFragMsg(
                     getGuid().entityId);
 
             CacheChange_t* change_to_add = incomingChange;
+            auto now = FragmentedChangeTracker::clock::now();
 
             CacheChange_t* change_created = nullptr;
             CacheChange_t* work_change = nullptr;
             if (!mp_history->get_change(change_to_add->sequenceNumber, change_to_add->writerGUID, &work_change))
             {
+                // Make room for the new change before reserving it
+                evict_fragmented_changes_nts(sampleSize);
+
                 // A new change should be reserved
                 if (reserveCache(&work_change, sampleSize))
                 {
@@ -567,11 +619,20 @@ bool StatefulReader::processDataFragMsg(
                     releaseCache(change_created);
                     work_change = nullptr;
                 }
+                else
+                {
+                    fragmented_changes_->started(change_created, now);
+                }
+            }
+            else if (work_change != nullptr)
+            {
+                fragmented_changes_->progressed(work_change, now);
             }
 
             // If change has been fully reassembled, mark as received and add notify user
             if (work_change != nullptr && work_change->is_fully_assembled())
             {
+                fragmented_changes_->completed(work_change, now);
                 pWP->received_change_set(work_change->sequenceNumber);
                 NotifyChanges(pWP);
             }
@@ -608,6 +669,7 @@ bool StatefulReader::processHeartbeatMsg(
                     hbCount, firstSN, lastSN, finalFlag, livelinessFlag, disable_positive_acks_, assert_liveliness))
         {
             mp_history->remove_fragmented_changes_until(firstSN, writerGUID);
+            evict_fragmented_changes_nts(0);
 
             // Maybe now we have to notify user from new CacheChanges.
             NotifyChanges(writer);
@@ -672,6 +734,7 @@ bool StatefulReader::processGapMsg(
                 if (to_remove != nullptr)
                 {
                     // we called the History version to avoid callbacks
+                    fragmented_changes_->removed(to_remove);
                     history_iterator = mp_history->History::remove_change_nts(ret_iterator);
                 }
                 else if (ret_iterator != mp_history->changesEnd())
@@ -692,6 +755,7 @@ bool StatefulReader::processGapMsg(
                     if (to_remove != nullptr)
                     {
                         // we called the History version to avoid callbacks
+                        fragmented_changes_->removed(to_remove);
                         history_iterator = mp_history->History::remove_change_nts(ret_iterator);
                     }
                     else if (ret_iterator != mp_history->changesEnd())
@@ -745,6 +809,8 @@ bool StatefulReader::change_removed_by_history(
 
     if (is_alive_)
     {
+        fragmented_changes_->removed(a_change);
+
         if (wp != nullptr || matched_writer_lookup(a_change->writerGUID, &wp))
         {
             if (a_change->is_fully_assembled())
@@ -865,6 +931,25 @@ bool StatefulReader::change_received(
     return false;
 }
 
+void StatefulReader::evict_fragmented_changes_nts(
+        uint32_t incoming_size)
+{
+    fragmented_changes_->evict(incoming_size, FragmentedChangeTracker::clock::now(),
+            [this](CacheChange_t* change)
+            {
+                logInfo(RTPS_READER, "Discarding partially received change " << change->sequenceNumber <<
+                " from writer " << change->writerGUID);
+                // The writer proxy still considers it missing, so it will be requested again.
+                mp_history->remove_change_nts(mp_history->find_change_nts(change));
+            });
+}
+
+FragmentReassemblyStatistics StatefulReader::get_fragment_reassembly_statistics() const
+{
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+    return fragmented_changes_->statistics();
+}
+
 void StatefulReader::NotifyChanges(
         WriterProxy* prox)
 {
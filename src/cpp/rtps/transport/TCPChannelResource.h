@@ -19,6 +19,7 @@
 #include <fastdds/rtps/transport/TCPTransportDescriptor.h>
 #include <fastdds/rtps/transport/TransportReceiverInterface.h>
 #include <fastdds/rtps/common/Locator.h>
+#include <fastdds/rtps/common/NetworkBuffer.hpp>
 #include <rtps/transport/ChannelResource.h>
 #include <rtps/transport/tcp/RTCPMessageManager.h>
 
@@ -130,6 +131,17 @@ public:
             size_t size,
             asio::error_code& ec) = 0;
 
+    /**
+     * Writes a header followed by a message made of several slices.
+     * @return Number of bytes written, including the header.
+     */
+    virtual size_t send(
+            const fastrtps::rtps::octet* header,
+            size_t header_size,
+            const std::vector<fastrtps::rtps::NetworkBuffer>& buffers,
+            size_t total_bytes,
+            asio::error_code& ec) = 0;
+
     virtual asio::ip::tcp::endpoint remote_endpoint() const = 0;
 
     virtual asio::ip::tcp::endpoint local_endpoint() const = 0;
@@ -15,7 +15,6 @@
 #include <rtps/transport/TCPChannelResourceBasic.h>
 
 #include <future>
-#include <array>
 
 #include <asio.hpp>
 #include <fastrtps/utils/IPLocator.h>
@@ -28,6 +27,7 @@ namespace fastdds {
 namespace rtps {
 
 using octet = fastrtps::rtps::octet;
+using NetworkBuffer = fastrtps::rtps::NetworkBuffer;
 using IPLocator = fastrtps::rtps::IPLocator;
 using Log = fastdds::dds::Log;
 
@@ -144,34 +144,219 @@ uint32_t TCPChannelResourceBasic::read(
     return 0;
 }
 
+void TCPChannelResourceBasic::async_read(
+        octet* buffer,
+        std::size_t size,
+        const std::function<void(const asio::error_code&, std::size_t)>& handler)
+{
+    if (eConnecting < connection_status_)
+    {
+        asio::async_read(*socket_, asio::buffer(buffer, size), transfer_exactly(size), handler);
+    }
+    else
+    {
+        service_.post([handler]()
+                {
+                    handler(asio::error::not_connected, 0);
+                });
+    }
+}
+
 size_t TCPChannelResourceBasic::send(
         const octet* header,
         size_t header_size,
         const octet* data,
         size_t size,
         asio::error_code& ec)
+{
+    const NetworkBuffer buffer(data, static_cast<uint32_t>(size));
+    return send_buffers(header, header_size, &buffer, &buffer + 1, size, ec);
+}
+
+size_t TCPChannelResourceBasic::send(
+        const octet* header,
+        size_t header_size,
+        const std::vector<NetworkBuffer>& buffers,
+        size_t total_bytes,
+        asio::error_code& ec)
+{
+    return send_buffers(header, header_size, buffers.data(), buffers.data() + buffers.size(), total_bytes, ec);
+}
+
+size_t TCPChannelResourceBasic::send_buffers(
+        const octet* header,
+        size_t header_size,
+        const NetworkBuffer* buffers_begin,
+        const NetworkBuffer* buffers_end,
+        size_t total_bytes,
+        asio::error_code& ec)
 {
     size_t bytes_sent = 0;
 
     if (eConnecting < connection_status_)
     {
+        if (write_coalescing_)
+        {
+            return coalesced_send(header, header_size, buffers_begin, buffers_end, total_bytes, ec);
+        }
+
         std::lock_guard<std::mutex> send_guard(send_mutex_);
+        write_buffers_.clear();
         if (header_size > 0)
         {
-            std::array<asio::const_buffer, 2> buffers;
-            buffers[0] = asio::buffer(header, header_size);
-            buffers[1] = asio::buffer(data, size);
-            bytes_sent = asio::write(*socket_.get(), buffers, ec);
+            write_buffers_.push_back(asio::buffer(header, header_size));
         }
-        else
+        for (const NetworkBuffer* it = buffers_begin; it != buffers_end; ++it)
         {
-            bytes_sent = asio::write(*socket_.get(), asio::buffer(data, size), ec);
+            write_buffers_.push_back(asio::buffer(it->buffer, it->size));
         }
+        bytes_sent = asio::write(*socket_.get(), write_buffers_, ec);
     }
 
     return bytes_sent;
 }
 
+size_t TCPChannelResourceBasic::coalesced_send(
+        const octet* header,
+        size_t header_size,
+        const NetworkBuffer* buffers_begin,
+        const NetworkBuffer* buffers_end,
+        size_t total_bytes,
+        asio::error_code& ec)
+{
+    const size_t message_size = header_size + total_bytes;
+    std::unique_lock<std::mutex> lock(send_mutex_);
+
+    // The outbound queue is bounded, but always accepts one message
+    write_done_cv_.wait(lock, [&]()
+            {
+                return !write_in_progress_ || pending_writes_.empty() ||
+                pending_writes_.size() + message_size <= write_coalescing_max_bytes_;
+            });
+
+    QueuedSend queued_send;
+    const bool queued = write_in_progress_ || !pending_writes_.empty();
+
+    if (queued)
+    {
+        // Copied after the queued messages, so they are written in order
+        pending_writes_.insert(pending_writes_.end(), header, header + header_size);
+        for (const NetworkBuffer* it = buffers_begin; it != buffers_end; ++it)
+        {
+            pending_writes_.insert(pending_writes_.end(), it->buffer, it->buffer + it->size);
+        }
+        pending_sends_.push_back(&queued_send);
+
+        if (pending_writes_.size() >= write_coalescing_max_bytes_)
+        {
+            pending_writes_cv_.notify_one();
+        }
+
+        write_done_cv_.wait(lock, [&]()
+                {
+                    return queued_send.done || !write_in_progress_;
+                });
+
+        if (queued_send.done)
+        {
+            ec = queued_send.ec;
+            return ec ? 0 : message_size;
+        }
+
+        // The previous writer handed the queue over without writing this message
+    }
+
+    write_in_progress_ = true;
+
+    if (!queued && 0 < write_coalescing_max_latency_.count())
+    {
+        pending_writes_cv_.wait_for(lock, write_coalescing_max_latency_, [&]()
+                {
+                    return pending_writes_.size() + message_size >= write_coalescing_max_bytes_;
+                });
+    }
+
+    flushing_writes_.swap(pending_writes_);
+    flushing_sends_.swap(pending_sends_);
+    lock.unlock();
+
+    coalesced_buffers_.clear();
+    if (!queued)
+    {
+        if (header_size > 0)
+        {
+            coalesced_buffers_.push_back(asio::buffer(header, header_size));
+        }
+        for (const NetworkBuffer* it = buffers_begin; it != buffers_end; ++it)
+        {
+            coalesced_buffers_.push_back(asio::buffer(it->buffer, it->size));
+        }
+    }
+    if (!flushing_writes_.empty())
+    {
+        coalesced_buffers_.push_back(asio::buffer(flushing_writes_));
+    }
+
+    const bool cork = 1 < flushing_sends_.size() + (queued ? 0 : 1);
+    if (cork)
+    {
+        set_cork(true);
+    }
+
+    asio::write(*socket_.get(), coalesced_buffers_, ec);
+
+    // Uncorking pushes the last partial segment
+    if (cork)
+    {
+        set_cork(false);
+    }
+
+    lock.lock();
+
+    // Every message of the batch gets the result of the write
+    for (QueuedSend* send : flushing_sends_)
+    {
+        send->done = true;
+        send->ec = ec;
+    }
+    flushing_sends_.clear();
+    flushing_writes_.clear();
+
+    if (ec)
+    {
+        logWarning(RTCP, "Error writing coalesced messages: " << ec.message());
+
+        // The socket is not usable, so the messages queued meanwhile fail too
+        for (QueuedSend* send : pending_sends_)
+        {
+            send->done = true;
+            send->ec = ec;
+        }
+        pending_sends_.clear();
+        pending_writes_.clear();
+    }
+
+    // The remaining queue is written by one of the queued senders
+    write_in_progress_ = false;
+    write_done_cv_.notify_all();
+
+    return ec ? 0 : message_size;
+}
+
+void TCPChannelResourceBasic::set_cork(
+        bool enable)
+{
+#ifdef TCP_CORK
+    if (tcp_cork_)
+    {
+        std::error_code ec;
+        socket_->set_option(asio::detail::socket_option::boolean<IPPROTO_TCP, TCP_CORK>(enable), ec);
+    }
+#else
+    static_cast<void>(enable);
+#endif // ifdef TCP_CORK
+}
+
 asio::ip::tcp::endpoint TCPChannelResourceBasic::remote_endpoint() const
 {
     return socket_->remote_endpoint();
@@ -189,6 +374,18 @@ void TCPChannelResourceBasic::set_options(
     socket_->set_option(socket_base::receive_buffer_size(options->receiveBufferSize));
     socket_->set_option(socket_base::send_buffer_size(options->sendBufferSize));
     socket_->set_option(ip::tcp::no_delay(options->enable_tcp_nodelay));
+
+    std::lock_guard<std::mutex> send_guard(send_mutex_);
+    write_coalescing_ = options->enable_write_coalescing;
+    write_coalescing_max_latency_ = std::chrono::microseconds(options->write_coalescing_max_latency_us);
+    write_coalescing_max_bytes_ = options->maxMessageSize;
+    tcp_cork_ = options->enable_tcp_cork;
+#ifndef TCP_CORK
+    if (tcp_cork_)
+    {
+        logWarning(RTCP, "TCP_CORK socket option is not supported on this platform");
+    }
+#endif // ifndef TCP_CORK
 }
 
 void TCPChannelResourceBasic::cancel()
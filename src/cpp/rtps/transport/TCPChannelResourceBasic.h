@@ -15,7 +15,12 @@
 #ifndef _FASTDDS_TCP_CHANNEL_RESOURCE_BASIC_
 #define _FASTDDS_TCP_CHANNEL_RESOURCE_BASIC_
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
 #include <mutex>
+#include <vector>
 #include <asio.hpp>
 #include <rtps/transport/TCPChannelResource.h>
 
@@ -30,6 +35,31 @@ class TCPChannelResourceBasic : public TCPChannelResource
     std::mutex send_mutex_;
     std::shared_ptr<asio::ip::tcp::socket> socket_;
 
+    //! Result of a message queued while another thread was writing on the socket.
+    struct QueuedSend
+    {
+        bool done = false;
+        asio::error_code ec;
+    };
+
+    // Write coalescing. Protected by send_mutex_.
+    std::atomic<bool> write_coalescing_{false};
+    std::chrono::microseconds write_coalescing_max_latency_{0};
+    size_t write_coalescing_max_bytes_ = 0;
+    bool tcp_cork_ = false;
+    bool write_in_progress_ = false;
+    std::vector<asio::const_buffer> write_buffers_;
+    //! Only used by the thread writing on the socket.
+    std::vector<asio::const_buffer> coalesced_buffers_;
+    std::vector<fastrtps::rtps::octet> pending_writes_;
+    std::vector<QueuedSend*> pending_sends_;
+    std::vector<fastrtps::rtps::octet> flushing_writes_;
+    std::vector<QueuedSend*> flushing_sends_;
+    //! Notified when a message is queued.
+    std::condition_variable pending_writes_cv_;
+    //! Notified when the thread writing on the socket finishes.
+    std::condition_variable write_done_cv_;
+
 public:
 
     // Constructor called when trying to connect to a remote server
@@ -58,6 +88,15 @@ public:
             std::size_t size,
             asio::error_code& ec) override;
 
+    /**
+     * Starts reading exactly @c size bytes without blocking.
+     * The handler is called on one of the threads running the io_service.
+     */
+    void async_read(
+            fastrtps::rtps::octet* buffer,
+            std::size_t size,
+            const std::function<void(const asio::error_code&, std::size_t)>& handler);
+
     size_t send(
             const fastrtps::rtps::octet* header,
             size_t header_size,
@@ -65,6 +104,13 @@ public:
             size_t size,
             asio::error_code& ec) override;
 
+    size_t send(
+            const fastrtps::rtps::octet* header,
+            size_t header_size,
+            const std::vector<fastrtps::rtps::NetworkBuffer>& buffers,
+            size_t total_bytes,
+            asio::error_code& ec) override;
+
     asio::ip::tcp::endpoint remote_endpoint() const override;
     asio::ip::tcp::endpoint local_endpoint() const override;
 
@@ -83,6 +129,35 @@ public:
 
 private:
 
+    /**
+     * Writes a header followed by the slices in the range [buffers_begin, buffers_end).
+     */
+    size_t send_buffers(
+            const fastrtps::rtps::octet* header,
+            size_t header_size,
+            const fastrtps::rtps::NetworkBuffer* buffers_begin,
+            const fastrtps::rtps::NetworkBuffer* buffers_end,
+            size_t total_bytes,
+            asio::error_code& ec);
+
+    /**
+     * Writes a message coalescing it with the messages sent concurrently by other threads.
+     * If no other thread is writing on the socket, the message is written from the caller's buffers together with
+     * the messages queued meanwhile. Otherwise it is copied on the bounded outbound queue, and the call blocks until
+     * the batch including it has been written, returning the result of that write.
+     * Each thread writes at most one batch, handing the rest of the queue over to one of the queued senders.
+     */
+    size_t coalesced_send(
+            const fastrtps::rtps::octet* header,
+            size_t header_size,
+            const fastrtps::rtps::NetworkBuffer* buffers_begin,
+            const fastrtps::rtps::NetworkBuffer* buffers_end,
+            size_t total_bytes,
+            asio::error_code& ec);
+
+    void set_cork(
+            bool enable);
+
     TCPChannelResourceBasic(
             const TCPChannelResourceBasic&) = delete;
     TCPChannelResourceBasic& operator =(
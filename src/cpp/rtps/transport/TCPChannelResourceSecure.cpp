@@ -27,6 +27,7 @@ namespace rtps {
 using Locator_t = fastrtps::rtps::Locator_t;
 using IPLocator = fastrtps::rtps::IPLocator;
 using octet = fastrtps::rtps::octet;
+using NetworkBuffer = fastrtps::rtps::NetworkBuffer;
 using Log = fastdds::dds::Log;
 
 using namespace asio;
@@ -202,17 +203,32 @@ size_t TCPChannelResourceSecure::send(
         const octet* data,
         size_t size,
         asio::error_code& ec)
+{
+    const std::vector<NetworkBuffer> buffers{NetworkBuffer(data, static_cast<uint32_t>(size))};
+    return send(header, header_size, buffers, size, ec);
+}
+
+size_t TCPChannelResourceSecure::send(
+        const octet* header,
+        size_t header_size,
+        const std::vector<NetworkBuffer>& data_buffers,
+        size_t /*total_bytes*/,
+        asio::error_code& ec)
 {
     size_t bytes_sent = 0;
 
     if (eConnecting < connection_status_)
     {
         std::vector<asio::const_buffer> buffers;
+        buffers.reserve(data_buffers.size() + 1);
         if (header_size > 0)
         {
             buffers.push_back(asio::buffer(header, header_size));
         }
-        buffers.push_back(asio::buffer(data, size));
+        for (const NetworkBuffer& buffer : data_buffers)
+        {
+            buffers.push_back(asio::buffer(buffer.buffer, buffer.size));
+        }
 
         // Work around meanwhile
         std::promise<size_t> write_bytes_promise;
@@ -63,6 +63,13 @@ public:
             size_t size,
             asio::error_code& ec) override;
 
+    size_t send(
+            const fastrtps::rtps::octet* header,
+            size_t header_size,
+            const std::vector<fastrtps::rtps::NetworkBuffer>& buffers,
+            size_t total_bytes,
+            asio::error_code& ec) override;
+
     asio::ip::tcp::endpoint remote_endpoint() const override;
     asio::ip::tcp::endpoint local_endpoint() const override;
 
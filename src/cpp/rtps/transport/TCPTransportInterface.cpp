@@ -71,6 +71,10 @@ TCPTransportDescriptor::TCPTransportDescriptor()
     , wait_for_tcp_negotiation(false)
     , calculate_crc(true)
     , check_crc(true)
+    , reactor_threads(0)
+    , enable_write_coalescing(false)
+    , write_coalescing_max_latency_us(0)
+    , enable_tcp_cork(false)
     , apply_security(false)
 {
 }
@@ -89,6 +93,10 @@ TCPTransportDescriptor::TCPTransportDescriptor(
     , wait_for_tcp_negotiation(t.wait_for_tcp_negotiation)
     , calculate_crc(t.calculate_crc)
     , check_crc(t.check_crc)
+    , reactor_threads(t.reactor_threads)
+    , enable_write_coalescing(t.enable_write_coalescing)
+    , write_coalescing_max_latency_us(t.write_coalescing_max_latency_us)
+    , enable_tcp_cork(t.enable_tcp_cork)
     , apply_security(t.apply_security)
     , tls_config(t.tls_config)
 {
@@ -114,6 +122,10 @@ TCPTransportDescriptor& TCPTransportDescriptor::operator =(
     wait_for_tcp_negotiation = t.wait_for_tcp_negotiation;
     calculate_crc = t.calculate_crc;
     check_crc = t.check_crc;
+    reactor_threads = t.reactor_threads;
+    enable_write_coalescing = t.enable_write_coalescing;
+    write_coalescing_max_latency_us = t.write_coalescing_max_latency_us;
+    enable_tcp_cork = t.enable_tcp_cork;
     apply_security = t.apply_security;
     tls_config = t.tls_config;
     return *this;
@@ -133,6 +145,10 @@ bool TCPTransportDescriptor::operator ==(
            this->wait_for_tcp_negotiation == t.wait_for_tcp_negotiation &&
            this->calculate_crc == t.calculate_crc &&
            this->check_crc == t.check_crc &&
+           this->reactor_threads == t.reactor_threads &&
+           this->enable_write_coalescing == t.enable_write_coalescing &&
+           this->write_coalescing_max_latency_us == t.write_coalescing_max_latency_us &&
+           this->enable_tcp_cork == t.enable_tcp_cork &&
            this->apply_security == t.apply_security &&
            this->tls_config == t.tls_config &&
            SocketTransportDescriptor::operator ==(t));
@@ -211,6 +227,12 @@ void TCPTransportInterface::clean()
         io_service_thread_->join();
         io_service_thread_ = nullptr;
     }
+
+    for (auto& reactor_thread : reactor_threads_)
+    {
+        reactor_thread.join();
+    }
+    reactor_threads_.clear();
 }
 
 void TCPTransportInterface::bind_socket(
@@ -241,13 +263,15 @@ bool TCPTransportInterface::check_crc(
 
 void TCPTransportInterface::calculate_crc(
         TCPHeader& header,
-        const octet* data,
-        uint32_t size) const
+        const std::vector<fastrtps::rtps::NetworkBuffer>& buffers) const
 {
     uint32_t crc(0);
-    for (uint32_t i = 0; i < size; ++i)
+    for (const fastrtps::rtps::NetworkBuffer& buffer : buffers)
     {
-        crc = RTCPMessageManager::addToCRC(crc, data[i]);
+        for (uint32_t i = 0; i < buffer.size; ++i)
+        {
+            crc = RTCPMessageManager::addToCRC(crc, buffer.buffer[i]);
+        }
     }
     header.crc = crc;
 }
@@ -327,15 +351,15 @@ bool TCPTransportInterface::create_acceptor_socket(
 
 void TCPTransportInterface::fill_rtcp_header(
         TCPHeader& header,
-        const octet* send_buffer,
-        uint32_t send_buffer_size,
+        const std::vector<fastrtps::rtps::NetworkBuffer>& buffers,
+        uint32_t total_bytes,
         uint16_t logical_port) const
 {
-    header.length = send_buffer_size + static_cast<uint32_t>(TCPHeader::size());
+    header.length = total_bytes + static_cast<uint32_t>(TCPHeader::size());
     header.logical_port = logical_port;
     if (configuration()->calculate_crc)
     {
-        calculate_crc(header, send_buffer, send_buffer_size);
+        calculate_crc(header, buffers);
     }
 }
 
@@ -419,6 +443,15 @@ bool TCPTransportInterface::init()
             };
     io_service_thread_ = std::make_shared<std::thread>(ioServiceFunction);
 
+    // On reactor mode, the io_service thread is one of the threads multiplexing the reception
+    if (uses_reactor())
+    {
+        for (uint32_t i = 1; i < configuration()->reactor_threads; ++i)
+        {
+            reactor_threads_.emplace_back(ioServiceFunction);
+        }
+    }
+
     if (0 < configuration()->keep_alive_frequency_ms)
     {
         io_service_timers_thread_ = std::make_shared<std::thread>([&]()
@@ -664,7 +697,7 @@ bool TCPTransportInterface::OpenOutputChannel(
 #endif // if TLS_FOUND
                 static_cast<TCPChannelResource*>(
                     new TCPChannelResourceBasic(this, io_service_, physical_locator,
-                    configuration()->maxMessageSize))
+                    channel_receive_buffer_size()))
                 );
 
             channel_resources_[physical_locator] = channel;
@@ -764,14 +797,12 @@ void TCPTransportInterface::keep_alive()
      */
 }
 
-void TCPTransportInterface::perform_listen_operation(
-        std::weak_ptr<TCPChannelResource> channel_weak,
-        std::weak_ptr<RTCPMessageManager> rtcp_manager)
+bool TCPTransportInterface::begin_listen_operation(
+        std::weak_ptr<TCPChannelResource>& channel_weak,
+        std::weak_ptr<RTCPMessageManager>& rtcp_manager,
+        std::shared_ptr<TCPChannelResource>& channel)
 {
-    Locator remote_locator;
-    uint16_t logicalPort(0);
     std::shared_ptr<RTCPMessageManager> rtcp_message_manager;
-    std::shared_ptr<TCPChannelResource> channel;
     rtcp_message_manager = rtcp_manager.lock();
 
     // RTCP Control Message
@@ -794,8 +825,48 @@ void TCPTransportInterface::perform_listen_operation(
         std::unique_lock<std::mutex> lock(rtcp_message_manager_mutex_);
         rtcp_message_manager.reset();
         rtcp_message_manager_cv_.notify_one();
+
+        return nullptr != channel;
+    }
+
+    return false;
+}
+
+void TCPTransportInterface::deliver_received_message(
+        std::shared_ptr<TCPChannelResource>& channel,
+        const CDRMessage_t& msg,
+        const Locator& remote_locator)
+{
+    // Processes the data through the CDR Message interface.
+    uint16_t logicalPort = IPLocator::getLogicalPort(remote_locator);
+    std::unique_lock<std::mutex> scopedLock(sockets_map_mutex_);
+    auto it = receiver_resources_.find(logicalPort);
+    //TransportReceiverInterface* receiver = channel->GetMessageReceiver(logicalPort);
+    if (it != receiver_resources_.end())
+    {
+        TransportReceiverInterface* receiver = it->second.first;
+        ReceiverInUseCV* receiver_in_use = it->second.second;
+        receiver_in_use->in_use = true;
+        scopedLock.unlock();
+        receiver->OnDataReceived(msg.buffer, msg.length, channel->locator(), remote_locator);
+        scopedLock.lock();
+        receiver_in_use->in_use = false;
+        receiver_in_use->cv.notify_one();
     }
     else
+    {
+        logWarning(RTCP, "Received Message, but no TransportReceiverInterface attached: " << logicalPort);
+    }
+}
+
+void TCPTransportInterface::perform_listen_operation(
+        std::weak_ptr<TCPChannelResource> channel_weak,
+        std::weak_ptr<RTCPMessageManager> rtcp_manager)
+{
+    Locator remote_locator;
+    std::shared_ptr<TCPChannelResource> channel;
+
+    if (!begin_listen_operation(channel_weak, rtcp_manager, channel))
     {
         return;
     }
@@ -812,32 +883,273 @@ void TCPTransportInterface::perform_listen_operation(
 
         if (TCPChannelResource::eConnectionStatus::eConnecting < channel->connection_status())
         {
-            // Processes the data through the CDR Message interface.
-            logicalPort = IPLocator::getLogicalPort(remote_locator);
-            std::unique_lock<std::mutex> scopedLock(sockets_map_mutex_);
-            auto it = receiver_resources_.find(logicalPort);
-            //TransportReceiverInterface* receiver = channel->GetMessageReceiver(logicalPort);
-            if (it != receiver_resources_.end())
+            deliver_received_message(channel, msg, remote_locator);
+        }
+    }
+
+    logInfo(RTCP, "End PerformListenOperation " << channel->locator());
+}
+
+void TCPTransportInterface::start_listen_operation(
+        const std::shared_ptr<TCPChannelResource>& channel)
+{
+    std::weak_ptr<TCPChannelResource> channel_weak_ptr = channel;
+    std::weak_ptr<RTCPMessageManager> rtcp_manager_weak_ptr = rtcp_message_manager_;
+
+    if (uses_reactor())
+    {
+        // The RTCP negotiation writes on the socket, so it is not done inside the connection handlers.
+        io_service_.post([this, channel_weak_ptr, rtcp_manager_weak_ptr]()
+                {
+                    perform_async_listen_operation(channel_weak_ptr, rtcp_manager_weak_ptr);
+                });
+    }
+    else
+    {
+        channel->thread(std::thread(&TCPTransportInterface::perform_listen_operation, this,
+                channel_weak_ptr, rtcp_manager_weak_ptr));
+    }
+}
+
+void TCPTransportInterface::perform_async_listen_operation(
+        std::weak_ptr<TCPChannelResource> channel_weak,
+        std::weak_ptr<RTCPMessageManager> rtcp_manager)
+{
+    std::shared_ptr<TCPChannelResource> channel;
+
+    if (begin_listen_operation(channel_weak, rtcp_manager, channel))
+    {
+        auto state = std::make_shared<AsyncReceiveState>();
+        state->channel = channel;
+        state->rtcp_manager = rtcp_manager;
+        async_receive_header(state);
+    }
+}
+
+/**
+ * Returns the number of bytes to discard from the beginning of a partially received header
+ * in order to keep it aligned with the next possible 'RTCP' synchronization word.
+ */
+static size_t rtcp_sync_offset(
+        const octet* data,
+        size_t size)
+{
+    static const octet sync[4] = { 'R', 'T', 'C', 'P' };
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        size_t to_compare = std::min<size_t>(sizeof(sync), size - i);
+        if (0 == memcmp(&data[i], sync, to_compare))
+        {
+            return i;
+        }
+    }
+
+    return size;
+}
+
+void TCPTransportInterface::async_receive_header(
+        const std::shared_ptr<AsyncReceiveState>& state)
+{
+    std::shared_ptr<TCPChannelResource> channel = state->channel.lock();
+    if (!alive_.load() || !channel ||
+            TCPChannelResource::eConnectionStatus::eConnecting >= channel->connection_status())
+    {
+        end_async_listen_operation(state, channel, asio::error_code());
+        return;
+    }
+
+    TCPChannelResourceBasic* basic_channel = static_cast<TCPChannelResourceBasic*>(channel.get());
+    octet* header = state->header.address();
+
+    basic_channel->async_read(header + state->header_bytes, TCPHeader::size() - state->header_bytes,
+            [this, state, header](const asio::error_code& ec, std::size_t bytes_read)
             {
-                TransportReceiverInterface* receiver = it->second.first;
-                ReceiverInUseCV* receiver_in_use = it->second.second;
-                receiver_in_use->in_use = true;
-                scopedLock.unlock();
-                receiver->OnDataReceived(msg.buffer, msg.length, channel->locator(), remote_locator);
-                scopedLock.lock();
-                receiver_in_use->in_use = false;
-                receiver_in_use->cv.notify_one();
-            }
-            else
+                if (ec)
+                {
+                    std::shared_ptr<TCPChannelResource> channel = state->channel.lock();
+                    end_async_listen_operation(state, channel, ec);
+                    return;
+                }
+
+                state->header_bytes += bytes_read;
+                size_t skip = rtcp_sync_offset(header, state->header_bytes);
+                if (0 < skip)
+                {
+                    // Wait for sync
+                    memmove(header, &header[skip], state->header_bytes - skip);
+                    state->header_bytes -= skip;
+                    async_receive_header(state);
+                    return;
+                }
+
+                state->header_bytes = 0;
+                async_receive_body(state);
+            });
+}
+
+void TCPTransportInterface::async_receive_body(
+        const std::shared_ptr<AsyncReceiveState>& state)
+{
+    if (state->header.length < TCPHeader::size())
+    {
+        logWarning(RTCP_MSG_IN, "Bad TCP header length: " << state->header.length);
+        async_receive_header(state);
+        return;
+    }
+
+    uint32_t body_size = state->header.length - static_cast<uint32_t>(TCPHeader::size());
+    state->buffer = get_receive_buffer();
+
+    if (body_size > state->buffer->max_size)
+    {
+        logError(RTCP_MSG_IN, "Size of incoming TCP message is bigger than buffer capacity: "
+                << body_size << " vs. " << state->buffer->max_size << ". "
+                << "The full message will be dropped.");
+        state->pending_discard = body_size;
+        async_discard_body(state);
+        return;
+    }
+
+    logInfo(RTCP_MSG_IN, "Received RTCP MSG. Logical Port " << state->header.logical_port);
+    std::shared_ptr<TCPChannelResource> channel = state->channel.lock();
+    if (!alive_.load() || !channel)
+    {
+        end_async_listen_operation(state, channel, asio::error_code());
+        return;
+    }
+
+    TCPChannelResourceBasic* basic_channel = static_cast<TCPChannelResourceBasic*>(channel.get());
+    basic_channel->async_read(state->buffer->buffer, body_size,
+            [this, state](const asio::error_code& ec, std::size_t bytes_read)
             {
-                logWarning(RTCP, "Received Message, but no TransportReceiverInterface attached: " << logicalPort);
-            }
+                std::shared_ptr<TCPChannelResource> channel = state->channel.lock();
+                if (ec || !alive_.load() || !channel)
+                {
+                    end_async_listen_operation(state, channel, ec);
+                    return;
+                }
+
+                CDRMessage_t& msg = *state->buffer;
+                msg.length = static_cast<uint32_t>(bytes_read);
+
+                try
+                {
+                    Locator remote_locator;
+                    if (process_received_message(state->rtcp_manager, channel, state->header,
+                    msg.buffer, msg.length, remote_locator) && 0 < msg.length &&
+                    TCPChannelResource::eConnectionStatus::eConnecting < channel->connection_status())
+                    {
+                        deliver_received_message(channel, msg, remote_locator);
+                    }
+                }
+                catch (const asio::system_error& error)
+                {
+                    (void)error;
+                    logError(RTCP_MSG_IN, "ASIO SYSTEM_ERROR [RECEIVE]: " << error.what());
+                    end_async_listen_operation(state, channel, error.code());
+                    return;
+                }
+
+                return_receive_buffer(std::move(state->buffer));
+                async_receive_header(state);
+            });
+}
+
+void TCPTransportInterface::async_discard_body(
+        const std::shared_ptr<AsyncReceiveState>& state)
+{
+    if (0 == state->pending_discard)
+    {
+        return_receive_buffer(std::move(state->buffer));
+        async_receive_header(state);
+        return;
+    }
+
+    std::shared_ptr<TCPChannelResource> channel = state->channel.lock();
+    if (!alive_.load() || !channel)
+    {
+        end_async_listen_operation(state, channel, asio::error_code());
+        return;
+    }
+
+    size_t read_block = std::min<size_t>(state->pending_discard, state->buffer->max_size);
+    TCPChannelResourceBasic* basic_channel = static_cast<TCPChannelResourceBasic*>(channel.get());
+    basic_channel->async_read(state->buffer->buffer, read_block,
+            [this, state](const asio::error_code& ec, std::size_t bytes_read)
+            {
+                if (ec)
+                {
+                    std::shared_ptr<TCPChannelResource> channel = state->channel.lock();
+                    end_async_listen_operation(state, channel, ec);
+                    return;
+                }
+
+                state->pending_discard -= bytes_read;
+                async_discard_body(state);
+            });
+}
+
+void TCPTransportInterface::end_async_listen_operation(
+        const std::shared_ptr<AsyncReceiveState>& state,
+        std::shared_ptr<TCPChannelResource>& channel,
+        const asio::error_code& ec)
+{
+    if (state->buffer)
+    {
+        return_receive_buffer(std::move(state->buffer));
+    }
+
+    // The reception state does not keep the channel alive once its reception ends
+    state->channel.reset();
+
+    if (!channel)
+    {
+        logInfo(RTCP, "End PerformListenOperation on a released channel");
+        return;
+    }
+
+    if (ec && alive_.load())
+    {
+        if (ec != asio::error::eof && ec != asio::error::operation_aborted)
+        {
+            logWarning(DEBUG, "Error reading TCP channel: " << ec.message());
         }
+        close_tcp_socket(channel);
     }
 
     logInfo(RTCP, "End PerformListenOperation " << channel->locator());
 }
 
+std::unique_ptr<CDRMessage_t> TCPTransportInterface::get_receive_buffer()
+{
+    std::unique_ptr<CDRMessage_t> buffer;
+
+    {
+        std::lock_guard<std::mutex> lock(receive_buffers_mutex_);
+        if (!receive_buffers_.empty())
+        {
+            buffer = std::move(receive_buffers_.back());
+            receive_buffers_.pop_back();
+        }
+    }
+
+    if (!buffer)
+    {
+        buffer.reset(new CDRMessage_t(configuration()->maxMessageSize));
+    }
+
+    fastrtps::rtps::CDRMessage::initCDRMsg(buffer.get());
+    return buffer;
+}
+
+void TCPTransportInterface::return_receive_buffer(
+        std::unique_ptr<CDRMessage_t>&& buffer)
+{
+    std::lock_guard<std::mutex> lock(receive_buffers_mutex_);
+    receive_buffers_.push_back(std::move(buffer));
+}
+
 bool TCPTransportInterface::read_body(
         octet* receive_buffer,
         uint32_t,
@@ -996,51 +1308,8 @@ bool TCPTransportInterface::Receive(
 
                 if (success)
                 {
-                    if (configuration()->check_crc
-                            && !check_crc(tcp_header, receive_buffer, receive_buffer_size))
-                    {
-                        logWarning(RTCP_MSG_IN, "Bad TCP header CRC");
-                    }
-
-                    if (tcp_header.logical_port == 0)
-                    {
-                        std::shared_ptr<RTCPMessageManager> rtcp_message_manager;
-                        if (TCPChannelResource::eConnectionStatus::eDisconnected != channel->connection_status())
-
-                        {
-                            std::unique_lock<std::mutex> lock(rtcp_message_manager_mutex_);
-                            rtcp_message_manager = rtcp_manager.lock();
-                        }
-
-                        if (rtcp_message_manager)
-                        {
-                            // The channel is not going to be deleted because we lock it for reading.
-                            ResponseCode responseCode = rtcp_message_manager->processRTCPMessage(
-                                channel, receive_buffer, body_size);
-
-                            if (responseCode != RETCODE_OK)
-                            {
-                                close_tcp_socket(channel);
-                            }
-                            success = false;
-
-                            std::unique_lock<std::mutex> lock(rtcp_message_manager_mutex_);
-                            rtcp_message_manager.reset();
-                            rtcp_message_manager_cv_.notify_one();
-                        }
-                        else
-                        {
-                            success = false;
-                            close_tcp_socket(channel);
-                        }
-
-                    }
-                    else
-                    {
-                        IPLocator::setLogicalPort(remote_locator, tcp_header.logical_port);
-                        logInfo(RTCP_MSG_IN, "[RECEIVE] From: " << remote_locator \
-                                                                << " - " << receive_buffer_size << " bytes.");
-                    }
+                    success = process_received_message(rtcp_manager, channel, tcp_header, receive_buffer,
+                                    receive_buffer_size, remote_locator);
                 }
                 // Error message already shown by read_body method.
             }
@@ -1072,12 +1341,84 @@ bool TCPTransportInterface::Receive(
     return success;
 }
 
+bool TCPTransportInterface::process_received_message(
+        std::weak_ptr<RTCPMessageManager>& rtcp_manager,
+        std::shared_ptr<TCPChannelResource>& channel,
+        const TCPHeader& tcp_header,
+        octet* receive_buffer,
+        uint32_t receive_buffer_size,
+        Locator& remote_locator)
+{
+    bool success = true;
+
+    if (configuration()->check_crc
+            && !check_crc(tcp_header, receive_buffer, receive_buffer_size))
+    {
+        logWarning(RTCP_MSG_IN, "Bad TCP header CRC");
+    }
+
+    if (tcp_header.logical_port == 0)
+    {
+        std::shared_ptr<RTCPMessageManager> rtcp_message_manager;
+        if (TCPChannelResource::eConnectionStatus::eDisconnected != channel->connection_status())
+
+        {
+            std::unique_lock<std::mutex> lock(rtcp_message_manager_mutex_);
+            rtcp_message_manager = rtcp_manager.lock();
+        }
+
+        if (rtcp_message_manager)
+        {
+            // The channel is not going to be deleted because we lock it for reading.
+            ResponseCode responseCode = rtcp_message_manager->processRTCPMessage(
+                channel, receive_buffer, receive_buffer_size);
+
+            if (responseCode != RETCODE_OK)
+            {
+                close_tcp_socket(channel);
+            }
+            success = false;
+
+            std::unique_lock<std::mutex> lock(rtcp_message_manager_mutex_);
+            rtcp_message_manager.reset();
+            rtcp_message_manager_cv_.notify_one();
+        }
+        else
+        {
+            success = false;
+            close_tcp_socket(channel);
+        }
+
+    }
+    else
+    {
+        IPLocator::setLogicalPort(remote_locator, tcp_header.logical_port);
+        logInfo(RTCP_MSG_IN, "[RECEIVE] From: " << remote_locator \
+                                                << " - " << receive_buffer_size << " bytes.");
+    }
+
+    return success;
+}
+
 bool TCPTransportInterface::send(
         const octet* send_buffer,
         uint32_t send_buffer_size,
         std::shared_ptr<TCPChannelResource>& channel,
         fastrtps::rtps::LocatorsIterator* destination_locators_begin,
         fastrtps::rtps::LocatorsIterator* destination_locators_end)
+{
+    const std::vector<fastrtps::rtps::NetworkBuffer> buffers{
+        fastrtps::rtps::NetworkBuffer(send_buffer, send_buffer_size)};
+
+    return send(buffers, send_buffer_size, channel, destination_locators_begin, destination_locators_end);
+}
+
+bool TCPTransportInterface::send(
+        const std::vector<fastrtps::rtps::NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        std::shared_ptr<TCPChannelResource>& channel,
+        fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+        fastrtps::rtps::LocatorsIterator* destination_locators_end)
 {
     fastrtps::rtps::LocatorsIterator& it = *destination_locators_begin;
 
@@ -1087,7 +1428,7 @@ bool TCPTransportInterface::send(
     {
         if (IsLocatorSupported(*it))
         {
-            ret &= send(send_buffer, send_buffer_size, channel, *it);
+            ret &= send(buffers, total_bytes, channel, *it);
         }
 
         ++it;
@@ -1097,8 +1438,8 @@ bool TCPTransportInterface::send(
 }
 
 bool TCPTransportInterface::send(
-        const octet* send_buffer,
-        uint32_t send_buffer_size,
+        const std::vector<fastrtps::rtps::NetworkBuffer>& buffers,
+        uint32_t total_bytes,
         std::shared_ptr<TCPChannelResource>& channel,
         const Locator& remote_locator)
 {
@@ -1125,7 +1466,7 @@ bool TCPTransportInterface::send(
         }
     }
 
-    if (locator_mismatch || send_buffer_size > configuration()->sendBufferSize)
+    if (locator_mismatch || total_bytes > configuration()->sendBufferSize)
     {
         //std::cout << "ChannelLocator: " << IPLocator::to_string(channel->locator()) << std::endl;
         //std::cout << "RemoteLocator: " << IPLocator::to_string(remote_locator) << std::endl;
@@ -1158,22 +1499,27 @@ bool TCPTransportInterface::send(
             if (channel->is_logical_port_opened(logical_port))
             {
                 TCPHeader tcp_header;
-                statistics_info_.set_statistics_message_data(remote_locator, send_buffer, send_buffer_size);
-                fill_rtcp_header(tcp_header, send_buffer, send_buffer_size, logical_port);
+                // Gather sends are not used when statistics are enabled, so the statistics submessage is always
+                // on a single slice.
+                if (1 == buffers.size())
+                {
+                    statistics_info_.set_statistics_message_data(remote_locator, buffers[0].buffer, total_bytes);
+                }
+                fill_rtcp_header(tcp_header, buffers, total_bytes, logical_port);
 
                 {
                     asio::error_code ec;
                     size_t sent = channel->send(
                         (octet*)&tcp_header,
                         static_cast<uint32_t>(TCPHeader::size()),
-                        send_buffer,
-                        send_buffer_size,
+                        buffers,
+                        total_bytes,
                         ec);
 
-                    if (sent != static_cast<uint32_t>(TCPHeader::size() + send_buffer_size) || ec)
+                    if (sent != static_cast<uint32_t>(TCPHeader::size() + total_bytes) || ec)
                     {
                         logWarning(DEBUG, "Failed to send RTCP message (" << sent << " of " <<
-                                TCPHeader::size() + send_buffer_size << " b): " << ec.message());
+                                TCPHeader::size() + total_bytes << " b): " << ec.message());
                         success = false;
                     }
                     else
@@ -1238,7 +1584,7 @@ void TCPTransportInterface::SocketAccepted(
         {
             // Store the new connection.
             std::shared_ptr<TCPChannelResource> channel(new TCPChannelResourceBasic(this,
-                    io_service_, socket, configuration()->maxMessageSize));
+                    io_service_, socket, channel_receive_buffer_size()));
 
             {
                 std::unique_lock<std::mutex> unbound_lock(unbound_map_mutex_);
@@ -1246,10 +1592,7 @@ void TCPTransportInterface::SocketAccepted(
             }
 
             channel->set_options(configuration());
-            std::weak_ptr<TCPChannelResource> channel_weak_ptr = channel;
-            std::weak_ptr<RTCPMessageManager> rtcp_manager_weak_ptr = rtcp_message_manager_;
-            channel->thread(std::thread(&TCPTransportInterface::perform_listen_operation, this,
-                    channel_weak_ptr, rtcp_manager_weak_ptr));
+            start_listen_operation(channel);
 
             logInfo(RTCP, " Accepted connection (local: " << IPLocator::to_string(locator)
                                                           << ", remote: " << channel->remote_endpoint().address()
@@ -1337,10 +1680,7 @@ void TCPTransportInterface::SocketConnected(
                 {
                     channel->change_status(TCPChannelResource::eConnectionStatus::eConnected);
                     channel->set_options(configuration());
-
-                    std::weak_ptr<RTCPMessageManager> rtcp_manager_weak_ptr = rtcp_message_manager_;
-                    channel->thread(std::thread(&TCPTransportInterface::perform_listen_operation, this,
-                            channel_weak_ptr, rtcp_manager_weak_ptr));
+                    start_listen_operation(channel);
                 }
             }
             else
@@ -15,6 +15,7 @@
 #ifndef _FASTDDS_TCP_TRANSPORT_INTERFACE_H_
 #define _FASTDDS_TCP_TRANSPORT_INTERFACE_H_
 
+#include <fastdds/rtps/common/NetworkBuffer.hpp>
 #include <fastdds/rtps/transport/TransportInterface.h>
 #include <fastdds/rtps/transport/TCPTransportDescriptor.h>
 #include <fastrtps/utils/IPFinder.h>
@@ -68,6 +69,18 @@ class TCPTransportInterface : public TransportInterface
         std::condition_variable cv;
     };
 
+    //! Reception progress of a channel whose reception is multiplexed on the reactor threads.
+    struct AsyncReceiveState
+    {
+        //! Not owned, so pending handlers do not keep the channel alive after the transport is cleaned.
+        std::weak_ptr<TCPChannelResource> channel;
+        std::weak_ptr<RTCPMessageManager> rtcp_manager;
+        TCPHeader header;
+        size_t header_bytes = 0;
+        std::unique_ptr<fastrtps::rtps::CDRMessage_t> buffer;
+        size_t pending_discard = 0;
+    };
+
     std::atomic<bool> alive_;
 
 protected:
@@ -80,6 +93,11 @@ protected:
 #endif // if TLS_FOUND
     std::shared_ptr<std::thread> io_service_thread_;
     std::shared_ptr<std::thread> io_service_timers_thread_;
+    //! Threads running io_service_ along with io_service_thread_ on reactor mode.
+    std::vector<std::thread> reactor_threads_;
+    //! Reception buffers shared by all the channels on reactor mode.
+    std::vector<std::unique_ptr<fastrtps::rtps::CDRMessage_t>> receive_buffers_;
+    std::mutex receive_buffers_mutex_;
     std::shared_ptr<RTCPMessageManager> rtcp_message_manager_;
     std::mutex rtcp_message_manager_mutex_;
     std::condition_variable rtcp_message_manager_cv_;
@@ -121,13 +139,12 @@ protected:
 
     void calculate_crc(
             TCPHeader& header,
-            const fastrtps::rtps::octet* data,
-            uint32_t size) const;
+            const std::vector<fastrtps::rtps::NetworkBuffer>& buffers) const;
 
     void fill_rtcp_header(
             TCPHeader& header,
-            const fastrtps::rtps::octet* send_buffer,
-            uint32_t send_buffer_size,
+            const std::vector<fastrtps::rtps::NetworkBuffer>& buffers,
+            uint32_t total_bytes,
             uint16_t logical_port) const;
 
     //! Closes the given p_channel_resource and unbind it from every resource.
@@ -150,6 +167,67 @@ protected:
             std::weak_ptr<TCPChannelResource> channel,
             std::weak_ptr<RTCPMessageManager> rtcp_manager);
 
+    //! Starts the RTCP negotiation of a channel. Returns false if the channel should not be listened.
+    bool begin_listen_operation(
+            std::weak_ptr<TCPChannelResource>& channel_weak,
+            std::weak_ptr<RTCPMessageManager>& rtcp_manager,
+            std::shared_ptr<TCPChannelResource>& channel);
+
+    //! Starts the reception on a channel, either on a dedicated thread or on the reactor threads.
+    void start_listen_operation(
+            const std::shared_ptr<TCPChannelResource>& channel);
+
+    //! Whether the reception on basic channels is multiplexed on the reactor threads.
+    bool uses_reactor() const
+    {
+        return 0 < configuration()->reactor_threads && !configuration()->apply_security;
+    }
+
+    //! Size of the reception buffer owned by each new channel.
+    uint32_t channel_receive_buffer_size() const
+    {
+        return uses_reactor() ? 0u : configuration()->maxMessageSize;
+    }
+
+    //! Reactor counterpart of perform_listen_operation, based on chained asynchronous reads.
+    void perform_async_listen_operation(
+            std::weak_ptr<TCPChannelResource> channel,
+            std::weak_ptr<RTCPMessageManager> rtcp_manager);
+
+    void async_receive_header(
+            const std::shared_ptr<AsyncReceiveState>& state);
+
+    void async_receive_body(
+            const std::shared_ptr<AsyncReceiveState>& state);
+
+    void async_discard_body(
+            const std::shared_ptr<AsyncReceiveState>& state);
+
+    void end_async_listen_operation(
+            const std::shared_ptr<AsyncReceiveState>& state,
+            std::shared_ptr<TCPChannelResource>& channel,
+            const asio::error_code& ec);
+
+    std::unique_ptr<fastrtps::rtps::CDRMessage_t> get_receive_buffer();
+
+    void return_receive_buffer(
+            std::unique_ptr<fastrtps::rtps::CDRMessage_t>&& buffer);
+
+    //! Processes the RTCP header of a received message. Returns true if the message should be delivered.
+    bool process_received_message(
+            std::weak_ptr<RTCPMessageManager>& rtcp_manager,
+            std::shared_ptr<TCPChannelResource>& channel,
+            const TCPHeader& tcp_header,
+            fastrtps::rtps::octet* receive_buffer,
+            uint32_t receive_buffer_size,
+            Locator& remote_locator);
+
+    //! Delivers a received RTPS message to the receiver attached to its logical port.
+    void deliver_received_message(
+            std::shared_ptr<TCPChannelResource>& channel,
+            const fastrtps::rtps::CDRMessage_t& msg,
+            const Locator& remote_locator);
+
     bool read_body(
             fastrtps::rtps::octet* receive_buffer,
             uint32_t receive_buffer_capacity,
@@ -184,11 +262,11 @@ protected:
     std::string get_password() const;
 
     /**
-     * Send a buffer to a destination
+     * Send a message made of several slices to a destination
      */
     bool send(
-            const fastrtps::rtps::octet* send_buffer,
-            uint32_t send_buffer_size,
+            const std::vector<fastrtps::rtps::NetworkBuffer>& buffers,
+            uint32_t total_bytes,
             std::shared_ptr<TCPChannelResource>& channel,
             const Locator& remote_locator);
 
@@ -336,6 +414,24 @@ public:
             fastrtps::rtps::LocatorsIterator* destination_locators_begin,
             fastrtps::rtps::LocatorsIterator* destination_locators_end);
 
+    /**
+     * Blocking Send of a message made of several slices through the specified channel.
+     * The slices are written to the socket after the TCP header without copying them into a contiguous buffer.
+     * @param buffers List of slices composing the message.
+     * @param total_bytes Sum of the sizes of all the slices.
+     * @param channel channel we're sending from.
+     * @param destination_locators_begin pointer to destination locators iterator begin, the iterator can be advanced inside this fuction
+     * so should not be reuse.
+     * @param destination_locators_end pointer to destination locators iterator end, the iterator can be advanced inside this fuction
+     * so should not be reuse.
+     */
+    bool send(
+            const std::vector<fastrtps::rtps::NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            std::shared_ptr<TCPChannelResource>& channel,
+            fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+            fastrtps::rtps::LocatorsIterator* destination_locators_end);
+
     /**
      * Performs the locator selection algorithm for this transport.
      *
@@ -53,6 +53,17 @@ public:
                     return transport.send(data, dataSize, socket_, destination_locators_begin,
                                    destination_locators_end, only_multicast_purpose_, max_blocking_time_point);
                 };
+
+        send_buffers_lambda_ = [this, &transport](
+            const std::vector<fastrtps::rtps::NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+            fastrtps::rtps::LocatorsIterator* destination_locators_end,
+            const std::chrono::steady_clock::time_point& max_blocking_time_point) -> bool
+                {
+                    return transport.send(buffers, total_bytes, socket_, destination_locators_begin,
+                                   destination_locators_end, only_multicast_purpose_, max_blocking_time_point);
+                };
     }
 
     virtual ~UDPSenderResource()
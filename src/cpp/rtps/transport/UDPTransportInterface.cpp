@@ -17,6 +17,7 @@
 #include <utility>
 #include <cstring>
 #include <algorithm>
+#include <array>
 #include <chrono>
 
 #include <fastdds/rtps/transport/TransportInterface.h>
@@ -42,6 +43,48 @@ using PortParameters = fastrtps::rtps::PortParameters;
 using SenderResource = fastrtps::rtps::SenderResource;
 using Log = fastdds::dds::Log;
 
+//! asio ignores the slices beyond its scatter / gather limit, so longer lists are sent from a contiguous copy.
+static constexpr size_t max_gather_slices = 64;
+
+/**
+ * Buffer sequence handed to asio for a gather send.
+ * It is kept on the stack, so sending the slices of a message doesn't allocate.
+ */
+class GatherBufferSequence
+{
+public:
+
+    typedef asio::const_buffer value_type;
+    typedef const asio::const_buffer* const_iterator;
+
+    explicit GatherBufferSequence(
+            const std::vector<fastrtps::rtps::NetworkBuffer>& buffers)
+        : count_(buffers.size())
+    {
+        assert(count_ <= max_gather_slices);
+        for (size_t i = 0; i < count_; ++i)
+        {
+            buffers_[i] = asio::const_buffer(buffers[i].buffer, buffers[i].size);
+        }
+    }
+
+    const_iterator begin() const
+    {
+        return buffers_.data();
+    }
+
+    const_iterator end() const
+    {
+        return buffers_.data() + count_;
+    }
+
+private:
+
+    std::array<asio::const_buffer, max_gather_slices> buffers_;
+
+    size_t count_;
+};
+
 UDPTransportDescriptor::UDPTransportDescriptor()
     : SocketTransportDescriptor(s_maximumMessageSize, s_maximumInitialPeersRange)
     , m_output_udp_socket(0)
@@ -549,6 +592,112 @@ bool UDPTransportInterface::send(
     return success;
 }
 
+bool UDPTransportInterface::send(
+        const std::vector<fastrtps::rtps::NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        eProsimaUDPSocket& socket,
+        fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+        fastrtps::rtps::LocatorsIterator* destination_locators_end,
+        bool only_multicast_purpose,
+        const std::chrono::steady_clock::time_point& max_blocking_time_point)
+{
+    fastrtps::rtps::LocatorsIterator& it = *destination_locators_begin;
+
+    bool ret = true;
+
+    auto time_out = std::chrono::duration_cast<std::chrono::microseconds>(
+        max_blocking_time_point - std::chrono::steady_clock::now());
+
+    while (it != *destination_locators_end)
+    {
+        if (IsLocatorSupported(*it))
+        {
+            ret &= send(buffers,
+                            total_bytes,
+                            socket,
+                            *it,
+                            only_multicast_purpose,
+                            time_out);
+        }
+
+        ++it;
+    }
+
+    return ret;
+}
+
+bool UDPTransportInterface::send(
+        const std::vector<fastrtps::rtps::NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        eProsimaUDPSocket& socket,
+        const Locator& remote_locator,
+        bool only_multicast_purpose,
+        const std::chrono::microseconds& timeout)
+{
+    if (total_bytes > configuration()->sendBufferSize)
+    {
+        return false;
+    }
+
+    if (buffers.size() > max_gather_slices)
+    {
+        std::vector<octet> data(total_bytes);
+        fastrtps::rtps::copy_network_buffers(buffers, data.data());
+        return send(data.data(), total_bytes, socket, remote_locator, only_multicast_purpose, timeout);
+    }
+
+    bool success = false;
+    bool is_multicast_remote_address = IPLocator::isMulticast(remote_locator);
+
+    if (is_multicast_remote_address || !only_multicast_purpose)
+    {
+        auto destinationEndpoint = generate_endpoint(remote_locator, IPLocator::getPhysicalPort(remote_locator));
+
+        GatherBufferSequence asio_buffers(buffers);
+
+        size_t bytesSent = 0;
+
+        try
+        {
+#ifndef _WIN32
+            struct timeval timeStruct;
+            timeStruct.tv_sec = 0;
+            timeStruct.tv_usec = timeout.count() > 0 ? timeout.count() : 0;
+            setsockopt(getSocketPtr(socket)->native_handle(), SOL_SOCKET, SO_SNDTIMEO,
+                    reinterpret_cast<const char*>(&timeStruct), sizeof(timeStruct));
+#endif // ifndef _WIN32
+
+            // Gather sends are not used when the statistics submessage has to be filled in by the transport.
+            asio::error_code ec;
+            bytesSent = getSocketPtr(socket)->send_to(asio_buffers, destinationEndpoint, 0, ec);
+            if (!!ec)
+            {
+                if ((ec.value() == asio::error::would_block) ||
+                        (ec.value() == asio::error::try_again))
+                {
+                    logWarning(RTPS_MSG_OUT, "UDP send would have blocked. Packet is dropped.");
+                    return true;
+                }
+
+                logWarning(RTPS_MSG_OUT, ec.message());
+                return false;
+            }
+        }
+        catch (const std::exception& error)
+        {
+            logWarning(RTPS_MSG_OUT, error.what());
+            return false;
+        }
+
+        (void)bytesSent;
+        logInfo(RTPS_MSG_OUT, "UDPTransport: " << bytesSent << " bytes TO endpoint: " << destinationEndpoint
+                                               << " FROM " << getSocketPtr(socket)->local_endpoint());
+        success = true;
+    }
+
+    return success;
+}
+
 /**
  * Invalidate all selector entries containing certain multicast locator.
  *
@@ -73,13 +73,22 @@ public:
     typedef MultiProducerConsumerRingBuffer<BufferDescriptor>::Listener Listener;
     typedef MultiProducerConsumerRingBuffer<BufferDescriptor>::Cell PortCell;
 
-    static const uint32_t CURRENT_ABI_VERSION = 5;
+    static const uint32_t CURRENT_ABI_VERSION = 6;
 
     struct PortNode
     {
         alignas(8) std::atomic<std::chrono::high_resolution_clock::rep> last_listeners_status_check_time_ms;
         alignas(8) std::atomic<uint32_t> ref_counter;
 
+        // Number of Port instances opened in Write mode (producers)
+        alignas(8) std::atomic<uint32_t> num_writers;
+        // Number of try_push() operations in progress that do not hold empty_cv_mutex
+        alignas(8) std::atomic<uint32_t> lock_free_pushes;
+        // Non zero while a listener is being registered / unregistered
+        alignas(8) std::atomic<uint32_t> listeners_updating;
+        // Number of listeners blocked on empty_cv
+        alignas(8) std::atomic<uint32_t> sleeping_listeners;
+
         SharedMemSegment::Offset buffer;
         SharedMemSegment::Offset buffer_node;
 
@@ -150,6 +159,8 @@ public:
 
         uint64_t overflows_count_;
 
+        bool is_writer_;
+
         std::unique_ptr<RobustExclusiveLock> read_exclusive_lock_;
         std::unique_ptr<RobustSharedLock> read_shared_lock_;
 
@@ -167,6 +178,103 @@ public:
             node_->empty_cv.notify_all();
         }
 
+        /**
+         * The lock-free path is only taken on unicast ports (one listener) with a single producer.
+         * Multicast ports keep serializing pushes on empty_cv_mutex, as listeners are frequently
+         * registered / unregistered on them.
+         */
+        inline bool is_lock_free_push_enabled() const
+        {
+            return node_->is_opened_read_exclusive &&
+                   node_->num_writers.load(std::memory_order_relaxed) <= 1;
+        }
+
+        /**
+         * Push without locking empty_cv_mutex.
+         * The listener is notified only when it is blocked on empty_cv. Both sides follow a
+         * store -> seq_cst fence -> load protocol (push / sleeping_listeners), so either the producer
+         * sees the listener sleeping, or the listener sees the new cell before blocking.
+         * @return false if a listener is being registered / unregistered, so the caller must
+         * fall back to the locked path.
+         */
+        bool try_push_lock_free(
+                const BufferDescriptor& buffer_descriptor,
+                bool* listeners_active,
+                bool* pushed)
+        {
+            node_->lock_free_pushes.fetch_add(1);
+
+            if (node_->listeners_updating.load() != 0)
+            {
+                node_->lock_free_pushes.fetch_sub(1);
+                return false;
+            }
+
+            if (!node_->is_port_ok)
+            {
+                node_->lock_free_pushes.fetch_sub(1);
+                throw std::runtime_error("the port is marked as not ok!");
+            }
+
+            try
+            {
+                *listeners_active = buffer_->push(buffer_descriptor);
+                *pushed = true;
+            }
+            catch (const std::exception&)
+            {
+                overflows_count_++;
+                *pushed = false;
+            }
+
+            node_->lock_free_pushes.fetch_sub(1);
+
+            if (*pushed)
+            {
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+
+                if (node_->sleeping_listeners.load() > 0)
+                {
+                    // Taking the mutex guarantees the listener is already blocked on empty_cv
+                    // or has not evaluated its wait predicate yet.
+                    {
+                        std::lock_guard<SharedMemSegment::mutex> lock(node_->empty_cv_mutex);
+                    }
+                    node_->empty_cv.notify_one();
+                }
+            }
+
+            return true;
+        }
+
+        /**
+         * Blocks lock-free producers while the listeners of the port are modified.
+         * Must be called with empty_cv_mutex locked.
+         * @throw std::runtime_error if a lock-free push does not finish in healthy_check_timeout_ms.
+         */
+        void begin_listeners_update()
+        {
+            node_->listeners_updating.fetch_add(1);
+
+            auto t0 = std::chrono::steady_clock::now();
+            while (node_->lock_free_pushes.load() != 0)
+            {
+                if (std::chrono::duration_cast<std::chrono::milliseconds>(
+                            std::chrono::steady_clock::now() - t0).count() > node_->healthy_check_timeout_ms)
+                {
+                    node_->listeners_updating.fetch_sub(1);
+                    throw std::runtime_error("lock-free push blocked");
+                }
+
+                std::this_thread::yield();
+            }
+        }
+
+        void end_listeners_update()
+        {
+            node_->listeners_updating.fetch_sub(1);
+        }
+
         /**
          * Singleton task, for SharedMemWatchdog, that periodically checks all opened ports
          * to verify if some listener is dead.
@@ -401,6 +509,7 @@ public:
             : port_segment_(std::move(port_segment))
             , node_(node)
             , overflows_count_(0)
+            , is_writer_(false)
             , read_exclusive_lock_(std::move(read_exclusive_lock))
             , watch_task_(WatchTask::get())
         {
@@ -424,6 +533,11 @@ public:
         {
             Port::WatchTask::get()->remove_port(node_);
 
+            if (is_writer_)
+            {
+                node_->num_writers.fetch_sub(1);
+            }
+
             if (node_->ref_counter.fetch_sub(1) == 1)
             {
                 auto segment_name = port_segment_->name();
@@ -476,6 +590,15 @@ public:
                 const BufferDescriptor& buffer_descriptor,
                 bool* listeners_active)
         {
+            if (is_lock_free_push_enabled())
+            {
+                bool pushed;
+                if (try_push_lock_free(buffer_descriptor, listeners_active, &pushed))
+                {
+                    return pushed;
+                }
+            }
+
             std::unique_lock<SharedMemSegment::mutex> lock_empty(node_->empty_cv_mutex);
 
             if (!node_->is_port_ok)
@@ -541,6 +664,8 @@ public:
                 status.is_waiting = 1;
                 status.counter = status.last_verified_counter + 1;
                 node_->waiting_count++;
+                node_->sleeping_listeners.fetch_add(1);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
 
                 do
                 {
@@ -558,6 +683,7 @@ public:
                     {
                         if (!node_->is_port_ok)
                         {
+                            node_->sleeping_listeners.fetch_sub(1);
                             throw std::runtime_error("port marked as not ok");
                         }
 
@@ -565,6 +691,7 @@ public:
                     }
                 } while (1);
 
+                node_->sleeping_listeners.fetch_sub(1);
                 node_->waiting_count--;
                 status.is_waiting = 0;
 
@@ -606,6 +733,19 @@ public:
             return node_->max_buffer_descriptors;
         }
 
+        /**
+         * Accounts this Port instance as a producer of the port.
+         * Used to detect single-producer ports, that can use the lock-free push path.
+         */
+        void register_writer()
+        {
+            if (!is_writer_)
+            {
+                is_writer_ = true;
+                node_->num_writers.fetch_add(1);
+            }
+        }
+
         /**
          * Set the caller's 'is_closed' flag (protecting empty_cv_mutex) and
          * forces wake-up all listeners on this port.
@@ -666,11 +806,13 @@ public:
 
             if (i < PortNode::LISTENERS_STATUS_SIZE)
             {
+                begin_listeners_update();
                 *listener_index = i;
                 node_->listeners_status[i].is_in_use = true;
                 node_->listeners_status[i].is_processing = false;
                 node_->num_listeners++;
                 listener = buffer_->register_listener();
+                end_listeners_update();
             }
             else
             {
@@ -692,10 +834,12 @@ public:
             {
                 std::lock_guard<SharedMemSegment::mutex> lock(node_->empty_cv_mutex);
 
+                begin_listeners_update();
                 (*listener).reset();
                 node_->num_listeners--;
                 node_->listeners_status[listener_index].is_in_use = false;
                 node_->listeners_status[listener_index].is_processing = false;
+                end_listeners_update();
             }
             catch (const std::exception&)
             {
@@ -1052,6 +1196,11 @@ private:
                     port_node->is_opened_read_exclusive |= (open_mode == Port::OpenMode::ReadExclusive);
                     port_node->is_opened_for_reading |= (open_mode != Port::OpenMode::Write);
 
+                    if (open_mode == Port::OpenMode::Write)
+                    {
+                        port->register_writer();
+                    }
+
                     logInfo(RTPS_TRANSPORT_SHM, THREADID << "Port "
                                                          << port_node->port_id << " (" << port_node->uuid.to_string() <<
                             ") Opened" << Port::open_mode_to_string(open_mode));
@@ -1155,6 +1304,10 @@ private:
         port_node->port_id = port_id;
         UUID<8>::generate(port_node->uuid);
         port_node->waiting_count = 0;
+        port_node->num_writers = 0;
+        port_node->lock_free_pushes = 0;
+        port_node->listeners_updating = 0;
+        port_node->sleeping_listeners = 0;
         port_node->is_opened_read_exclusive = (open_mode == Port::OpenMode::ReadExclusive);
         port_node->is_opened_for_reading = (open_mode != Port::OpenMode::Write);
         port_node->num_listeners = 0;
@@ -1193,6 +1346,10 @@ private:
         {
             port->lock_read_shared();
         }
+        else if (open_mode == Port::OpenMode::Write)
+        {
+            port->register_writer();
+        }
 
         logInfo(RTPS_TRANSPORT_SHM, THREADID << "Port "
                                              << port_node->port_id << " (" << port_node->uuid.to_string()
@@ -353,7 +353,8 @@ public:
                 uint32_t size,
                 uint32_t payload_size,
                 uint32_t max_allocations,
-                const std::string& domain_name)
+                const std::string& domain_name,
+                bool huge_pages = false)
             : segment_id_()
             , overflows_count_(0)
         {
@@ -361,6 +362,11 @@ public:
 
             SharedMemSegment::remove(segment_name_.c_str());
 
+            if (huge_pages)
+            {
+                size = static_cast<uint32_t>(SharedMemSegment::round_to_huge_pages(size));
+            }
+
             try
             {
                 segment_ = std::unique_ptr<SharedMemSegment>(
@@ -374,6 +380,12 @@ public:
                 throw;
             }
 
+            if (huge_pages && !segment_->advise_huge_pages())
+            {
+                logWarning(RTPS_TRANSPORT_SHM, "Huge pages not available for segment " << segment_name_
+                                                                                       << ", using regular pages");
+            }
+
             free_bytes_ = payload_size;
 
             // Alloc the buffer nodes
@@ -632,10 +644,14 @@ public:
 
         Listener(
                 SharedMemManager* shared_mem_manager,
-                std::shared_ptr<SharedMemGlobal::Port> port)
+                std::shared_ptr<SharedMemGlobal::Port> port,
+                uint32_t busy_poll_us = 0,
+                bool busy_poll_only = false)
             : global_port_(port)
             , shared_mem_manager_(shared_mem_manager)
             , is_closed_(false)
+            , busy_poll_us_(busy_poll_us)
+            , busy_poll_only_(busy_poll_only)
         {
             global_listener_ = global_port_->create_listener(&listener_index_);
         }
@@ -664,6 +680,8 @@ public:
             other.global_port_.reset();
             shared_mem_manager_ = other.shared_mem_manager_;
             is_closed_.exchange(other.is_closed_);
+            busy_poll_us_ = other.busy_poll_us_;
+            busy_poll_only_ = other.busy_poll_only_;
 
             return *this;
         }
@@ -690,6 +708,8 @@ public:
                     SharedMemGlobal::PortCell* head_cell = nullptr;
                     buffer_ref.reset();
 
+                    busy_poll();
+
                     while ( !is_closed_.load() && nullptr == (head_cell = global_listener_->head()))
                     {
                         // Wait until there's data to pop
@@ -773,7 +793,7 @@ public:
         {
             auto new_port = shared_mem_manager_->regenerate_port(global_port_, global_port_->open_mode());
 
-            auto new_listener = new_port->create_listener();
+            auto new_listener = new_port->create_listener(busy_poll_us_, busy_poll_only_);
 
             *this = std::move(*new_listener);
         }
@@ -790,6 +810,40 @@ public:
 
     private:
 
+        /**
+         * Spins on the port while it is empty, during busy_poll_us_ microseconds or,
+         * in busy_poll_only_ mode, until a buffer is pushed or the listener is closed.
+         * As the listener is not blocked on the port, producers do not need to notify it.
+         * @throw std::runtime_error if the port is marked as not ok while spinning.
+         */
+        void busy_poll()
+        {
+            if (!busy_poll_only_ && 0 == busy_poll_us_)
+            {
+                return;
+            }
+
+            auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(busy_poll_us_);
+            uint32_t spins = 0;
+
+            while (!is_closed_.load() && nullptr == global_listener_->head())
+            {
+                // Check the clock and the port health only once every 64 spins
+                if (0 == (++spins & 0x3F))
+                {
+                    if (!global_port_->is_port_ok())
+                    {
+                        throw std::runtime_error("port marked as not ok");
+                    }
+
+                    if (!busy_poll_only_ && std::chrono::steady_clock::now() >= deadline)
+                    {
+                        break;
+                    }
+                }
+            }
+        }
+
         std::shared_ptr<SharedMemGlobal::Port> global_port_;
 
         std::unique_ptr<SharedMemGlobal::Listener> global_listener_;
@@ -799,6 +853,10 @@ public:
 
         std::atomic<bool> is_closed_;
 
+        uint32_t busy_poll_us_;
+
+        bool busy_poll_only_;
+
     }; // Listener
 
     /**
@@ -906,9 +964,16 @@ public:
             }
         }
 
-        std::shared_ptr<Listener> create_listener()
+        /**
+         * Creates a listener of the port.
+         * @param busy_poll_us Time, in microseconds, the listener spins on an empty port before blocking.
+         * @param busy_poll_only When true the listener spins on the port and never blocks.
+         */
+        std::shared_ptr<Listener> create_listener(
+                uint32_t busy_poll_us = 0,
+                bool busy_poll_only = false)
         {
-            return std::make_shared<Listener>(shared_mem_manager_, global_port_);
+            return std::make_shared<Listener>(shared_mem_manager_, global_port_, busy_poll_us, busy_poll_only);
         }
 
     private:
@@ -933,14 +998,16 @@ public:
      * Creates a shared-memory segment
      * @param size size of the segment
      * @param max_buffers maximum, at a time, allocated buffers
+     * @param huge_pages when true, the segment is rounded up to whole huge pages and backed by them if possible
      * @return A shared_ptr to the segment
      */
     std::shared_ptr<Segment> create_segment(
             uint32_t size,
-            uint32_t max_allocations)
+            uint32_t max_allocations,
+            bool huge_pages = false)
     {
         return std::make_shared<Segment>(size + segment_allocation_extra_size(max_allocations), size, max_allocations,
-                       global_segment_.domain_name());
+                       global_segment_.domain_name(), huge_pages);
     }
 
     /**
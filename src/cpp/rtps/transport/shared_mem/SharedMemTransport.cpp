@@ -200,6 +200,24 @@ bool SharedMemTransport::CloseInputChannel(
     return false;
 }
 
+void SharedMemTransport::create_segment()
+{
+    shared_mem_segment_ = shared_mem_manager_->create_segment(configuration_.segment_size(),
+                    configuration_.port_queue_capacity(), configuration_.huge_pages());
+
+    // The pages of a lazy segment are mapped when the messages are written on them
+    if (configuration_.lazy_segment())
+    {
+        return;
+    }
+
+    // Memset the whole segment to zero in order to force physical map of the buffer
+    auto buffer = shared_mem_segment_->alloc_buffer(configuration_.segment_size(),
+                    (std::chrono::steady_clock::now() + std::chrono::milliseconds(100)));
+    memset(buffer->data(), 0, configuration_.segment_size());
+    buffer.reset();
+}
+
 void SharedMemTransport::clean_up()
 {
     try
@@ -253,14 +271,9 @@ bool SharedMemTransport::init()
     try
     {
         shared_mem_manager_ = SharedMemManager::create(SHM_MANAGER_DOMAIN);
-        shared_mem_segment_ = shared_mem_manager_->create_segment(configuration_.segment_size(),
-                        configuration_.port_queue_capacity());
 
-        // Memset the whole segment to zero in order to force physical map of the buffer
-        auto buffer = shared_mem_segment_->alloc_buffer(configuration_.segment_size(),
-                        (std::chrono::steady_clock::now() + std::chrono::milliseconds(100)));
-        memset(buffer->data(), 0, configuration_.segment_size());
-        buffer.reset();
+        // The segment is always created here, so a failure is reported before the SHM locators are announced
+        create_segment();
 
         if (!configuration_.rtps_dump_file().empty())
         {
@@ -315,7 +328,8 @@ SharedMemChannelResource* SharedMemTransport::CreateInputChannelResource(
             locator.port,
             configuration_.port_queue_capacity(),
             configuration_.healthy_check_timeout_ms(),
-            open_mode)->create_listener(),
+            open_mode)->create_listener(configuration_.listener_busy_poll_us(),
+            configuration_.listener_busy_poll_only()),
         locator,
         receiver,
         configuration_.rtps_dump_file());
@@ -387,16 +401,16 @@ bool SharedMemTransport::transform_remote_locator(
 }
 
 std::shared_ptr<SharedMemManager::Buffer> SharedMemTransport::copy_to_shared_buffer(
-        const octet* send_buffer,
-        uint32_t send_buffer_size,
+        const std::vector<fastrtps::rtps::NetworkBuffer>& buffers,
+        uint32_t total_bytes,
         const std::chrono::steady_clock::time_point& max_blocking_time_point)
 {
     assert(shared_mem_segment_);
 
     std::shared_ptr<SharedMemManager::Buffer> shared_buffer =
-            shared_mem_segment_->alloc_buffer(send_buffer_size, max_blocking_time_point);
+            shared_mem_segment_->alloc_buffer(total_bytes, max_blocking_time_point);
 
-    memcpy(shared_buffer->data(), send_buffer, send_buffer_size);
+    fastrtps::rtps::copy_network_buffers(buffers, static_cast<octet*>(shared_buffer->data()));
 
     return shared_buffer;
 }
@@ -410,6 +424,33 @@ bool SharedMemTransport::send(
 {
     using namespace eprosima::fastdds::statistics::rtps;
 
+    remove_statistics_submessage(send_buffer, send_buffer_size);
+    const std::vector<fastrtps::rtps::NetworkBuffer> buffers{
+        fastrtps::rtps::NetworkBuffer(send_buffer, send_buffer_size)};
+
+    return send_buffers(buffers, send_buffer_size, destination_locators_begin, destination_locators_end,
+                   max_blocking_time_point);
+}
+
+bool SharedMemTransport::send(
+        const std::vector<fastrtps::rtps::NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+        fastrtps::rtps::LocatorsIterator* destination_locators_end,
+        const std::chrono::steady_clock::time_point& max_blocking_time_point)
+{
+    // Gather sends are not used when statistics are enabled, so there is no statistics submessage to remove.
+    return send_buffers(buffers, total_bytes, destination_locators_begin, destination_locators_end,
+                   max_blocking_time_point);
+}
+
+bool SharedMemTransport::send_buffers(
+        const std::vector<fastrtps::rtps::NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+        fastrtps::rtps::LocatorsIterator* destination_locators_end,
+        const std::chrono::steady_clock::time_point& max_blocking_time_point)
+{
     fastrtps::rtps::LocatorsIterator& it = *destination_locators_begin;
 
     bool ret = true;
@@ -425,8 +466,7 @@ bool SharedMemTransport::send(
                 // Only copy the first time
                 if (shared_buffer == nullptr)
                 {
-                    remove_statistics_submessage(send_buffer, send_buffer_size);
-                    shared_buffer = copy_to_shared_buffer(send_buffer, send_buffer_size, max_blocking_time_point);
+                    shared_buffer = copy_to_shared_buffer(buffers, total_bytes, max_blocking_time_point);
                 }
 
                 ret &= send(shared_buffer, *it);
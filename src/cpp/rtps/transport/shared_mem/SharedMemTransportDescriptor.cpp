@@ -24,6 +24,7 @@ namespace rtps {
 static constexpr uint32_t shm_default_segment_size = 0;
 static constexpr uint32_t shm_default_port_queue_capacity = 512;
 static constexpr uint32_t shm_default_healthy_check_timeout_ms = 1000;
+static constexpr uint32_t shm_default_listener_busy_poll_us = 0;
 
 } // rtps
 } // fastdds
@@ -38,6 +39,10 @@ SharedMemTransportDescriptor::SharedMemTransportDescriptor()
     , port_queue_capacity_(shm_default_port_queue_capacity)
     , healthy_check_timeout_ms_(shm_default_healthy_check_timeout_ms)
     , rtps_dump_file_("")
+    , listener_busy_poll_us_(shm_default_listener_busy_poll_us)
+    , listener_busy_poll_only_(false)
+    , huge_pages_(false)
+    , lazy_segment_(false)
 {
     maxMessageSize = s_maximumMessageSize;
 }
@@ -49,6 +54,10 @@ bool SharedMemTransportDescriptor::operator ==(
            this->port_queue_capacity_ == t.port_queue_capacity() &&
            this->healthy_check_timeout_ms_ == t.healthy_check_timeout_ms() &&
            this->rtps_dump_file_ == t.rtps_dump_file() &&
+           this->listener_busy_poll_us_ == t.listener_busy_poll_us() &&
+           this->listener_busy_poll_only_ == t.listener_busy_poll_only() &&
+           this->huge_pages_ == t.huge_pages() &&
+           this->lazy_segment_ == t.lazy_segment() &&
            TransportDescriptorInterface::operator ==(t));
 }
 
@@ -54,6 +54,7 @@ test_UDPv4Transport::test_UDPv4Transport(
     , drop_gap_messages_filter_(descriptor.drop_gap_messages_filter_)
     , percentage_of_messages_to_drop_(descriptor.percentageOfMessagesToDrop)
     , messages_filter_(descriptor.messages_filter_)
+    , destination_messages_filter_(descriptor.destination_messages_filter_)
     , sequence_number_data_messages_to_drop_(descriptor.sequenceNumberDataMessagesToDrop)
 {
     test_UDPv4Transport_DropLogLength = 0;
@@ -103,6 +104,10 @@ test_UDPv4TransportDescriptor::test_UDPv4TransportDescriptor()
             {
                 return false;
             }),
+    destination_messages_filter_([](const Locator&, uint32_t)
+            {
+                return false;
+            }),
     sequenceNumberDataMessagesToDrop(),
     dropLogLength(0)
 {
@@ -191,6 +196,55 @@ bool test_UDPv4Transport::send(
     return ret;
 }
 
+bool test_UDPv4Transport::send(
+        const std::vector<fastrtps::rtps::NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        eProsimaUDPSocket& socket,
+        fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+        fastrtps::rtps::LocatorsIterator* destination_locators_end,
+        bool only_multicast_purpose,
+        const std::chrono::steady_clock::time_point& max_blocking_time_point)
+{
+    fastrtps::rtps::LocatorsIterator& it = *destination_locators_begin;
+
+    // Filters work on the whole message, so a contiguous copy is inspected. The slices are still sent with a gather
+    // send.
+    std::vector<octet> send_buffer(total_bytes);
+    fastrtps::rtps::copy_network_buffers(buffers, send_buffer.data());
+
+    bool ret = true;
+
+    while (it != *destination_locators_end)
+    {
+        auto now = std::chrono::steady_clock::now();
+
+        if (now < max_blocking_time_point)
+        {
+            if (packet_should_drop(send_buffer.data(), total_bytes) ||
+                    destination_messages_filter_(*it, total_bytes))
+            {
+                statistics_info_.set_statistics_message_data(*it, send_buffer.data(), total_bytes);
+                log_drop(send_buffer.data(), total_bytes);
+            }
+            else
+            {
+                ret &= UDPv4Transport::send(buffers, total_bytes, socket, *it, only_multicast_purpose,
+                                std::chrono::duration_cast<std::chrono::microseconds>(
+                                    max_blocking_time_point - now));
+            }
+
+            ++it;
+        }
+        else // Time is out
+        {
+            ret = false;
+            break;
+        }
+    }
+
+    return ret;
+}
+
 bool test_UDPv4Transport::send(
         const octet* send_buffer,
         uint32_t send_buffer_size,
@@ -199,7 +253,8 @@ bool test_UDPv4Transport::send(
         bool only_multicast_purpose,
         const std::chrono::microseconds& timeout)
 {
-    if (packet_should_drop(send_buffer, send_buffer_size))
+    if (packet_should_drop(send_buffer, send_buffer_size) ||
+            destination_messages_filter_(remote_locator, send_buffer_size))
     {
         statistics_info_.set_statistics_message_data(remote_locator, send_buffer, send_buffer_size);
         log_drop(send_buffer, send_buffer_size);
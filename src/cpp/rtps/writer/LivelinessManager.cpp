@@ -2,6 +2,7 @@
 #include <fastdds/dds/log/Log.hpp>
 
 #include <algorithm>
+#include <cstdint>
 
 using namespace std::chrono;
 
@@ -9,7 +10,16 @@ namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
-using LivelinessDataIterator = ResourceLimitedVector<LivelinessData>::iterator;
+static int64_t steady_now_ns()
+{
+    return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+static steady_clock::time_point steady_time_point(
+        int64_t ns)
+{
+    return steady_clock::time_point(duration_cast<steady_clock::duration>(nanoseconds(ns)));
+}
 
 LivelinessManager::LivelinessManager(
         const LivelinessCallback& callback,
@@ -18,6 +28,7 @@ LivelinessManager::LivelinessManager(
     : callback_(callback)
     , manage_automatic_(manage_automatic)
     , writers_()
+    , writers_by_guid_()
     , mutex_()
     , timer_owner_(nullptr)
     , timer_(
@@ -50,30 +61,17 @@ bool LivelinessManager::add_writer(
         return false;
     }
 
-    for (LivelinessData& writer : writers_)
-    {
-        if (writer.guid == guid &&
-                writer.kind == kind &&
-                writer.lease_duration == lease_duration)
-        {
-            writer.count++;
-            return true;
-        }
-    }
-    writers_.emplace_back(guid, kind, lease_duration);
-
-    if (!calculate_next())
+    LivelinessData* writer = find_writer(guid, kind, lease_duration);
+    if (nullptr != writer)
     {
-        timer_.cancel_timer();
+        writer->count++;
         return true;
     }
 
-    // Some times the interval could be negative if a writer expired during the call to this function
-    // Once in this situation there is not much we can do but let asio timers expire immediately
-    auto interval = timer_owner_->time - steady_clock::now();
-    timer_.update_interval_millisec((double)duration_cast<milliseconds>(interval).count());
-    timer_.restart_timer();
+    writers_.emplace_back(guid, kind, lease_duration);
+    writers_by_guid_.emplace(guid, &writers_.back());
 
+    restart_timer();
     return true;
 }
 
@@ -84,17 +82,22 @@ bool LivelinessManager::remove_writer(
 {
     std::unique_lock<std::mutex> lock(mutex_);
 
-    for (LivelinessData& writer: writers_)
+    auto range = writers_by_guid_.equal_range(guid);
+    for (auto it = range.first; it != range.second; ++it)
     {
-        if (writer.guid == guid &&
-                writer.kind == kind &&
-                writer.lease_duration == lease_duration)
+        LivelinessData* writer = it->second;
+        if (writer->kind == kind &&
+                writer->lease_duration == lease_duration)
         {
-            if (--writer.count == 0)
+            if (--writer->count == 0)
             {
-                LivelinessData::WriterStatus status = writer.status;
+                LivelinessData::WriterStatus status = writer->status;
 
-                writers_.remove(writer);
+                writers_by_guid_.erase(it);
+                writers_.remove_if([writer](const LivelinessData& data)
+                        {
+                            return &data == writer;
+                        });
 
                 if (callback_ != nullptr)
                 {
@@ -110,17 +113,7 @@ bool LivelinessManager::remove_writer(
 
                 if (timer_owner_ != nullptr)
                 {
-                    if (!calculate_next())
-                    {
-                        timer_.cancel_timer();
-                        return true;
-                    }
-
-                    // Some times the interval could be negative if a writer expired during the call to this function
-                    // Once in this situation there is not much we can do but let asio timers expire inmediately
-                    auto interval = timer_owner_->time - steady_clock::now();
-                    timer_.update_interval_millisec((double)duration_cast<milliseconds>(interval).count());
-                    timer_.restart_timer();
+                    restart_timer();
                 }
                 return true;
             }
@@ -130,6 +123,15 @@ bool LivelinessManager::remove_writer(
     return false;
 }
 
+LivelinessData* LivelinessManager::get_writer(
+        const GUID_t& guid,
+        LivelinessQosPolicyKind kind,
+        const Duration_t& lease_duration)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    return find_writer(guid, kind, lease_duration);
+}
+
 bool LivelinessManager::assert_liveliness(
         GUID_t guid,
         LivelinessQosPolicyKind kind,
@@ -137,46 +139,65 @@ bool LivelinessManager::assert_liveliness(
 {
     std::unique_lock<std::mutex> lock(mutex_);
 
-    ResourceLimitedVector<LivelinessData>::iterator wit;
-    if (!find_writer(
-                guid,
-                kind,
-                lease_duration,
-                &wit))
+    LivelinessData* writer = find_writer(guid, kind, lease_duration);
+    if (nullptr == writer)
     {
         return false;
     }
 
-    timer_.cancel_timer();
+    bool any_recovered = false;
 
-    if (wit->kind == LivelinessQosPolicyKind::MANUAL_BY_PARTICIPANT_LIVELINESS_QOS ||
-            wit->kind == LivelinessQosPolicyKind::AUTOMATIC_LIVELINESS_QOS)
+    if (writer->kind == LivelinessQosPolicyKind::MANUAL_BY_PARTICIPANT_LIVELINESS_QOS ||
+            writer->kind == LivelinessQosPolicyKind::AUTOMATIC_LIVELINESS_QOS)
     {
         for (LivelinessData& w: writers_)
         {
-            if (w.kind == wit->kind)
+            if (w.kind == writer->kind)
             {
-                assert_writer_liveliness(w);
+                any_recovered |= assert_writer_liveliness(w);
             }
         }
     }
-    else if (wit->kind == LivelinessQosPolicyKind::MANUAL_BY_TOPIC_LIVELINESS_QOS)
+    else if (writer->kind == LivelinessQosPolicyKind::MANUAL_BY_TOPIC_LIVELINESS_QOS)
     {
-        assert_writer_liveliness(*wit);
+        any_recovered = assert_writer_liveliness(*writer);
     }
 
-    // Updates the timer owner
-    if (!calculate_next())
+    // Writers which were already alive only extended their expiration time, which is checked when the timer expires
+    if (any_recovered && !restart_timer())
     {
         logError(RTPS_WRITER, "Error when restarting liveliness timer");
         return false;
     }
 
-    // Some times the interval could be negative if a writer expired during the call to this function
-    // Once in this situation there is not much we can do but let asio timers expire inmediately
-    auto interval = timer_owner_->time - steady_clock::now();
-    timer_.update_interval_millisec((double)duration_cast<milliseconds>(interval).count());
-    timer_.restart_timer();
+    return true;
+}
+
+bool LivelinessManager::assert_liveliness(
+        LivelinessData* writer)
+{
+    if (nullptr == writer)
+    {
+        return false;
+    }
+
+    if (writer->kind != LivelinessQosPolicyKind::MANUAL_BY_TOPIC_LIVELINESS_QOS)
+    {
+        return assert_liveliness(writer->kind);
+    }
+
+    if (extend_writer_liveliness(*writer))
+    {
+        return true;
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    if (assert_writer_liveliness(*writer) && !restart_timer())
+    {
+        logError(RTPS_WRITER, "Error when restarting liveliness timer");
+        return false;
+    }
 
     return true;
 }
@@ -197,18 +218,18 @@ bool LivelinessManager::assert_liveliness(
         return true;
     }
 
-    timer_.cancel_timer();
+    bool any_recovered = false;
 
     for (LivelinessData& writer: writers_)
     {
         if (writer.kind == kind)
         {
-            assert_writer_liveliness(writer);
+            any_recovered |= assert_writer_liveliness(writer);
         }
     }
 
-    // Updates the timer owner
-    if (!calculate_next())
+    // Writers which were already alive only extended their expiration time, which is checked when the timer expires
+    if (any_recovered && !restart_timer())
     {
         logInfo(RTPS_WRITER,
                 "Error when restarting liveliness timer: " << writers_.size() << " writers, liveliness " <<
@@ -216,12 +237,6 @@ bool LivelinessManager::assert_liveliness(
         return false;
     }
 
-    // Some times the interval could be negative if a writer expired during the call to this function
-    // Once in this situation there is not much we can do but let asio timers expire inmediately
-    auto interval = timer_owner_->time - steady_clock::now();
-    timer_.update_interval_millisec((double)duration_cast<milliseconds>(interval).count());
-    timer_.restart_timer();
-
     return true;
 }
 
@@ -234,14 +249,15 @@ bool LivelinessManager::calculate_next()
 
     bool any_alive = false;
 
-    for (LivelinessDataIterator it = writers_.begin(); it != writers_.end(); ++it)
+    for (LivelinessData& writer : writers_)
     {
-        if (it->status == LivelinessData::WriterStatus::ALIVE)
+        if (writer.status == LivelinessData::WriterStatus::ALIVE)
         {
-            if (it->time < min_time)
+            writer.time = steady_time_point(writer.expiration_ns.load());
+            if (writer.time < min_time)
             {
-                min_time = it->time;
-                timer_owner_ = &*it;
+                min_time = writer.time;
+                timer_owner_ = &writer;
             }
             any_alive = true;
         }
@@ -249,6 +265,23 @@ bool LivelinessManager::calculate_next()
     return any_alive;
 }
 
+bool LivelinessManager::restart_timer()
+{
+    timer_.cancel_timer();
+
+    if (!calculate_next())
+    {
+        return false;
+    }
+
+    // Some times the interval could be negative if a writer expired during the call to this function
+    // Once in this situation there is not much we can do but let asio timers expire inmediately
+    auto interval = timer_owner_->time - steady_clock::now();
+    timer_.update_interval_millisec((double)duration_cast<microseconds>(interval).count() / 1000.0);
+    timer_.restart_timer();
+    return true;
+}
+
 bool LivelinessManager::timer_expired()
 {
     std::unique_lock<std::mutex> lock(mutex_);
@@ -259,45 +292,50 @@ bool LivelinessManager::timer_expired()
         return false;
     }
 
-    if (callback_ != nullptr)
+    // The timer owner may have asserted its liveliness since the timer was started. It only loses its liveliness if
+    // its expiration time can be cleared before it is extended again.
+    int64_t expiration = timer_owner_->expiration_ns.load();
+    if (expiration <= steady_now_ns() &&
+            timer_owner_->expiration_ns.compare_exchange_strong(expiration, 0))
     {
-        callback_(timer_owner_->guid,
-                timer_owner_->kind,
-                timer_owner_->lease_duration,
-                -1,
-                1);
+        if (callback_ != nullptr)
+        {
+            callback_(timer_owner_->guid,
+                    timer_owner_->kind,
+                    timer_owner_->lease_duration,
+                    -1,
+                    1);
+        }
+        timer_owner_->status = LivelinessData::WriterStatus::NOT_ALIVE;
     }
-    timer_owner_->status = LivelinessData::WriterStatus::NOT_ALIVE;
 
     if (calculate_next())
     {
         // Some times the interval could be negative if a writer expired during the call to this function
         // Once in this situation there is not much we can do but let asio timers expire inmediately
         auto interval = timer_owner_->time - steady_clock::now();
-        timer_.update_interval_millisec((double)duration_cast<milliseconds>(interval).count());
+        timer_.update_interval_millisec((double)duration_cast<microseconds>(interval).count() / 1000.0);
         return true;
     }
 
     return false;
 }
 
-bool LivelinessManager::find_writer(
+LivelinessData* LivelinessManager::find_writer(
         const GUID_t& guid,
         const LivelinessQosPolicyKind& kind,
-        const Duration_t& lease_duration,
-        ResourceLimitedVector<LivelinessData>::iterator* wit_out)
+        const Duration_t& lease_duration)
 {
-    for (LivelinessDataIterator it = writers_.begin(); it != writers_.end(); ++it)
+    auto range = writers_by_guid_.equal_range(guid);
+    for (auto it = range.first; it != range.second; ++it)
     {
-        if (it->guid == guid &&
-                it->kind == kind &&
-                it->lease_duration == lease_duration)
+        if (it->second->kind == kind &&
+                it->second->lease_duration == lease_duration)
         {
-            *wit_out = it;
-            return true;
+            return it->second;
         }
     }
-    return false;
+    return nullptr;
 }
 
 bool LivelinessManager::is_any_alive(
@@ -315,9 +353,33 @@ bool LivelinessManager::is_any_alive(
     return false;
 }
 
-void LivelinessManager::assert_writer_liveliness(
+bool LivelinessManager::extend_writer_liveliness(
+        LivelinessData& writer)
+{
+    int64_t expiration = steady_now_ns() + writer.lease_duration.to_ns();
+    int64_t current = writer.expiration_ns.load();
+
+    // A zero expiration time means the writer is not alive, so its status should be changed with the mutex taken
+    while (0 != current)
+    {
+        if (current >= expiration ||
+                writer.expiration_ns.compare_exchange_weak(current, expiration))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool LivelinessManager::assert_writer_liveliness(
         LivelinessData& writer)
 {
+    if (extend_writer_liveliness(writer))
+    {
+        return false;
+    }
+
     if (callback_ != nullptr)
     {
         if (writer.status == LivelinessData::WriterStatus::NOT_ASSERTED)
@@ -339,12 +401,21 @@ void LivelinessManager::assert_writer_liveliness(
     }
 
     writer.status = LivelinessData::WriterStatus::ALIVE;
-    writer.time = steady_clock::now() + nanoseconds(writer.lease_duration.to_ns());
+    writer.expiration_ns.store(steady_now_ns() + writer.lease_duration.to_ns());
+    writer.time = steady_time_point(writer.expiration_ns.load());
+    return true;
 }
 
-const ResourceLimitedVector<LivelinessData>& LivelinessManager::get_liveliness_data() const
+ResourceLimitedVector<LivelinessData> LivelinessManager::get_liveliness_data() const
 {
-    return writers_;
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    ResourceLimitedVector<LivelinessData> ret;
+    for (const LivelinessData& writer : writers_)
+    {
+        ret.push_back(writer);
+    }
+    return ret;
 }
 
 } // namespace rtps
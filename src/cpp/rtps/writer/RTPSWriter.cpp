@@ -39,6 +39,7 @@
 #include <statistics/rtps/messages/RTPSStatisticsMessages.hpp>
 
 #include "../flowcontrol/FlowController.hpp"
+#include "../flowcontrol/LocatorTrafficShaper.hpp"
 
 namespace eprosima {
 namespace fastrtps {
@@ -120,6 +121,10 @@ void RTPSWriter::init(
     if (att.endpoint.data_sharing_configuration().kind() != OFF)
     {
         std::shared_ptr<WriterPool> pool = std::dynamic_pointer_cast<WriterPool>(payload_pool);
+        if (pool)
+        {
+            pool->huge_pages(att.endpoint.data_sharing_configuration().huge_pages());
+        }
         if (!pool || !pool->init_shared_memory(this, att.endpoint.data_sharing_configuration().shm_directory()))
         {
             logError(RTPS_WRITER, "Could not initialize DataSharing writer pool");
@@ -436,11 +441,75 @@ bool RTPSWriter::send_nts(
 {
     RTPSParticipantImpl* participant = getRTPSParticipant();
 
-    return locator_selector.locator_selector.selected_size() == 0 ||
-           participant->sendSync(message, m_guid, locator_selector.locator_selector.begin(),
+    if (locator_selector.locator_selector.selected_size() == 0)
+    {
+        return true;
+    }
+
+    if (&locator_selector == shaped_locator_selector_)
+    {
+        return !shape_locators(locator_selector, message->length) ||
+               participant->sendSync(message, m_guid, Locators(shaped_locators_.begin()),
+                       Locators(shaped_locators_.end()), max_blocking_time_point);
+    }
+
+    return participant->sendSync(message, m_guid, locator_selector.locator_selector.begin(),
+                   locator_selector.locator_selector.end(), max_blocking_time_point);
+}
+
+bool RTPSWriter::send_nts(
+        const std::vector<NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        const LocatorSelectorSender& locator_selector,
+        std::chrono::steady_clock::time_point& max_blocking_time_point) const
+{
+    RTPSParticipantImpl* participant = getRTPSParticipant();
+
+    if (locator_selector.locator_selector.selected_size() == 0)
+    {
+        return true;
+    }
+
+    if (&locator_selector == shaped_locator_selector_)
+    {
+        return !shape_locators(locator_selector, total_bytes) ||
+               participant->sendSync(buffers, total_bytes, m_guid, Locators(shaped_locators_.begin()),
+                       Locators(shaped_locators_.end()), max_blocking_time_point);
+    }
+
+    return participant->sendSync(buffers, total_bytes, m_guid, locator_selector.locator_selector.begin(),
                    locator_selector.locator_selector.end(), max_blocking_time_point);
 }
 
+void RTPSWriter::traffic_shaper(
+        fastdds::rtps::LocatorTrafficShaper* traffic_shaper)
+{
+    traffic_shaper_ = traffic_shaper;
+    shaped_locator_selector_ = nullptr != traffic_shaper ? &get_async_locator_selector() : nullptr;
+}
+
+bool RTPSWriter::shape_locators(
+        const LocatorSelectorSender& locator_selector,
+        uint32_t bytes) const
+{
+    shaped_locators_.clear();
+    for (auto it = locator_selector.locator_selector.begin(); it != locator_selector.locator_selector.end(); ++it)
+    {
+        if (traffic_shaper_->consume(*it, bytes))
+        {
+            shaped_locators_.push_back(*it);
+        }
+    }
+
+    if (shaped_locators_.empty())
+    {
+        traffic_shaper_->discarded(bytes);
+        return false;
+    }
+
+    return true;
+}
+
 #ifdef FASTDDS_STATISTICS
 
 bool RTPSWriter::add_statistics_listener(
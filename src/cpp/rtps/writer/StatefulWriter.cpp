@@ -370,12 +370,13 @@ StatefulWriter::~StatefulWriter()
  * CHANGE-RELATED METHODS
  */
 void StatefulWriter::prepare_datasharing_delivery(
-        CacheChange_t* change)
+        CacheChange_t* change,
+        uint64_t filtered_readers)
 {
     auto pool = std::dynamic_pointer_cast<WriterPool>(payload_pool_);
     assert (pool != nullptr);
 
-    pool->add_to_shared_history(change);
+    pool->add_to_shared_history(change, filtered_readers);
     logInfo(RTPS_WRITER, "Notifying readers of cache change with SN " << change->sequenceNumber);
 }
 
@@ -388,28 +389,32 @@ void StatefulWriter::unsent_change_added_to_history(
 
     if (liveliness_lease_duration_ < c_TimeInfinite)
     {
-        mp_RTPSParticipant->wlp()->assert_liveliness(
-            getGuid(),
-            liveliness_kind_,
-            liveliness_lease_duration_);
+        mp_RTPSParticipant->wlp()->assert_liveliness(liveliness_data_);
     }
 
-    // Prepare the metadata for datasharing
+    std::shared_ptr<WriterPool> datasharing_pool;
     if (is_datasharing_compatible())
     {
-        prepare_datasharing_delivery(change);
+        datasharing_pool = std::dynamic_pointer_cast<WriterPool>(payload_pool_);
     }
 
-    // Now for the rest of readers
     if (!matched_remote_readers_.empty() || !matched_datasharing_readers_.empty() || !matched_local_readers_.empty())
     {
+        // Datasharing readers for which the change is not relevant, so they skip it without reading it
+        uint64_t filtered_readers = 0u;
         bool should_be_sent = false;
         for_matched_readers(matched_local_readers_, matched_datasharing_readers_, matched_remote_readers_,
-                [this, &should_be_sent, &change, &max_blocking_time](ReaderProxy* reader)
+                [this, &should_be_sent, &filtered_readers, &datasharing_pool, &change, &max_blocking_time](
+                    ReaderProxy* reader)
                 {
                     ChangeForReader_t changeForReader(change);
                     bool is_revelant = reader->rtps_is_relevant(change);
 
+                    if (!is_revelant && datasharing_pool && reader->is_datasharing_reader())
+                    {
+                        filtered_readers |= datasharing_pool->reader_mask(reader->guid());
+                    }
+
                     if (m_pushMode || !reader->is_reliable() || reader->is_local_reader())
                     {
                         //ChangeForReader_t construct sets status to UNSENT.
@@ -425,6 +430,12 @@ void StatefulWriter::unsent_change_added_to_history(
                 }
                 );
 
+        // Prepare the metadata for datasharing before any reader is notified
+        if (datasharing_pool)
+        {
+            prepare_datasharing_delivery(change, filtered_readers);
+        }
+
         if (should_be_sent)
         {
             flow_controller_->add_new_sample(this, change, max_blocking_time);
@@ -447,6 +458,11 @@ void StatefulWriter::unsent_change_added_to_history(
     }
     else
     {
+        if (datasharing_pool)
+        {
+            prepare_datasharing_delivery(change, 0u);
+        }
+
         logInfo(RTPS_WRITER, "No reader proxy to add change.");
         check_acked_status();
     }
@@ -1040,6 +1056,11 @@ bool StatefulWriter::matched_reader_add(
         if (rp->is_datasharing_reader())
         {
             matched_datasharing_readers_.push_back(rp);
+            auto pool = std::dynamic_pointer_cast<WriterPool>(payload_pool_);
+            if (pool)
+            {
+                pool->register_reader(rp->guid());
+            }
             logInfo(RTPS_WRITER, "Adding reader " << rdata.guid() << " to " << this->m_guid.entityId
                                                   << " as data sharing");
         }
@@ -1176,6 +1197,11 @@ bool StatefulWriter::matched_reader_remove(
                 logInfo(RTPS_WRITER, "Reader Proxy removed: " << reader_guid);
                 rproxy = std::move(*it);
                 it = matched_datasharing_readers_.erase(it);
+                auto pool = std::dynamic_pointer_cast<WriterPool>(payload_pool_);
+                if (pool)
+                {
+                    pool->unregister_reader(reader_guid);
+                }
                 break;
             }
         }
@@ -305,10 +305,7 @@ void StatelessWriter::unsent_change_added_to_history(
 
     if (liveliness_lease_duration_ < c_TimeInfinite)
     {
-        mp_RTPSParticipant->wlp()->assert_liveliness(
-            getGuid(),
-            liveliness_kind_,
-            liveliness_lease_duration_);
+        mp_RTPSParticipant->wlp()->assert_liveliness(liveliness_data_);
     }
 
     // Notify the datasharing readers
@@ -616,6 +613,23 @@ bool StatelessWriter::send_nts(
                    max_blocking_time_point);
 }
 
+bool StatelessWriter::send_nts(
+        const std::vector<NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        const LocatorSelectorSender& locator_selector,
+        std::chrono::steady_clock::time_point& max_blocking_time_point) const
+{
+    if (!RTPSWriter::send_nts(buffers, total_bytes, locator_selector, max_blocking_time_point))
+    {
+        return false;
+    }
+
+    return fixed_locators_.empty() ||
+           mp_RTPSParticipant->sendSync(buffers, total_bytes, m_guid,
+                   Locators(fixed_locators_.begin()), Locators(fixed_locators_.end()),
+                   max_blocking_time_point);
+}
+
 DeliveryRetCode StatelessWriter::deliver_sample_nts(
         CacheChange_t* cache_change,
         RTPSMessageGroup& group,
@@ -1853,6 +1853,7 @@ XMLP_ret XMLParser::getXMLDataSharingQos(
                 <xs:element name="shared_dir" type="stringType" minOccurs="0"/>
                 <xs:element name="domain_ids" type="domainIdVectorType" minOccurs="0"/>
                 <xs:element name="max_domains" type="uint32Type" minOccurs="0"/>
+                <xs:element name="huge_pages" type="boolType" minOccurs="0"/>
             </xs:all>
         </xs:complexType>
      */
@@ -1861,6 +1862,7 @@ XMLP_ret XMLParser::getXMLDataSharingQos(
     std::string shm_directory = "";
     int32_t max_domains = 0;
     std::vector<uint16_t> domain_ids;
+    bool huge_pages = false;
 
     tinyxml2::XMLElement* p_aux0 = nullptr;
     const char* name = nullptr;
@@ -1923,6 +1925,13 @@ XMLP_ret XMLParser::getXMLDataSharingQos(
             }
 
         }
+        else if (strcmp(name, HUGE_PAGES) == 0)
+        {
+            if (XMLP_ret::XML_OK != getXMLBool(p_aux0, &huge_pages, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
         else if (strcmp(name, DOMAIN_IDS) == 0)
         {
             /*
@@ -2004,6 +2013,8 @@ XMLP_ret XMLParser::getXMLDataSharingQos(
             break;
     }
 
+    data_sharing.huge_pages(huge_pages);
+
     return XMLP_ret::XML_OK;
 }
 
@@ -239,6 +239,10 @@ XMLP_ret XMLParser::parseXMLTransportData(
                 <xs:element name="calculate_crc" type="boolType" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="check_crc" type="boolType" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="enable_tcp_nodelay" type="boolType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="reactor_threads" type="uint32Type" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="enable_write_coalescing" type="boolType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="write_coalescing_max_latency_us" type="uint32Type" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="enable_tcp_cork" type="boolType" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="tls" type="tlsConfigType" minOccurs="0" maxOccurs="1"/>
             </xs:all>
         </xs:complexType>
@@ -498,11 +502,15 @@ XMLP_ret XMLParser::parseXMLCommonTransportData(
                 strcmp(name, LOGICAL_PORT_INCREMENT) == 0 || strcmp(name, LISTENING_PORTS) == 0 ||
                 strcmp(name, CALCULATE_CRC) == 0 || strcmp(name, CHECK_CRC) == 0 ||
                 strcmp(name, ENABLE_TCP_NODELAY) == 0 || strcmp(name, TLS) == 0 ||
+                strcmp(name, REACTOR_THREADS) == 0 || strcmp(name, ENABLE_WRITE_COALESCING) == 0 ||
+                strcmp(name, WRITE_COALESCING_MAX_LATENCY_US) == 0 || strcmp(name, ENABLE_TCP_CORK) == 0 ||
                 strcmp(name, NON_BLOCKING_SEND) == 0  ||
                 strcmp(name, SEGMENT_SIZE) == 0 || strcmp(name, PORT_QUEUE_CAPACITY) == 0 ||
                 strcmp(name, PORT_OVERFLOW_POLICY) == 0 || strcmp(name, SEGMENT_OVERFLOW_POLICY) == 0 ||
                 strcmp(name, HEALTHY_CHECK_TIMEOUT_MS) == 0 || strcmp(name, HEALTHY_CHECK_TIMEOUT_MS) == 0 ||
-                strcmp(name, RTPS_DUMP_FILE) == 0)
+                strcmp(name, RTPS_DUMP_FILE) == 0 || strcmp(name, LISTENER_BUSY_POLL_US) == 0 ||
+                strcmp(name, LISTENER_BUSY_POLL_ONLY) == 0 || strcmp(name, HUGE_PAGES) == 0 ||
+                strcmp(name, LAZY_SEGMENT) == 0)
         {
             // Parsed outside of this method
         }
@@ -535,6 +543,10 @@ XMLP_ret XMLParser::parseXMLCommonTCPTransportData(
                 <xs:element name="calculate_crc" type="boolType" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="check_crc" type="boolType" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="enable_tcp_nodelay" type="boolType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="reactor_threads" type="uint32Type" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="enable_write_coalescing" type="boolType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="write_coalescing_max_latency_us" type="uint32Type" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="enable_tcp_cork" type="boolType" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="tls" type="tlsConfigType" minOccurs="0" maxOccurs="1"/>
             </xs:all>
         </xs:complexType>
@@ -638,6 +650,38 @@ XMLP_ret XMLParser::parseXMLCommonTCPTransportData(
                     return XMLP_ret::XML_ERROR;
                 }
             }
+            else if (strcmp(name, REACTOR_THREADS) == 0)
+            {
+                // reactor_threads - uint32Type
+                if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &pTCPDesc->reactor_threads, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+            }
+            else if (strcmp(name, ENABLE_WRITE_COALESCING) == 0)
+            {
+                // enable_write_coalescing - boolType
+                if (XMLP_ret::XML_OK != getXMLBool(p_aux0, &pTCPDesc->enable_write_coalescing, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+            }
+            else if (strcmp(name, WRITE_COALESCING_MAX_LATENCY_US) == 0)
+            {
+                // write_coalescing_max_latency_us - uint32Type
+                if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &pTCPDesc->write_coalescing_max_latency_us, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+            }
+            else if (strcmp(name, ENABLE_TCP_CORK) == 0)
+            {
+                // enable_tcp_cork - boolType
+                if (XMLP_ret::XML_OK != getXMLBool(p_aux0, &pTCPDesc->enable_tcp_cork, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+            }
             else if (strcmp(name, TLS) == 0)
             {
                 if (XMLP_ret::XML_OK != parse_tls_config(p_aux0, p_transport))
@@ -682,6 +726,10 @@ XMLP_ret XMLParser::parseXMLCommonSharedMemTransportData(
                 <xs:element name="port_queue_capacity" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="healthy_check_timeout_ms" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="rtps_dump_file" type="stringType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="listener_busy_poll_us" type="uint32Type" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="listener_busy_poll_only" type="boolType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="huge_pages" type="boolType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="lazy_segment" type="boolType" minOccurs="0" maxOccurs="1"/>
                 </xs:all>
         </xs:complexType>
      */
@@ -730,6 +778,41 @@ XMLP_ret XMLParser::parseXMLCommonSharedMemTransportData(
                 }
                 transport_descriptor->rtps_dump_file(str);
             }
+            else if (strcmp(name, LISTENER_BUSY_POLL_US) == 0)
+            {
+                if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &aux, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+                transport_descriptor->listener_busy_poll_us(static_cast<uint32_t>(aux));
+            }
+            else if (strcmp(name, LISTENER_BUSY_POLL_ONLY) == 0)
+            {
+                bool busy_poll_only = false;
+                if (XMLP_ret::XML_OK != getXMLBool(p_aux0, &busy_poll_only, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+                transport_descriptor->listener_busy_poll_only(busy_poll_only);
+            }
+            else if (strcmp(name, HUGE_PAGES) == 0)
+            {
+                bool huge_pages = false;
+                if (XMLP_ret::XML_OK != getXMLBool(p_aux0, &huge_pages, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+                transport_descriptor->huge_pages(huge_pages);
+            }
+            else if (strcmp(name, LAZY_SEGMENT) == 0)
+            {
+                bool lazy_segment = false;
+                if (XMLP_ret::XML_OK != getXMLBool(p_aux0, &lazy_segment, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+                transport_descriptor->lazy_segment(lazy_segment);
+            }
             else if (strcmp(name, MAX_MESSAGE_SIZE) == 0)
             {
                 // maxMessageSize - uint32Type
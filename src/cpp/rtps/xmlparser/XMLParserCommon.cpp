@@ -57,6 +57,10 @@ const char* METADATA_LOGICAL_PORT = "metadata_logical_port";
 const char* LISTENING_PORTS = "listening_ports";
 const char* CALCULATE_CRC = "calculate_crc";
 const char* CHECK_CRC = "check_crc";
+const char* REACTOR_THREADS = "reactor_threads";
+const char* ENABLE_WRITE_COALESCING = "enable_write_coalescing";
+const char* WRITE_COALESCING_MAX_LATENCY_US = "write_coalescing_max_latency_us";
+const char* ENABLE_TCP_CORK = "enable_tcp_cork";
 const char* SEGMENT_SIZE = "segment_size";
 const char* PORT_QUEUE_CAPACITY = "port_queue_capacity";
 const char* PORT_OVERFLOW_POLICY = "port_overflow_policy";
@@ -65,6 +69,10 @@ const char* HEALTHY_CHECK_TIMEOUT_MS = "healthy_check_timeout_ms";
 const char* DISCARD = "DISCARD";
 const char* FAIL = "FAIL";
 const char* RTPS_DUMP_FILE = "rtps_dump_file";
+const char* LISTENER_BUSY_POLL_US = "listener_busy_poll_us";
+const char* LISTENER_BUSY_POLL_ONLY = "listener_busy_poll_only";
+const char* HUGE_PAGES = "huge_pages";
+const char* LAZY_SEGMENT = "lazy_segment";
 const char* ON = "ON";
 
 const char* OFF = "OFF";
@@ -18,6 +18,10 @@
 #include <fastdds/dds/log/Log.hpp>
 
 #include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <utility>
 #ifdef _WIN32
 #include <windows.h>
 #endif // ifdef _WIN32
@@ -41,12 +45,102 @@ sp_transport_map_t XMLProfileManager::transport_profiles_;
 p_dynamictype_map_t XMLProfileManager::dynamic_types_;
 BaseNode* XMLProfileManager::root = nullptr;
 
+namespace {
+
+//! Profile whose parsing has been deferred until it is first requested.
+struct DeferredProfile
+{
+    //! XML file the profile was read from.
+    std::string filename;
+
+    //! Document holding a <profiles> element with the profile as its only child.
+    std::unique_ptr<tinyxml2::XMLDocument> document;
+};
+
+//! Deferred profiles, indexed by profile kind and profile name.
+std::map<std::pair<std::string, std::string>, DeferredProfile> deferred_profiles;
+
+//! Protects the deferred profiles and the profiles maps while deferred profiles are being parsed.
+std::mutex deferred_profiles_mutex;
+
+bool deferred_profiles_enabled()
+{
+#ifdef _WIN32
+    char deferred[2];
+    size_t size = 2;
+    return getenv_s(&size, deferred, size, "FASTDDS_DEFERRED_XML_PROFILES") == 0 && deferred[0] == '1';
+#else
+    const char* deferred = std::getenv("FASTDDS_DEFERRED_XML_PROFILES");
+    return deferred != nullptr && deferred[0] == '1';
+#endif // ifdef _WIN32
+}
+
+/**
+ * Returns the kind of profile a tag defines, if profiles of that kind can be deferred.
+ * @param tag XML tag of a child of <profiles>.
+ * @return Tag of the profile kind, or nullptr if the profile cannot be deferred.
+ */
+const char* deferrable_kind(
+        const char* tag)
+{
+    if (strcmp(tag, PARTICIPANT) == 0)
+    {
+        return PARTICIPANT;
+    }
+    else if (strcmp(tag, PUBLISHER) == 0 || strcmp(tag, DATA_WRITER) == 0)
+    {
+        return PUBLISHER;
+    }
+    else if (strcmp(tag, SUBSCRIBER) == 0 || strcmp(tag, DATA_READER) == 0)
+    {
+        return SUBSCRIBER;
+    }
+    else if (strcmp(tag, TOPIC) == 0)
+    {
+        return TOPIC;
+    }
+    else if (strcmp(tag, REQUESTER) == 0)
+    {
+        return REQUESTER;
+    }
+    else if (strcmp(tag, REPLIER) == 0)
+    {
+        return REPLIER;
+    }
+
+    return nullptr;
+}
+
+void discard_deferred_profiles(
+        const std::string& filename)
+{
+    std::lock_guard<std::mutex> guard(deferred_profiles_mutex);
+    for (auto it = deferred_profiles.begin(); it != deferred_profiles.end();)
+    {
+        if (it->second.filename == filename)
+        {
+            it = deferred_profiles.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+} // namespace
+
 XMLP_ret XMLProfileManager::fillParticipantAttributes(
         const std::string& profile_name,
         ParticipantAttributes& atts,
         bool log_error)
 {
+    std::lock_guard<std::mutex> guard(deferred_profiles_mutex);
     part_map_iterator_t it = participant_profiles_.find(profile_name);
+    if (it == participant_profiles_.end() && parseDeferredProfile(PARTICIPANT, profile_name))
+    {
+        it = participant_profiles_.find(profile_name);
+    }
     if (it == participant_profiles_.end())
     {
         if (log_error)
@@ -64,7 +158,12 @@ XMLP_ret XMLProfileManager::fillPublisherAttributes(
         PublisherAttributes& atts,
         bool log_error)
 {
+    std::lock_guard<std::mutex> guard(deferred_profiles_mutex);
     publ_map_iterator_t it = publisher_profiles_.find(profile_name);
+    if (it == publisher_profiles_.end() && parseDeferredProfile(PUBLISHER, profile_name))
+    {
+        it = publisher_profiles_.find(profile_name);
+    }
     if (it == publisher_profiles_.end())
     {
         if (log_error)
@@ -82,7 +181,12 @@ XMLP_ret XMLProfileManager::fillSubscriberAttributes(
         SubscriberAttributes& atts,
         bool log_error)
 {
+    std::lock_guard<std::mutex> guard(deferred_profiles_mutex);
     subs_map_iterator_t it = subscriber_profiles_.find(profile_name);
+    if (it == subscriber_profiles_.end() && parseDeferredProfile(SUBSCRIBER, profile_name))
+    {
+        it = subscriber_profiles_.find(profile_name);
+    }
     if (it == subscriber_profiles_.end())
     {
         if (log_error)
@@ -99,7 +203,12 @@ XMLP_ret XMLProfileManager::fillTopicAttributes(
         const std::string& profile_name,
         TopicAttributes& atts)
 {
+    std::lock_guard<std::mutex> guard(deferred_profiles_mutex);
     topic_map_iterator_t it = topic_profiles_.find(profile_name);
+    if (it == topic_profiles_.end() && parseDeferredProfile(TOPIC, profile_name))
+    {
+        it = topic_profiles_.find(profile_name);
+    }
     if (it == topic_profiles_.end())
     {
         logError(XMLPARSER, "Profile '" << profile_name << "' not found");
@@ -113,7 +222,12 @@ XMLP_ret XMLProfileManager::fillRequesterAttributes(
         const std::string& profile_name,
         RequesterAttributes& atts)
 {
+    std::lock_guard<std::mutex> guard(deferred_profiles_mutex);
     requester_map_iterator_t it = requester_profiles_.find(profile_name);
+    if (it == requester_profiles_.end() && parseDeferredProfile(REQUESTER, profile_name))
+    {
+        it = requester_profiles_.find(profile_name);
+    }
     if (it == requester_profiles_.end())
     {
         logError(XMLPARSER, "Profile '" << profile_name << "' not found");
@@ -127,7 +241,12 @@ XMLP_ret XMLProfileManager::fillReplierAttributes(
         const std::string& profile_name,
         ReplierAttributes& atts)
 {
+    std::lock_guard<std::mutex> guard(deferred_profiles_mutex);
     replier_map_iterator_t it = replier_profiles_.find(profile_name);
+    if (it == replier_profiles_.end() && parseDeferredProfile(REPLIER, profile_name))
+    {
+        it = replier_profiles_.find(profile_name);
+    }
     if (it == replier_profiles_.end())
     {
         logError(XMLPARSER, "Profile '" << profile_name << "' not found");
@@ -294,13 +413,29 @@ XMLP_ret XMLProfileManager::loadXMLFile(
     }
 
     up_base_node_t root_node;
-    XMLP_ret loaded_ret = XMLParser::loadXML(filename, root_node);
+    unsigned int deferred_count = 0u;
+    XMLP_ret loaded_ret = XMLP_ret::XML_ERROR;
+    if (deferred_profiles_enabled())
+    {
+        tinyxml2::XMLDocument xmlDoc;
+        if (tinyxml2::XMLError::XML_SUCCESS == xmlDoc.LoadFile(filename.c_str()))
+        {
+            deferred_count = deferProfiles(xmlDoc, filename);
+            loaded_ret = XMLParser::loadXML(xmlDoc, root_node);
+        }
+    }
+    else
+    {
+        loaded_ret = XMLParser::loadXML(filename, root_node);
+    }
+
     if (!root_node || loaded_ret != XMLP_ret::XML_OK)
     {
         if (filename != std::string(DEFAULT_FASTRTPS_PROFILES))
         {
             logError(XMLPARSER, "Error parsing '" << filename << "'");
         }
+        discard_deferred_profiles(filename);
         xml_files_.emplace(filename, XMLP_ret::XML_ERROR);
         return XMLP_ret::XML_ERROR;
     }
@@ -313,14 +448,14 @@ XMLP_ret XMLProfileManager::loadXMLFile(
         {
             if (NodeType::PROFILES == child.get()->getType())
             {
-                return XMLProfileManager::extractProfiles(std::move(child), filename);
+                return XMLProfileManager::extractProfiles(std::move(child), filename, deferred_count);
             }
         }
         return loaded_ret;
     }
     else if (NodeType::PROFILES == root_node->getType())
     {
-        return XMLProfileManager::extractProfiles(std::move(root_node), filename);
+        return XMLProfileManager::extractProfiles(std::move(root_node), filename, deferred_count);
     }
 
     return loaded_ret;
@@ -328,11 +463,12 @@ XMLP_ret XMLProfileManager::loadXMLFile(
 
 XMLP_ret XMLProfileManager::extractProfiles(
         up_base_node_t profiles,
-        const std::string& filename)
+        const std::string& filename,
+        unsigned int deferred_count)
 {
     assert(profiles != nullptr);
 
-    unsigned int profile_count = 0u;
+    unsigned int profile_count = deferred_count;
 
     XMLP_ret ret = XMLP_ret::XML_OK;
     for (auto&& profile: profiles->getChildren())
@@ -418,6 +554,94 @@ XMLP_ret XMLProfileManager::extractProfiles(
     return ret;
 }
 
+unsigned int XMLProfileManager::deferProfiles(
+        tinyxml2::XMLDocument& doc,
+        const std::string& filename)
+{
+    tinyxml2::XMLElement* p_profiles = doc.FirstChildElement(PROFILES);
+    if (nullptr == p_profiles)
+    {
+        tinyxml2::XMLElement* p_root = doc.FirstChildElement(ROOT);
+        if (nullptr != p_root)
+        {
+            p_profiles = p_root->FirstChildElement(PROFILES);
+        }
+    }
+
+    if (nullptr == p_profiles)
+    {
+        return 0u;
+    }
+
+    std::lock_guard<std::mutex> guard(deferred_profiles_mutex);
+    unsigned int deferred_count = 0u;
+    tinyxml2::XMLElement* p_profile = p_profiles->FirstChildElement();
+    while (nullptr != p_profile)
+    {
+        tinyxml2::XMLElement* p_next = p_profile->NextSiblingElement();
+        const char* kind = deferrable_kind(p_profile->Value());
+        const char* name = p_profile->Attribute(PROFILE_NAME);
+
+        // Default profiles are parsed right away, as well as repeated names, so their errors are reported as usual.
+        if (nullptr != kind && nullptr != name && '\0' != name[0] &&
+                nullptr == p_profile->Attribute(DEFAULT_PROF, "true"))
+        {
+            std::pair<std::string, std::string> key(kind, name);
+            bool exists = deferred_profiles.find(key) != deferred_profiles.end() ||
+                    (PARTICIPANT == kind && participant_profiles_.find(name) != participant_profiles_.end()) ||
+                    (PUBLISHER == kind && publisher_profiles_.find(name) != publisher_profiles_.end()) ||
+                    (SUBSCRIBER == kind && subscriber_profiles_.find(name) != subscriber_profiles_.end()) ||
+                    (TOPIC == kind && topic_profiles_.find(name) != topic_profiles_.end()) ||
+                    (REQUESTER == kind && requester_profiles_.find(name) != requester_profiles_.end()) ||
+                    (REPLIER == kind && replier_profiles_.find(name) != replier_profiles_.end());
+
+            if (!exists)
+            {
+                DeferredProfile deferred{filename, std::unique_ptr<tinyxml2::XMLDocument>(new tinyxml2::XMLDocument())};
+                tinyxml2::XMLElement* p_deferred_profiles = deferred.document->NewElement(PROFILES);
+                deferred.document->InsertEndChild(p_deferred_profiles);
+                p_deferred_profiles->InsertEndChild(p_profile->DeepClone(deferred.document.get()));
+                deferred_profiles.emplace(std::move(key), std::move(deferred));
+                p_profiles->DeleteChild(p_profile);
+                ++deferred_count;
+            }
+        }
+
+        p_profile = p_next;
+    }
+
+    return deferred_count;
+}
+
+bool XMLProfileManager::parseDeferredProfile(
+        const char* kind,
+        const std::string& profile_name)
+{
+    auto it = deferred_profiles.find(std::make_pair(std::string(kind), profile_name));
+    if (it == deferred_profiles.end())
+    {
+        return false;
+    }
+
+    DeferredProfile deferred = std::move(it->second);
+    deferred_profiles.erase(it);
+
+    up_base_node_t root_node;
+    if (XMLP_ret::XML_OK != XMLParser::loadXMLProfiles(*deferred.document->RootElement(), root_node))
+    {
+        logError(XMLPARSER, "Error parsing profile '" << profile_name << "' of '" << deferred.filename << "'");
+        return false;
+    }
+
+    return XMLP_ret::XML_OK == extractProfiles(std::move(root_node), deferred.filename);
+}
+
+void XMLProfileManager::clearDeferredProfiles()
+{
+    std::lock_guard<std::mutex> guard(deferred_profiles_mutex);
+    deferred_profiles.clear();
+}
+
 XMLP_ret XMLProfileManager::extractParticipantProfile(
         up_base_node_t& profile,
         const std::string& filename)
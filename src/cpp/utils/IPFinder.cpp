@@ -22,6 +22,8 @@
 
 #include <fastdds/dds/log/Log.hpp>
 
+#include <utils/InterfacesCache.hpp>
+
 #if defined(_WIN32)
 #pragma comment(lib, "Iphlpapi.lib")
 #include <stdio.h>
@@ -60,9 +62,20 @@
 #include <cstddef>
 #include <cstring>
 #include <algorithm>
+#include <mutex>
 
 using namespace eprosima::fastrtps::rtps;
 
+namespace {
+
+InterfacesCache& interfaces_cache()
+{
+    static InterfacesCache cache;
+    return cache;
+}
+
+} // namespace
+
 IPFinder::IPFinder()
 {
 }
@@ -71,11 +84,40 @@ IPFinder::~IPFinder()
 {
 }
 
+bool IPFinder::getIPs(
+        std::vector<info_IP>* vec_name,
+        bool return_loopback)
+{
+    InterfacesCache& cache = interfaces_cache();
+    std::lock_guard<std::mutex> guard(cache.mutex);
+
+    if (!cache.valid || cache.changed())
+    {
+        cache.ips.clear();
+        cache.start_enumeration();
+        cache.valid = getIPsFromSystem(&cache.ips, true);
+        if (!cache.valid)
+        {
+            return false;
+        }
+    }
+
+    for (const info_IP& info : cache.ips)
+    {
+        if (return_loopback || (info.type != IP6_LOCAL && info.type != IP4_LOCAL))
+        {
+            vec_name->push_back(info);
+        }
+    }
+
+    return true;
+}
+
 #if defined(_WIN32)
 
 #define DEFAULT_ADAPTER_ADDRESSES_SIZE 15360
 
-bool IPFinder::getIPs(
+bool IPFinder::getIPsFromSystem(
         std::vector<info_IP>* vec_name,
         bool return_loopback)
 {
@@ -153,7 +195,7 @@ bool IPFinder::getIPs(
 
 #else
 
-bool IPFinder::getIPs(
+bool IPFinder::getIPsFromSystem(
         std::vector<info_IP>* vec_name,
         bool return_loopback)
 {
@@ -0,0 +1,181 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UTILS_INTERFACESCACHE_HPP_
+#define UTILS_INTERFACESCACHE_HPP_
+
+#include <fastrtps/utils/IPFinder.h>
+
+#include <fastdds/dds/log/Log.hpp>
+
+#if defined(__linux__)
+#include <errno.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif // if defined(__linux__)
+
+#include <chrono>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+//! Age after which the interfaces are enumerated again when the system does not notify changes.
+constexpr std::chrono::seconds c_interfaces_cache_lifetime{1};
+
+/**
+ * Cache of the interfaces of the system, used by IPFinder::getIPs.
+ * On Linux, a netlink socket subscribed to the link and address groups tells whether the interfaces have changed
+ * since the last enumeration. Elsewhere, or if the socket cannot be opened, the enumeration expires after
+ * c_interfaces_cache_lifetime.
+ */
+class InterfacesCache
+{
+public:
+
+    /**
+     * @param listen_to_changes Whether to be notified of the changes on the interfaces, where the system supports it.
+     * When false, the enumeration always expires after c_interfaces_cache_lifetime.
+     */
+    explicit InterfacesCache(
+            bool listen_to_changes = true)
+#if defined(__linux__)
+        : netlink_tried_(!listen_to_changes)
+#endif // if defined(__linux__)
+    {
+        static_cast<void>(listen_to_changes);
+    }
+
+    ~InterfacesCache()
+    {
+#if defined(__linux__)
+        if (-1 != netlink_fd_)
+        {
+            close(netlink_fd_);
+        }
+#endif // if defined(__linux__)
+    }
+
+    //! Protects the cache.
+    std::mutex mutex;
+
+    //! Addresses found on the last enumeration, loopback ones included.
+    std::vector<IPFinder::info_IP> ips;
+
+    //! Whether ips holds a valid enumeration.
+    bool valid = false;
+
+    /**
+     * Called before an enumeration, so any change happening from then on invalidates it.
+     */
+    void start_enumeration()
+    {
+#if defined(__linux__)
+        if (!netlink_tried_)
+        {
+            netlink_tried_ = true;
+            netlink_fd_ = open_netlink_socket();
+        }
+        else if (-1 != netlink_fd_)
+        {
+            // Changes received up to now are covered by the new enumeration.
+            drain_notifications();
+        }
+#endif // if defined(__linux__)
+        enumerated_ = std::chrono::steady_clock::now();
+    }
+
+    /**
+     * Checks whether the cached enumeration may no longer match the interfaces of the system.
+     */
+    bool changed()
+    {
+#if defined(__linux__)
+        if (-1 != netlink_fd_)
+        {
+            return drain_notifications();
+        }
+#endif // if defined(__linux__)
+        return std::chrono::steady_clock::now() - enumerated_ > c_interfaces_cache_lifetime;
+    }
+
+private:
+
+#if defined(__linux__)
+    static int open_netlink_socket()
+    {
+        int fd = socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC | SOCK_NONBLOCK, NETLINK_ROUTE);
+        if (-1 == fd)
+        {
+            return -1;
+        }
+
+        struct sockaddr_nl addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.nl_family = AF_NETLINK;
+        addr.nl_groups = RTMGRP_LINK | RTMGRP_IPV4_IFADDR | RTMGRP_IPV6_IFADDR;
+        if (0 != bind(fd, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)))
+        {
+            logInfo(UTILS, "Cannot listen to interface changes, interfaces will be polled");
+            close(fd);
+            return -1;
+        }
+
+        return fd;
+    }
+
+    //! Discards the pending notifications, returning whether there was any.
+    bool drain_notifications()
+    {
+        bool notified = false;
+        char buffer[4096];
+        while (true)
+        {
+            ssize_t received = recv(netlink_fd_, buffer, sizeof(buffer), MSG_DONTWAIT);
+            if (0 < received)
+            {
+                notified = true;
+            }
+            else if (-1 == received && EINTR == errno)
+            {
+                continue;
+            }
+            else
+            {
+                // ENOBUFS means notifications were lost, so the interfaces may have changed.
+                notified |= (-1 == received && ENOBUFS == errno);
+                break;
+            }
+        }
+        return notified;
+    }
+
+    int netlink_fd_ = -1;
+
+    bool netlink_tried_ = false;
+#endif // if defined(__linux__)
+
+    std::chrono::steady_clock::time_point enumerated_;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // UTILS_INTERFACESCACHE_HPP_
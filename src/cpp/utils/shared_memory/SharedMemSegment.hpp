@@ -43,6 +43,12 @@
 #include "RobustInterprocessCondition.hpp"
 #include "SharedMemUUID.hpp"
 
+#ifdef __linux__
+#include <fstream>
+#include <limits>
+#include <sys/mman.h>
+#endif // ifdef __linux__
+
 namespace eprosima {
 namespace fastdds {
 namespace rtps {
@@ -78,6 +84,9 @@ public:
     // TODO(Adolfo): Further analysis to determine the perfect value for this extra segment size
     static constexpr uint32_t EXTRA_SEGMENT_SIZE = 512;
 
+    // Huge page size assumed when the system doesn't report one
+    static constexpr size_t DEFAULT_HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
     explicit SharedSegmentBase(
             const std::string& name)
         : name_(name)
@@ -162,6 +171,50 @@ public:
         return named_mutex;
     }
 
+    /**
+     * @return The size of the system's huge pages in bytes.
+     */
+    static size_t huge_page_size()
+    {
+        static const size_t page_size = []()
+                {
+                    size_t size = DEFAULT_HUGE_PAGE_SIZE;
+#ifdef __linux__
+                    std::ifstream meminfo("/proc/meminfo");
+                    std::string key;
+                    while (meminfo >> key)
+                    {
+                        if (key == "Hugepagesize:")
+                        {
+                            size_t kb = 0;
+                            if (meminfo >> kb && kb > 0)
+                            {
+                                size = kb * 1024;
+                            }
+                            break;
+                        }
+                        meminfo.ignore((std::numeric_limits<std::streamsize>::max)(), '\n');
+                    }
+#endif // ifdef __linux__
+                    return size;
+                } ();
+
+        return page_size;
+    }
+
+    /**
+     * Rounds up a segment size so it spans a whole number of huge pages.
+     * @param size Requested size in bytes, not including EXTRA_SEGMENT_SIZE.
+     * @return The rounded size, not including EXTRA_SEGMENT_SIZE.
+     */
+    static size_t round_to_huge_pages(
+            size_t size)
+    {
+        size_t page_size = huge_page_size();
+        size_t total = ((size + EXTRA_SEGMENT_SIZE + page_size - 1) / page_size) * page_size;
+        return total - EXTRA_SEGMENT_SIZE;
+    }
+
     /**
      * Unique ID of the segment
      */
@@ -379,6 +432,39 @@ public:
         return segment_->get_size();
     }
 
+    /**
+     * Asks the kernel to back the segment with transparent huge pages.
+     * Must be called before the segment's memory is touched to be effective.
+     * @return true when the advice was accepted, false when huge pages are not available
+     * on this platform, in which case the segment keeps using regular pages.
+     */
+    bool advise_huge_pages()
+    {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+        // madvise requires a page aligned address. Mappings are always page aligned.
+        return 0 == madvise(segment_->get_address(), segment_->get_size(), MADV_HUGEPAGE);
+#else
+        return false;
+#endif // if defined(__linux__) && defined(MADV_HUGEPAGE)
+    }
+
+    /**
+     * Touches every page of the segment, so page faults are taken at creation
+     * instead of in the data path.
+     * The contents of the segment are not modified.
+     */
+    void prefault()
+    {
+        const size_t page_size = 4096;
+        volatile char* address = static_cast<volatile char*>(segment_->get_address());
+        size_t size = segment_->get_size();
+
+        for (size_t offset = 0; offset < size; offset += page_size)
+        {
+            address[offset] = address[offset];
+        }
+    }
+
 private:
 
     std::unique_ptr<managed_shared_memory_type> segment_;
@@ -830,6 +830,27 @@ public:
         return *this;
     }
 
+    PubSubWriter& add_token_bucket_controller_descriptor_to_pparams(
+            eprosima::fastdds::rtps::FlowControllerSchedulerPolicy scheduler_policy,
+            uint32_t bytesPerPeriod,
+            uint32_t periodInMs,
+            uint32_t burstBytes,
+            uint32_t bytesPerPeriodPerLocator)
+    {
+        static const std::string flow_controller_name("MyTokenBucketFlowController");
+        auto new_flow_controller = std::make_shared<eprosima::fastdds::rtps::FlowControllerDescriptor>();
+        new_flow_controller->name = flow_controller_name.c_str();
+        new_flow_controller->scheduler = scheduler_policy;
+        new_flow_controller->max_bytes_per_period = bytesPerPeriod;
+        new_flow_controller->period_ms = static_cast<uint64_t>(periodInMs);
+        new_flow_controller->burst_bytes = burstBytes;
+        new_flow_controller->max_bytes_per_period_per_locator = bytesPerPeriodPerLocator;
+        participant_qos_.flow_controllers().push_back(new_flow_controller);
+        datawriter_qos_.publish_mode().flow_controller_name = flow_controller_name.c_str();
+
+        return *this;
+    }
+
     PubSubWriter& asynchronously(
             const eprosima::fastrtps::PublishModeQosPolicyKind kind)
     {
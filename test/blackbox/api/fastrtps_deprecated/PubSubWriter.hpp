@@ -693,6 +693,20 @@ public:
         return *this;
     }
 
+    PubSubWriter& add_token_bucket_controller_descriptor_to_pparams(
+            eprosima::fastdds::rtps::FlowControllerSchedulerPolicy,
+            uint32_t bytesPerPeriod,
+            uint32_t periodInMs,
+            uint32_t,
+            uint32_t)
+    {
+        // Token bucket flow controllers are not available on this API.
+        eprosima::fastrtps::rtps::ThroughputControllerDescriptor descriptor {bytesPerPeriod, periodInMs};
+        publisher_attr_.throughputController = descriptor;
+
+        return *this;
+    }
+
     PubSubWriter& asynchronously(
             const eprosima::fastrtps::PublishModeQosPolicyKind kind)
     {
@@ -18,11 +18,17 @@
 #include "PubSubWriter.hpp"
 #include "PubSubWriterReader.hpp"
 #include <fastrtps/xmlparser/XMLProfileManager.h>
+#include <fastdds/rtps/transport/test_UDPv4TransportDescriptor.h>
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <memory>
+#include <mutex>
+
 using namespace eprosima::fastrtps;
 using namespace eprosima::fastrtps::rtps;
+using test_UDPv4TransportDescriptor = eprosima::fastdds::rtps::test_UDPv4TransportDescriptor;
 
 class PubSubFlowControllers : public testing::TestWithParam<eprosima::fastdds::rtps::FlowControllerSchedulerPolicy>
 {
@@ -39,6 +45,113 @@ public:
 
 protected:
 
+    struct SlowPeerResult
+    {
+        //! Time until the reader with a fast link received all the samples.
+        std::chrono::duration<double> fast_reception_time;
+
+        //! Time until the reader with a slow link received all the samples.
+        std::chrono::duration<double> slow_reception_time;
+
+        //! Bytes dropped by the slow link.
+        uint64_t dropped_bytes = 0;
+    };
+
+    /*!
+     * Sends 64kb samples through a token bucket flow controller to two readers, one of them behind an emulated link
+     * that drops what exceeds 400000 bytes per second.
+     *
+     * @param bytes_per_period_per_locator Bytes sent to each destination locator each 100 ms, 0 to disable the
+     * per-locator shaping.
+     * @param result Reception times of both readers and bytes dropped by the slow link.
+     */
+    void send_with_slow_peer(
+            uint32_t bytes_per_period_per_locator,
+            SlowPeerResult& result)
+    {
+        PubSubReader<Data64kbType> fast_reader(TEST_TOPIC_NAME);
+        PubSubReader<Data64kbType> slow_reader(TEST_TOPIC_NAME);
+        PubSubWriter<Data64kbType> writer(TEST_TOPIC_NAME);
+
+        fast_reader.history_depth(10).
+                reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS).init();
+        ASSERT_TRUE(fast_reader.isInitialized());
+
+        uint32_t slow_port = global_port;
+        slow_reader.history_depth(10).
+                add_to_unicast_locator_list("127.0.0.1", slow_port).
+                reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS).init();
+        ASSERT_TRUE(slow_reader.isInitialized());
+
+        struct EmulatedLink
+        {
+            std::mutex mutex;
+            double tokens = 136000;
+            std::chrono::steady_clock::time_point last = std::chrono::steady_clock::now();
+            uint64_t dropped_bytes = 0;
+        };
+        auto link = std::make_shared<EmulatedLink>();
+        auto testTransport = std::make_shared<test_UDPv4TransportDescriptor>();
+        testTransport->destination_messages_filter_ = [link, slow_port](const Locator_t& destination, uint32_t size)
+                {
+                    if (destination.port != slow_port)
+                    {
+                        return false;
+                    }
+
+                    std::lock_guard<std::mutex> guard(link->mutex);
+                    auto now = std::chrono::steady_clock::now();
+                    std::chrono::duration<double> elapsed = now - link->last;
+                    link->last = now;
+                    link->tokens = (std::min)(136000.0, link->tokens + elapsed.count() * 400000.0);
+                    if (link->tokens < size)
+                    {
+                        link->dropped_bytes += size;
+                        return true;
+                    }
+                    link->tokens -= size;
+                    return false;
+                };
+        writer.disable_builtin_transport();
+        writer.add_user_transport_to_pparams(testTransport);
+
+        uint32_t bytesPerPeriod = 204000;
+        uint32_t periodInMs = 100;
+        uint32_t burstBytes = 136000;
+        writer.add_token_bucket_controller_descriptor_to_pparams(scheduler_policy_, bytesPerPeriod, periodInMs,
+                burstBytes, bytes_per_period_per_locator);
+
+        writer.history_kind(eprosima::fastrtps::KEEP_ALL_HISTORY_QOS).
+                asynchronously(eprosima::fastrtps::ASYNCHRONOUS_PUBLISH_MODE).init();
+
+        ASSERT_TRUE(writer.isInitialized());
+
+        // Wait for discovery.
+        writer.wait_discovery(2);
+        fast_reader.wait_discovery();
+        slow_reader.wait_discovery();
+
+        auto data = default_data64kb_data_generator(10);
+
+        fast_reader.startReception(data);
+        slow_reader.startReception(data);
+
+        // Send data
+        auto start = std::chrono::steady_clock::now();
+        writer.send(data);
+        // In this test all data should be sent.
+        ASSERT_TRUE(data.empty());
+
+        // Both readers receive all the data.
+        fast_reader.block_for_all();
+        result.fast_reception_time = std::chrono::steady_clock::now() - start;
+        slow_reader.block_for_all();
+        result.slow_reception_time = std::chrono::steady_clock::now() - start;
+
+        std::lock_guard<std::mutex> guard(link->mutex);
+        result.dropped_bytes = link->dropped_bytes;
+    }
+
     eprosima::fastdds::rtps::FlowControllerSchedulerPolicy scheduler_policy_;
 };
 
@@ -228,6 +341,25 @@ TEST_P(PubSubFlowControllers, AsyncMultipleWritersFlowController64kb)
     entities.block_for_all();
 }
 
+TEST_P(PubSubFlowControllers, AsyncPubSubAsReliableData64kbWithTokenBucketAndSlowPeer)
+{
+    // The writer can send 2 MB/s, and 340 KB/s to each destination when shaping per locator.
+    SlowPeerResult shaped;
+    ASSERT_NO_FATAL_FAILURE(send_with_slow_peer(34000, shaped));
+    SlowPeerResult unshaped;
+    ASSERT_NO_FATAL_FAILURE(send_with_slow_peer(0, unshaped));
+
+    // Without per-locator shaping the slow link is flooded and most of the data has to be repaired.
+    EXPECT_LT(0u, unshaped.dropped_bytes);
+    // Shaping each destination below the rate of the slow link, nothing is lost on it.
+    EXPECT_EQ(0u, shaped.dropped_bytes);
+
+    // Each peer is served at the rate of its own bucket, so the slow peer falls behind the fast one less than when
+    // all the destinations share the writer's bucket.
+    EXPECT_LT(shaped.slow_reception_time.count() * unshaped.fast_reception_time.count(),
+            unshaped.slow_reception_time.count() * shaped.fast_reception_time.count());
+}
+
 #ifdef INSTANTIATE_TEST_SUITE_P
 #define GTEST_INSTANTIATE_TEST_MACRO(x, y, z, w) INSTANTIATE_TEST_SUITE_P(x, y, z, w)
 #else
@@ -240,13 +372,17 @@ GTEST_INSTANTIATE_TEST_MACRO(PubSubFlowControllers,
             eprosima::fastdds::rtps::FlowControllerSchedulerPolicy::FIFO,
             eprosima::fastdds::rtps::FlowControllerSchedulerPolicy::ROUND_ROBIN,
             eprosima::fastdds::rtps::FlowControllerSchedulerPolicy::HIGH_PRIORITY,
-            eprosima::fastdds::rtps::FlowControllerSchedulerPolicy::PRIORITY_WITH_RESERVATION
+            eprosima::fastdds::rtps::FlowControllerSchedulerPolicy::PRIORITY_WITH_RESERVATION,
+            eprosima::fastdds::rtps::FlowControllerSchedulerPolicy::EARLIEST_DEADLINE_FIRST
             ),
         [](const testing::TestParamInfo<PubSubFlowControllers::ParamType>& info)
         {
             std::string suffix;
             switch (info.param)
             {
+                case eprosima::fastdds::rtps::FlowControllerSchedulerPolicy::EARLIEST_DEADLINE_FIRST:
+                    suffix = "_SCHED_EDF";
+                    break;
                 case eprosima::fastdds::rtps::FlowControllerSchedulerPolicy::PRIORITY_WITH_RESERVATION:
                     suffix = "_SCHED_RESERV";
                     break;
@@ -725,13 +725,17 @@ GTEST_INSTANTIATE_TEST_MACRO(PubSubFragments,
                 eprosima::fastdds::rtps::FlowControllerSchedulerPolicy::FIFO,
                 eprosima::fastdds::rtps::FlowControllerSchedulerPolicy::ROUND_ROBIN,
                 eprosima::fastdds::rtps::FlowControllerSchedulerPolicy::HIGH_PRIORITY,
-                eprosima::fastdds::rtps::FlowControllerSchedulerPolicy::PRIORITY_WITH_RESERVATION
+                eprosima::fastdds::rtps::FlowControllerSchedulerPolicy::PRIORITY_WITH_RESERVATION,
+                eprosima::fastdds::rtps::FlowControllerSchedulerPolicy::EARLIEST_DEADLINE_FIRST
                 )),
         [](const testing::TestParamInfo<PubSubFragments::ParamType>& info)
         {
             std::string suffix;
             switch (std::get<1>(info.param))
             {
+                case eprosima::fastdds::rtps::FlowControllerSchedulerPolicy::EARLIEST_DEADLINE_FIRST:
+                    suffix = "_SCHED_EDF";
+                    break;
                 case eprosima::fastdds::rtps::FlowControllerSchedulerPolicy::PRIORITY_WITH_RESERVATION:
                     suffix = "_SCHED_RESERV";
                     break;
@@ -764,13 +768,17 @@ GTEST_INSTANTIATE_TEST_MACRO(PubSubFragmentsLimited,
             eprosima::fastdds::rtps::FlowControllerSchedulerPolicy::FIFO,
             eprosima::fastdds::rtps::FlowControllerSchedulerPolicy::ROUND_ROBIN,
             eprosima::fastdds::rtps::FlowControllerSchedulerPolicy::HIGH_PRIORITY,
-            eprosima::fastdds::rtps::FlowControllerSchedulerPolicy::PRIORITY_WITH_RESERVATION
+            eprosima::fastdds::rtps::FlowControllerSchedulerPolicy::PRIORITY_WITH_RESERVATION,
+            eprosima::fastdds::rtps::FlowControllerSchedulerPolicy::EARLIEST_DEADLINE_FIRST
             ),
         [](const testing::TestParamInfo<PubSubFragmentsLimited::ParamType>& info)
         {
             std::string suffix;
             switch (info.param)
             {
+                case eprosima::fastdds::rtps::FlowControllerSchedulerPolicy::EARLIEST_DEADLINE_FIRST:
+                    suffix = "_SCHED_EDF";
+                    break;
                 case eprosima::fastdds::rtps::FlowControllerSchedulerPolicy::PRIORITY_WITH_RESERVATION:
                     suffix = "_SCHED_RESERV";
                     break;
@@ -12,16 +12,20 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <atomic>
 #include <chrono>
 #include <cstdlib>
 #include <ctime>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
 #include "BlackboxTests.hpp"
 #include "PubSubParticipant.hpp"
 #include "PubSubReader.hpp"
+#include "PubSubWriter.hpp"
 
 #include <fastdds/dds/core/policy/QosPolicies.hpp>
 #include <fastdds/rtps/common/Locator.h>
@@ -168,3 +172,81 @@ TEST(DDSDiscovery, AddDiscoveryServerToList)
     server_2.wait_discovery(std::chrono::seconds::zero(), 2, true);
 }
 
+/**
+ * This test checks that endpoints are matched only with the endpoints on their topic, when their partitions match.
+ * Writers use plain partitions and readers use a wildcard partition. The writer on the second topic only matches
+ * the reader of that topic once its partition is updated to one matching the wildcard.
+ */
+TEST(DDSDiscovery, TopicsAndWildcardPartitionsMatch)
+{
+    PubSubWriter<HelloWorldType> writer_a(TEST_TOPIC_NAME + "_a");
+    writer_a.partition("sensors/front").init();
+    ASSERT_TRUE(writer_a.isInitialized());
+
+    PubSubWriter<HelloWorldType> writer_b(TEST_TOPIC_NAME + "_b");
+    writer_b.partition("actuators/front").init();
+    ASSERT_TRUE(writer_b.isInitialized());
+
+    PubSubReader<HelloWorldType> reader_a(TEST_TOPIC_NAME + "_a");
+    reader_a.partition("sensors/*").init();
+    ASSERT_TRUE(reader_a.isInitialized());
+
+    PubSubReader<HelloWorldType> reader_b(TEST_TOPIC_NAME + "_b");
+    reader_b.partition("sensors/*").init();
+    ASSERT_TRUE(reader_b.isInitialized());
+
+    // Same topic and matching partition
+    reader_a.wait_discovery();
+    writer_a.wait_discovery(1u);
+
+    // Same topic and unmatching partition, and matching partition on another topic
+    reader_b.wait_discovery(std::chrono::seconds(1));
+    EXPECT_FALSE(reader_b.is_matched());
+    EXPECT_FALSE(writer_b.is_matched());
+
+    // The partition of the writer on the second topic now matches the wildcard
+    ASSERT_TRUE(writer_b.update_partition("sensors/rear"));
+    reader_b.wait_discovery();
+    writer_b.wait_discovery(1u);
+}
+
+/**
+ * This test checks that the periodic announcements of a participant do not notify a change on its discovery info,
+ * unless its QoS has actually changed.
+ * The first participant announces itself every 100 ms. The second participant counts the notifications of changed QoS
+ * before and after the user data of the first participant is updated.
+ */
+TEST(DDSDiscovery, UnchangedAnnouncementsDoNotNotifyQosChanges)
+{
+    using namespace eprosima::fastdds::dds;
+    using namespace eprosima::fastrtps::rtps;
+
+    PubSubParticipant<HelloWorldType> participant_1(0u, 0u, 0u, 0u);
+    WireProtocolConfigQos wire_protocol_qos;
+    wire_protocol_qos.builtin.discovery_config.leaseDuration_announcementperiod =
+            eprosima::fastrtps::Duration_t(0, 100000000);
+    ASSERT_TRUE(participant_1.wire_protocol(wire_protocol_qos).init_participant());
+
+    std::atomic<uint32_t> qos_updates(0u);
+    PubSubParticipant<HelloWorldType> participant_2(0u, 0u, 0u, 0u);
+    participant_2.set_on_participant_qos_update_function([&](const ParticipantDiscoveryInfo& info) -> bool
+            {
+                ++qos_updates;
+                return info.info.m_userData == std::vector<octet>({'a', 'b'});
+            });
+    ASSERT_TRUE(participant_2.init_participant());
+
+    participant_1.wait_discovery();
+    participant_2.wait_discovery();
+
+    // Several announcements are received, all of them identical
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+    EXPECT_EQ(0u, qos_updates.load());
+
+    // Update user data
+    ASSERT_TRUE(participant_1.update_user_data({'a', 'b'}));
+    participant_2.wait_qos_update();
+
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+    EXPECT_EQ(1u, qos_updates.load());
+}
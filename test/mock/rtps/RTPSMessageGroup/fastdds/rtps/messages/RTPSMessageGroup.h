@@ -63,6 +63,10 @@ public:
     {
     }
 
+    void flush_referenced_payloads() const
+    {
+    }
+
 };
 
 } // namespace rtps
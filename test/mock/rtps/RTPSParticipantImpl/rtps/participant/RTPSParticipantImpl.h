@@ -26,6 +26,7 @@
 #include <fastrtps/rtps/reader/RTPSReader.h>
 #include <fastrtps/rtps/resources/ResourceEvent.h>
 #include <fastrtps/rtps/network/NetworkFactory.h>
+#include <rtps/messages/RTPSMessageGroup_t.hpp>
 
 #if HAVE_SECURITY
 #include <rtps/security/SecurityManager.h>
@@ -131,6 +132,9 @@ public:
     MOCK_METHOD0(userReadersListBegin, std::vector<RTPSReader*>::iterator ());
     MOCK_METHOD0(userReadersListEnd, std::vector<RTPSReader*>::iterator ());
 
+    MOCK_CONST_METHOD1(user_readers_on_topic, const std::vector<RTPSReader*>& (const std::string&));
+    MOCK_CONST_METHOD1(user_writers_on_topic, const std::vector<RTPSWriter*>& (const std::string&));
+
     MOCK_CONST_METHOD0(getParticipantMutex, std::recursive_mutex* ());
 
     bool createWriter(
@@ -245,6 +249,20 @@ public:
         return 65536;
     }
 
+    std::unique_ptr<RTPSMessageGroup_t> get_send_buffer()
+    {
+        return std::unique_ptr<RTPSMessageGroup_t>(new RTPSMessageGroup_t(
+#if HAVE_SECURITY
+                           false,
+#endif // if HAVE_SECURITY
+                           getMaxMessageSize(), getGuid().guidPrefix));
+    }
+
+    void return_send_buffer(
+            std::unique_ptr <RTPSMessageGroup_t>&& /*buffer*/)
+    {
+    }
+
     const RTPSParticipantAttributes& getRTPSParticipantAttributes() const
     {
         return attr_;
@@ -31,6 +31,15 @@
 #include <gmock/gmock.h>
 
 namespace eprosima {
+
+namespace fastdds {
+namespace rtps {
+
+class LocatorTrafficShaper;
+
+} // namespace rtps
+} // namespace fastdds
+
 namespace fastrtps {
 namespace rtps {
 
@@ -98,6 +107,10 @@ public:
 
 #endif // FASTDDS_STATISTICS
 
+    void on_gap()
+    {
+    }
+
     // *INDENT-OFF* Uncrustify makes a mess with MOCK_METHOD macros
     MOCK_METHOD3(new_change, CacheChange_t* (
             const std::function<uint32_t()>&,
@@ -139,12 +152,13 @@ public:
             const LocatorSelectorSender&,
             std::chrono::steady_clock::time_point&));
 
-    // *INDENT-ON*
+    MOCK_METHOD4(send_nts, bool(
+            const std::vector<NetworkBuffer>&,
+            uint32_t,
+            const LocatorSelectorSender&,
+            std::chrono::steady_clock::time_point&));
 
-    const GUID_t& getGuid() const
-    {
-        return m_guid;
-    }
+    // *INDENT-ON*
 
     EndpointAttributes& getAttributes()
     {
@@ -237,12 +251,16 @@ public:
         return async_locator_selector_;
     }
 
+    void traffic_shaper(
+            fastdds::rtps::LocatorTrafficShaper* traffic_shaper)
+    {
+        traffic_shaper_ = traffic_shaper;
+    }
+
     WriterHistory* history_;
 
     WriterListener* listener_;
 
-    GUID_t m_guid;
-
     WriterAttributes m_att;
 
     LivelinessLostStatus liveliness_lost_status_;
@@ -250,6 +268,8 @@ public:
     LocatorSelectorSender general_locator_selector_ = LocatorSelectorSender(*this, ResourceLimitedContainerConfig());
 
     LocatorSelectorSender async_locator_selector_ = LocatorSelectorSender(*this, ResourceLimitedContainerConfig());
+
+    fastdds::rtps::LocatorTrafficShaper* traffic_shaper_ = nullptr;
 };
 
 } // namespace rtps
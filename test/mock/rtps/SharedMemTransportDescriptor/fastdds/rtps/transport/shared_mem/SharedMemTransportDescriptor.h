@@ -106,12 +106,60 @@ typedef struct SharedMemTransportDescriptor : public TransportDescriptorInterfac
         rtps_dump_file_ = rtps_dump_file;
     }
 
+    RTPS_DllAPI uint32_t listener_busy_poll_us() const
+    {
+        return listener_busy_poll_us_;
+    }
+
+    RTPS_DllAPI void listener_busy_poll_us(
+            uint32_t listener_busy_poll_us)
+    {
+        listener_busy_poll_us_ = listener_busy_poll_us;
+    }
+
+    RTPS_DllAPI bool listener_busy_poll_only() const
+    {
+        return listener_busy_poll_only_;
+    }
+
+    RTPS_DllAPI void listener_busy_poll_only(
+            bool listener_busy_poll_only)
+    {
+        listener_busy_poll_only_ = listener_busy_poll_only;
+    }
+
+    RTPS_DllAPI bool huge_pages() const
+    {
+        return huge_pages_;
+    }
+
+    RTPS_DllAPI void huge_pages(
+            bool huge_pages)
+    {
+        huge_pages_ = huge_pages;
+    }
+
+    RTPS_DllAPI bool lazy_segment() const
+    {
+        return lazy_segment_;
+    }
+
+    RTPS_DllAPI void lazy_segment(
+            bool lazy_segment)
+    {
+        lazy_segment_ = lazy_segment;
+    }
+
 private:
 
     uint32_t segment_size_;
     uint32_t port_queue_capacity_;
     uint32_t healthy_check_timeout_ms_;
     std::string rtps_dump_file_;
+    uint32_t listener_busy_poll_us_;
+    bool listener_busy_poll_only_;
+    bool huge_pages_;
+    bool lazy_segment_;
 
 }SharedMemTransportDescriptor;
 
@@ -167,6 +167,10 @@ typedef struct TCPTransportDescriptor : public SocketTransportDescriptor
     bool enable_tcp_nodelay;
     bool calculate_crc;
     bool check_crc;
+    uint32_t reactor_threads;
+    bool enable_write_coalescing;
+    uint32_t write_coalescing_max_latency_us;
+    bool enable_tcp_cork;
     bool apply_security;
 
     TLSConfig tls_config;
@@ -0,0 +1,240 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_AnnouncementsTest.cpp
+ *
+ * Measures the CPU time spent by participants that only announce themselves at a fixed period.
+ * All the participants live in this process and have no user endpoints, so the CPU time of the process is spent
+ * sending and processing participant announcements. It is measured with the
+ * fastdds.discovery.skip_unchanged_announcements property enabled and disabled.
+ */
+
+#include "../optionarg.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/domain/DomainParticipantListener.hpp>
+#include <fastdds/dds/domain/qos/DomainParticipantQos.hpp>
+#include <fastdds/dds/log/Log.hpp>
+
+using namespace eprosima::fastdds::dds;
+using namespace eprosima::fastrtps::rtps;
+
+enum  optionIndex
+{
+    UNKNOWN_OPT,
+    HELP,
+    PARTICIPANTS,
+    PERIOD,
+    SECONDS,
+    DOMAIN_ID
+};
+
+const option::Descriptor usage[] = {
+    { UNKNOWN_OPT,     0, "",  "",                Arg::None,
+      "Usage: AnnouncementsTest\n\nGeneral options:" },
+    { HELP,            0, "h", "help",            Arg::None,
+      "  -h           --help                Produce help message." },
+    { PARTICIPANTS,    0, "p", "participants",    Arg::Numeric,
+      "  -p <num>,    --participants=<num>  Number of participants (Default: 20)." },
+    { PERIOD,          0, "a", "period",          Arg::Numeric,
+      "  -a <num>,    --period=<num>        Announcement period in milliseconds (Default: 100)." },
+    { SECONDS,         0, "s", "seconds",         Arg::Numeric,
+      "  -s <num>,    --seconds=<num>       Duration of each measurement in seconds (Default: 5)." },
+    { DOMAIN_ID,       0, "d", "domain",          Arg::Numeric,
+      "  -d <num>,    --domain=<num>        Domain of the participants (Default: 0)." },
+    { 0, 0, 0, 0, 0, 0 }
+};
+
+//! Counts the participants discovered by all the participants it listens to.
+class DiscoveryListener : public DomainParticipantListener
+{
+public:
+
+    void on_participant_discovery(
+            DomainParticipant* /*participant*/,
+            ParticipantDiscoveryInfo&& info) override
+    {
+        if (ParticipantDiscoveryInfo::DISCOVERED_PARTICIPANT == info.status)
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            ++discovered_;
+            cv_.notify_one();
+        }
+    }
+
+    bool wait_discovered(
+            size_t expected,
+            const std::chrono::seconds& timeout)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return cv_.wait_for(lock, timeout, [&]()
+                       {
+                           return discovered_ >= expected;
+                       });
+    }
+
+private:
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    size_t discovered_ = 0;
+};
+
+/**
+ * Keeps the participants announcing themselves and measures the CPU time of the process.
+ * @return CPU time in milliseconds, or a negative value if the participants could not be created or discovered.
+ */
+static double measure_cpu_ms(
+        uint32_t domain,
+        uint32_t num_participants,
+        uint32_t period_ms,
+        uint32_t seconds,
+        bool skip_unchanged)
+{
+    DomainParticipantFactory* factory = DomainParticipantFactory::get_instance();
+    DomainParticipantQos qos = factory->get_default_participant_qos();
+    qos.wire_protocol().builtin.discovery_config.leaseDuration_announcementperiod =
+            eprosima::fastrtps::Duration_t(static_cast<int32_t>(period_ms / 1000), (period_ms % 1000) * 1000000u);
+    qos.properties().properties().emplace_back("fastdds.discovery.skip_unchanged_announcements",
+            skip_unchanged ? "true" : "false");
+
+    DiscoveryListener listener;
+    std::vector<DomainParticipant*> participants;
+    double cpu_ms = -1;
+    for (uint32_t i = 0; i < num_participants; ++i)
+    {
+        DomainParticipant* participant = factory->create_participant(domain, qos, &listener);
+        if (nullptr == participant)
+        {
+            std::cout << "Error creating participant " << i << std::endl;
+            break;
+        }
+        participants.push_back(participant);
+    }
+
+    if (participants.size() == num_participants)
+    {
+        if (listener.wait_discovered(static_cast<size_t>(num_participants) * (num_participants - 1),
+                std::chrono::seconds(60)))
+        {
+            // Let the initial announcements pass
+            std::this_thread::sleep_for(std::chrono::seconds(1));
+
+            std::clock_t start = std::clock();
+            std::this_thread::sleep_for(std::chrono::seconds(seconds));
+            cpu_ms = 1000.0 * static_cast<double>(std::clock() - start) / CLOCKS_PER_SEC;
+        }
+        else
+        {
+            std::cout << "Not all the participants were discovered" << std::endl;
+        }
+    }
+
+    for (DomainParticipant* participant : participants)
+    {
+        factory->delete_participant(participant);
+    }
+    return cpu_ms;
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    int columns = 80;
+    uint32_t num_participants = 20;
+    uint32_t period_ms = 100;
+    uint32_t seconds = 5;
+    uint32_t domain = 0;
+
+    argc -= (argc > 0); argv += (argc > 0); // skip program name argv[0] if present
+    option::Stats stats(usage, argc, argv);
+    std::vector<option::Option> options(stats.options_max);
+    std::vector<option::Option> buffer(stats.buffer_max);
+    option::Parser parse(usage, argc, argv, &options[0], &buffer[0]);
+
+    if (parse.error())
+    {
+        return 1;
+    }
+
+    if (options[HELP])
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 0;
+    }
+
+    for (int i = 0; i < parse.optionsCount(); ++i)
+    {
+        option::Option& opt = buffer[i];
+        switch (opt.index())
+        {
+            case PARTICIPANTS:
+                num_participants = strtol(opt.arg, nullptr, 10);
+                break;
+            case PERIOD:
+                period_ms = strtol(opt.arg, nullptr, 10);
+                break;
+            case SECONDS:
+                seconds = strtol(opt.arg, nullptr, 10);
+                break;
+            case DOMAIN_ID:
+                domain = strtol(opt.arg, nullptr, 10);
+                break;
+            default:
+                break;
+        }
+    }
+
+    if (num_participants < 2 || 0 == period_ms || 0 == seconds)
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 1;
+    }
+
+    std::cout << "Participants: " << num_participants << ", announcement period: " << period_ms << " ms, duration: "
+              << seconds << " s" << std::endl;
+
+    // Announcements received by all the participants during a measurement
+    double announcements = static_cast<double>(num_participants) * (num_participants - 1) * seconds * 1000 / period_ms;
+    int result = 0;
+    for (bool skip_unchanged : {true, false})
+    {
+        double cpu_ms = measure_cpu_ms(domain, num_participants, period_ms, seconds, skip_unchanged);
+        if (cpu_ms < 0)
+        {
+            result = 1;
+            break;
+        }
+
+        std::cout << std::fixed << std::setprecision(3) << "Unchanged announcements "
+                  << (skip_unchanged ? "skipped" : "parsed") << ": " << cpu_ms << " ms CPU, "
+                  << 1000 * cpu_ms / announcements << " us per received announcement" << std::endl;
+    }
+
+    Log::Reset();
+    return result;
+}
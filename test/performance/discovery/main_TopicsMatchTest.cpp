@@ -0,0 +1,307 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_TopicsMatchTest.cpp
+ *
+ * Measures the time needed to match the endpoints of two participants with many topics.
+ * The first participant has a writer on each topic, on a partition. The second participant is created afterwards,
+ * and has a reader on each topic, on a wildcard partition matching the one of the writers.
+ */
+
+#include "../optionarg.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/domain/DomainParticipantListener.hpp>
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/subscriber/Subscriber.hpp>
+#include <fastdds/dds/topic/TopicDataType.hpp>
+#include <fastdds/dds/topic/TypeSupport.hpp>
+
+using namespace eprosima::fastdds::dds;
+using namespace eprosima::fastrtps::rtps;
+
+enum  optionIndex
+{
+    UNKNOWN_OPT,
+    HELP,
+    TOPICS,
+    DOMAIN_ID
+};
+
+const option::Descriptor usage[] = {
+    { UNKNOWN_OPT,     0, "",  "",                Arg::None,
+      "Usage: TopicsMatchTest\n\nGeneral options:" },
+    { HELP,            0, "h", "help",            Arg::None,
+      "  -h           --help                Produce help message." },
+    { TOPICS,          0, "t", "topics",          Arg::Numeric,
+      "  -t <num>,    --topics=<num>        Number of topics, with a writer and a reader each (Default: 200)." },
+    { DOMAIN_ID,       0, "d", "domain",          Arg::Numeric,
+      "  -d <num>,    --domain=<num>        Domain of the participants (Default: 0)." },
+    { 0, 0, 0, 0, 0, 0 }
+};
+
+//! Type of the topics, whose samples are never written.
+class MatchType : public TopicDataType
+{
+public:
+
+    MatchType()
+    {
+        setName("MatchType");
+        m_typeSize = 4;
+    }
+
+    bool serialize(
+            void*,
+            SerializedPayload_t*) override
+    {
+        return false;
+    }
+
+    bool deserialize(
+            SerializedPayload_t*,
+            void*) override
+    {
+        return false;
+    }
+
+    std::function<uint32_t()> getSerializedSizeProvider(
+            void*) override
+    {
+        return []()
+               {
+                   return 4u;
+               };
+    }
+
+    void* createData() override
+    {
+        return new uint32_t();
+    }
+
+    void deleteData(
+            void* data) override
+    {
+        delete static_cast<uint32_t*>(data);
+    }
+
+    bool getKey(
+            void*,
+            InstanceHandle_t*,
+            bool) override
+    {
+        return false;
+    }
+
+};
+
+//! Counts the endpoints of a participant matched for the first time.
+class MatchedListener : public DomainParticipantListener
+{
+public:
+
+    void on_publication_matched(
+            DataWriter* /*writer*/,
+            const PublicationMatchedStatus& info) override
+    {
+        matched(info.current_count_change);
+    }
+
+    void on_subscription_matched(
+            DataReader* /*reader*/,
+            const SubscriptionMatchedStatus& info) override
+    {
+        matched(info.current_count_change);
+    }
+
+    bool wait_matched(
+            size_t expected,
+            const std::chrono::seconds& timeout)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return cv_.wait_for(lock, timeout, [&]()
+                       {
+                           return matched_ >= expected;
+                       });
+    }
+
+private:
+
+    void matched(
+            int32_t count_change)
+    {
+        if (0 < count_change)
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            ++matched_;
+            cv_.notify_one();
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    size_t matched_ = 0;
+};
+
+/**
+ * Creates a participant with an endpoint on each topic.
+ * @return The participant, or nullptr if any entity could not be created.
+ */
+static DomainParticipant* create_participant(
+        uint32_t domain,
+        uint32_t num_topics,
+        bool writers,
+        MatchedListener& listener)
+{
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(domain, PARTICIPANT_QOS_DEFAULT, &listener);
+    if (nullptr == participant)
+    {
+        return nullptr;
+    }
+
+    TypeSupport type(new MatchType());
+    if (ReturnCode_t::RETCODE_OK != type.register_type(participant))
+    {
+        return participant;
+    }
+
+    Publisher* publisher = nullptr;
+    Subscriber* subscriber = nullptr;
+    if (writers)
+    {
+        PublisherQos publisher_qos;
+        publisher_qos.partition().push_back("sensors/front");
+        publisher = participant->create_publisher(publisher_qos);
+    }
+    else
+    {
+        SubscriberQos subscriber_qos;
+        subscriber_qos.partition().push_back("sensors/*");
+        subscriber = participant->create_subscriber(subscriber_qos);
+    }
+
+    for (uint32_t i = 0; i < num_topics; ++i)
+    {
+        Topic* topic = participant->create_topic("TopicsMatchTest_" + std::to_string(i), type.get_type_name(),
+                        TOPIC_QOS_DEFAULT);
+        if (nullptr == topic ||
+                (nullptr != publisher && nullptr == publisher->create_datawriter(topic, DATAWRITER_QOS_DEFAULT)) ||
+                (nullptr != subscriber && nullptr == subscriber->create_datareader(topic, DATAREADER_QOS_DEFAULT)))
+        {
+            std::cout << "Error creating the endpoint on topic " << i << std::endl;
+            break;
+        }
+    }
+
+    return participant;
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    int columns = 80;
+    uint32_t num_topics = 200;
+    uint32_t domain = 0;
+
+    argc -= (argc > 0); argv += (argc > 0); // skip program name argv[0] if present
+    option::Stats stats(usage, argc, argv);
+    std::vector<option::Option> options(stats.options_max);
+    std::vector<option::Option> buffer(stats.buffer_max);
+    option::Parser parse(usage, argc, argv, &options[0], &buffer[0]);
+
+    if (parse.error())
+    {
+        return 1;
+    }
+
+    if (options[HELP])
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 0;
+    }
+
+    for (int i = 0; i < parse.optionsCount(); ++i)
+    {
+        option::Option& opt = buffer[i];
+        switch (opt.index())
+        {
+            case TOPICS:
+                num_topics = strtol(opt.arg, nullptr, 10);
+                break;
+            case DOMAIN_ID:
+                domain = strtol(opt.arg, nullptr, 10);
+                break;
+            default:
+                break;
+        }
+    }
+
+    if (0 == num_topics)
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 1;
+    }
+
+    std::cout << "Topics: " << num_topics << std::endl;
+
+    DomainParticipantFactory* factory = DomainParticipantFactory::get_instance();
+    MatchedListener writers_listener;
+    MatchedListener readers_listener;
+    int result = 1;
+
+    DomainParticipant* writers_participant = create_participant(domain, num_topics, true, writers_listener);
+    auto start = std::chrono::steady_clock::now();
+    DomainParticipant* readers_participant = create_participant(domain, num_topics, false, readers_listener);
+    if (nullptr == writers_participant || nullptr == readers_participant)
+    {
+        std::cout << "Error creating the participants" << std::endl;
+    }
+    else if (!writers_listener.wait_matched(num_topics, std::chrono::seconds(60)) ||
+            !readers_listener.wait_matched(num_topics, std::chrono::seconds(60)))
+    {
+        std::cout << "Not all the endpoints were matched" << std::endl;
+    }
+    else
+    {
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - start);
+        std::cout << num_topics << " topics matched in " << elapsed.count() << " ms" << std::endl;
+        result = 0;
+    }
+
+    for (DomainParticipant* participant : {readers_participant, writers_participant})
+    {
+        if (nullptr != participant)
+        {
+            participant->delete_contained_entities();
+            factory->delete_participant(participant);
+        }
+    }
+
+    Log::Reset();
+    return result;
+}
@@ -0,0 +1,233 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_FlowControllerShardsTest.cpp
+ *
+ * Measures the aggregate throughput of many asynchronous writers sharing a flow controller, sending with a single
+ * thread and with several sender threads.
+ * Each delivery sleeps for a configurable time, emulating the time spent on the transports.
+ */
+
+#include "../optionarg.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <fastdds/dds/log/Log.hpp>
+
+#include <rtps/flowcontrol/FlowControllerImpl.hpp>
+#include <rtps/flowcontrol/FlowControllerShards.hpp>
+
+using namespace eprosima::fastdds::rtps;
+using eprosima::fastrtps::rtps::CacheChange_t;
+using eprosima::fastrtps::rtps::DeliveryRetCode;
+using eprosima::fastrtps::rtps::RTPSWriter;
+
+enum  optionIndex
+{
+    UNKNOWN_OPT,
+    HELP,
+    WRITERS,
+    SAMPLES,
+    SEND_TIME,
+    THREADS
+};
+
+const option::Descriptor usage[] = {
+    { UNKNOWN_OPT,     0, "",  "",                Arg::None,
+      "Usage: FlowControllerShardsTest\n\nGeneral options:" },
+    { HELP,            0, "h", "help",            Arg::None,
+      "  -h           --help                Produce help message." },
+    { WRITERS,         0, "w", "writers",         Arg::Numeric,
+      "  -w <num>,    --writers=<num>       Number of writers (Default: 32)." },
+    { SAMPLES,         0, "s", "samples",         Arg::Numeric,
+      "  -s <num>,    --samples=<num>       Samples sent by each writer (Default: 50)." },
+    { SEND_TIME,       0, "t", "send-time",       Arg::Numeric,
+      "  -t <num>,    --send-time=<num>     Microseconds spent on each delivery (Default: 50)." },
+    { THREADS,         0, "n", "threads",         Arg::Numeric,
+      "  -n <num>,    --threads=<num>       Sender threads compared against a single one (Default: 4)." },
+    { 0, 0, 0, 0, 0, 0 }
+};
+
+/**
+ * Sends num_samples samples from each of num_writers writers through a flow controller with sender_threads threads,
+ * and waits for all of them to be delivered.
+ * @return Time taken to deliver all the samples.
+ */
+static std::chrono::nanoseconds send_samples(
+        uint32_t sender_threads,
+        uint32_t num_writers,
+        uint32_t num_samples,
+        std::chrono::microseconds send_time)
+{
+    std::vector<std::unique_ptr<FlowController>> shards;
+    for (uint32_t i = 0; i < sender_threads; ++i)
+    {
+        shards.emplace_back(new FlowControllerImpl<FlowControllerAsyncPublishMode,
+                FlowControllerFifoSchedule>(nullptr, nullptr));
+    }
+    FlowControllerShards flow_controller(std::move(shards));
+    flow_controller.init();
+
+    const size_t total_samples = static_cast<size_t>(num_writers) * num_samples;
+    std::atomic<size_t> delivered{0};
+    std::mutex mutex;
+    std::condition_variable cv;
+
+    std::vector<std::unique_ptr<RTPSWriter>> writers;
+    std::vector<std::unique_ptr<CacheChange_t[]>> changes;
+    for (uint32_t i = 0; i < num_writers; ++i)
+    {
+        writers.emplace_back(new RTPSWriter());
+        RTPSWriter& writer = *writers.back();
+        writer.deliver_sample = [&, send_time](
+            CacheChange_t*)
+                {
+                    std::this_thread::sleep_for(send_time);
+                    if (total_samples == ++delivered)
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        cv.notify_one();
+                    }
+                    return DeliveryRetCode::DELIVERED;
+                };
+        flow_controller.register_writer(&writer);
+
+        changes.emplace_back(new CacheChange_t[num_samples]);
+        for (uint32_t j = 0; j < num_samples; ++j)
+        {
+            CacheChange_t& change = changes.back()[j];
+            change.writerGUID = writer.getGuid();
+            change.writer_info.previous = nullptr;
+            change.writer_info.next = nullptr;
+            change.sequenceNumber.low = j + 1;
+            change.serializedPayload.length = 1000;
+        }
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t j = 0; j < num_samples; ++j)
+    {
+        for (uint32_t i = 0; i < num_writers; ++i)
+        {
+            writers[i]->getMutex().lock();
+            flow_controller.add_new_sample(writers[i].get(), &changes[i][j],
+                    std::chrono::steady_clock::now() + std::chrono::hours(24));
+            writers[i]->getMutex().unlock();
+        }
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&]()
+                {
+                    return total_samples == delivered;
+                });
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    for (std::unique_ptr<RTPSWriter>& writer : writers)
+    {
+        flow_controller.unregister_writer(writer.get());
+    }
+
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    int columns = 80;
+    uint32_t num_writers = 32;
+    uint32_t num_samples = 50;
+    uint32_t send_time_us = 50;
+    uint32_t sender_threads = 4;
+
+    argc -= (argc > 0); argv += (argc > 0); // skip program name argv[0] if present
+    option::Stats stats(usage, argc, argv);
+    std::vector<option::Option> options(stats.options_max);
+    std::vector<option::Option> buffer(stats.buffer_max);
+    option::Parser parse(usage, argc, argv, &options[0], &buffer[0]);
+
+    if (parse.error())
+    {
+        return 1;
+    }
+
+    if (options[HELP])
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 0;
+    }
+
+    for (int i = 0; i < parse.optionsCount(); ++i)
+    {
+        option::Option& opt = buffer[i];
+        switch (opt.index())
+        {
+            case WRITERS:
+                num_writers = strtol(opt.arg, nullptr, 10);
+                break;
+            case SAMPLES:
+                num_samples = strtol(opt.arg, nullptr, 10);
+                break;
+            case SEND_TIME:
+                send_time_us = strtol(opt.arg, nullptr, 10);
+                break;
+            case THREADS:
+                sender_threads = strtol(opt.arg, nullptr, 10);
+                break;
+            default:
+                break;
+        }
+    }
+
+    if (0 == num_writers || 0 == num_samples || 0 == sender_threads)
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 1;
+    }
+
+    std::cout << "Writers: " << num_writers << ", samples: " << num_samples << ", send time: " << send_time_us <<
+        " us" << std::endl;
+
+    std::chrono::nanoseconds elapsed[2];
+    uint32_t threads[2] = {1u, sender_threads};
+    for (size_t i = 0; i < 2; ++i)
+    {
+        elapsed[i] = send_samples(threads[i], num_writers, num_samples, std::chrono::microseconds(send_time_us));
+        double seconds = std::chrono::duration<double>(elapsed[i]).count();
+        std::cout << threads[i] << " sender threads: " << (num_writers * num_samples) / seconds <<
+            " samples per second" << std::endl;
+    }
+
+    int result = 0;
+    if (1u < sender_threads && elapsed[1] >= elapsed[0])
+    {
+        std::cout << "The sender threads do not increase the aggregate throughput" << std::endl;
+        result = 1;
+    }
+
+    eprosima::fastdds::dds::Log::Reset();
+    return result;
+}
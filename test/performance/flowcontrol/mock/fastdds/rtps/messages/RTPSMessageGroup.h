@@ -0,0 +1,83 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RTPSMessageGroup.h
+ *
+ */
+
+#ifndef _FASTDDS_RTPS_RTPSMESSAGEGROUP_H_
+#define _FASTDDS_RTPS_RTPSMESSAGEGROUP_H_
+
+#include <cstdint>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+class RTPSParticipantImpl;
+class Endpoint;
+class RTPSMessageSenderInterface;
+
+class RTPSMessageGroup
+{
+public:
+
+    RTPSMessageGroup(
+            RTPSParticipantImpl*)
+    {
+    }
+
+    RTPSMessageGroup(
+            RTPSParticipantImpl*,
+            Endpoint*,
+            const RTPSMessageSenderInterface*)
+    {
+    }
+
+    void flush_and_reset()
+    {
+    }
+
+    uint32_t get_current_bytes_processed()
+    {
+        return 0;
+    }
+
+    void reset_current_bytes_processed()
+    {
+    }
+
+    void sender(
+            Endpoint*,
+            const RTPSMessageSenderInterface*) const
+    {
+    }
+
+    void set_sent_bytes_limitation(
+            uint32_t) const
+    {
+    }
+
+    void flush_referenced_payloads() const
+    {
+    }
+
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // _FASTDDS_RTPS_RTPSMESSAGEGROUP_H_
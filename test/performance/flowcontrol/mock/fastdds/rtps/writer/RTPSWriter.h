@@ -0,0 +1,120 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RTPSWriter.h
+ */
+
+#ifndef _FASTDDS_RTPS_RTPSWRITER_H_
+#define _FASTDDS_RTPS_RTPSWRITER_H_
+
+#include <fastrtps/rtps/attributes/WriterAttributes.h>
+#include <fastrtps/rtps/Endpoint.h>
+#include <fastrtps/rtps/common/CacheChange.h>
+#include <fastdds/rtps/messages/RTPSMessageGroup.h>
+#include <fastdds/rtps/writer/DeliveryRetCode.hpp>
+#include <fastdds/rtps/writer/LocatorSelectorSender.hpp>
+
+#include <chrono>
+#include <functional>
+#include <vector>
+
+namespace eprosima {
+
+namespace fastdds {
+namespace rtps {
+
+class LocatorTrafficShaper;
+
+} // namespace rtps
+} // namespace fastdds
+
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Writer delivering its samples through a functor, so the flow controllers can be measured without the transports.
+ */
+class RTPSWriter : public Endpoint
+{
+public:
+
+    RTPSWriter()
+    {
+        static uint8_t entity_id = 0;
+        // Generate a guid.
+        m_guid.entityId.value[3] = ++entity_id;
+    }
+
+    virtual ~RTPSWriter() = default;
+
+    DeliveryRetCode deliver_sample_nts(
+            CacheChange_t* change,
+            RTPSMessageGroup&,
+            LocatorSelectorSender&,
+            const std::chrono::time_point<std::chrono::steady_clock>&)
+    {
+        return deliver_sample(change);
+    }
+
+    bool send_nts(
+            CDRMessage_t*,
+            const LocatorSelectorSender&,
+            std::chrono::steady_clock::time_point&)
+    {
+        return true;
+    }
+
+    bool send_nts(
+            const std::vector<NetworkBuffer>&,
+            uint32_t,
+            const LocatorSelectorSender&,
+            std::chrono::steady_clock::time_point&)
+    {
+        return true;
+    }
+
+    LocatorSelectorSender& get_general_locator_selector()
+    {
+        return general_locator_selector_;
+    }
+
+    LocatorSelectorSender& get_async_locator_selector()
+    {
+        return async_locator_selector_;
+    }
+
+    void traffic_shaper(
+            fastdds::rtps::LocatorTrafficShaper* traffic_shaper)
+    {
+        traffic_shaper_ = traffic_shaper;
+    }
+
+    //! Called by the flow controllers for each sample to send.
+    std::function<DeliveryRetCode(CacheChange_t*)> deliver_sample;
+
+    WriterAttributes m_att;
+
+    LocatorSelectorSender general_locator_selector_ = LocatorSelectorSender(*this, ResourceLimitedContainerConfig());
+
+    LocatorSelectorSender async_locator_selector_ = LocatorSelectorSender(*this, ResourceLimitedContainerConfig());
+
+    fastdds::rtps::LocatorTrafficShaper* traffic_shaper_ = nullptr;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // _FASTDDS_RTPS_RTPSWRITER_H_
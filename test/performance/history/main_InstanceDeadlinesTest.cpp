@@ -0,0 +1,326 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_InstanceDeadlinesTest.cpp
+ *
+ * Measures the deadline updates of the publisher and subscriber histories of a keyed topic with many instances.
+ * Each update sets the next deadline of an instance and gets the earliest deadline of the history, as done every time
+ * a sample is written or received with the deadline QoS enabled.
+ */
+
+#include "../optionarg.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <mutex>
+#include <vector>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/dds/topic/TopicDataType.hpp>
+#include <fastdds/rtps/RTPSDomain.h>
+#include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
+#include <fastdds/rtps/attributes/ReaderAttributes.h>
+#include <fastdds/rtps/attributes/WriterAttributes.h>
+#include <fastdds/rtps/participant/RTPSParticipant.h>
+#include <fastdds/rtps/reader/RTPSReader.h>
+#include <fastdds/rtps/writer/RTPSWriter.h>
+#include <fastrtps/publisher/PublisherHistory.h>
+#include <fastrtps/subscriber/SubscriberHistory.h>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+enum  optionIndex
+{
+    UNKNOWN_OPT,
+    HELP,
+    INSTANCES,
+    UPDATES,
+    DOMAIN_ID
+};
+
+const option::Descriptor usage[] = {
+    { UNKNOWN_OPT,     0, "",  "",                Arg::None,
+      "Usage: InstanceDeadlinesTest\n\nGeneral options:" },
+    { HELP,            0, "h", "help",            Arg::None,
+      "  -h           --help                Produce help message." },
+    { INSTANCES,       0, "n", "instances",       Arg::Numeric,
+      "  -n <num>,    --instances=<num>     Number of instances (Default: 10000)." },
+    { UPDATES,         0, "u", "updates",         Arg::Numeric,
+      "  -u <num>,    --updates=<num>       Deadline updates on each history (Default: 100000)." },
+    { DOMAIN_ID,       0, "d", "domain",          Arg::Numeric,
+      "  -d <num>,    --domain=<num>        Domain of the participant (Default: 0)." },
+    { 0, 0, 0, 0, 0, 0 }
+};
+
+//! Type whose samples are never deserialized, as the received changes carry their instance handle.
+class InstanceType : public eprosima::fastdds::dds::TopicDataType
+{
+public:
+
+    InstanceType()
+    {
+        setName("InstanceType");
+        m_typeSize = 4;
+    }
+
+    bool serialize(
+            void*,
+            SerializedPayload_t*) override
+    {
+        return false;
+    }
+
+    bool deserialize(
+            SerializedPayload_t*,
+            void*) override
+    {
+        return false;
+    }
+
+    std::function<uint32_t()> getSerializedSizeProvider(
+            void*) override
+    {
+        return []()
+               {
+                   return 4u;
+               };
+    }
+
+    void* createData() override
+    {
+        return nullptr;
+    }
+
+    void deleteData(
+            void*) override
+    {
+    }
+
+    bool getKey(
+            void*,
+            InstanceHandle_t*,
+            bool) override
+    {
+        return false;
+    }
+
+};
+
+static InstanceHandle_t instance_handle(
+        uint32_t index)
+{
+    InstanceHandle_t handle;
+    handle.value[0] = 1;
+    handle.value[1] = static_cast<octet>(index >> 24);
+    handle.value[2] = static_cast<octet>(index >> 16);
+    handle.value[3] = static_cast<octet>(index >> 8);
+    handle.value[4] = static_cast<octet>(index);
+    return handle;
+}
+
+/**
+ * Sets the next deadline of the instances in turn, getting the earliest deadline after each one.
+ * @return Number of failed operations.
+ */
+template<typename History>
+static uint32_t update_deadlines(
+        History& history,
+        uint32_t num_instances,
+        uint32_t num_updates,
+        std::chrono::nanoseconds& elapsed)
+{
+    uint32_t failed = 0;
+    auto now = std::chrono::steady_clock::now();
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < num_updates; ++i)
+    {
+        InstanceHandle_t handle;
+        std::chrono::steady_clock::time_point next_deadline;
+        failed += history.set_next_deadline(instance_handle(i % num_instances),
+                        now + std::chrono::microseconds(i + num_instances)) ? 0 : 1;
+        failed += history.get_next_deadline(handle, next_deadline) ? 0 : 1;
+    }
+    elapsed = std::chrono::steady_clock::now() - start;
+    return failed;
+}
+
+static int test_publisher_history(
+        RTPSParticipant* participant,
+        const TopicAttributes& topic_att,
+        uint32_t num_instances,
+        uint32_t num_updates)
+{
+    PublisherHistory history(topic_att, 4, PREALLOCATED_MEMORY_MODE);
+    WriterAttributes writer_attr;
+    writer_attr.endpoint.topicKind = WITH_KEY;
+    RTPSWriter* writer = RTPSDomain::createRTPSWriter(participant, writer_attr, &history);
+    if (nullptr == writer)
+    {
+        std::cout << "Error creating the writer" << std::endl;
+        return 1;
+    }
+
+    uint32_t failed = 0;
+    {
+        std::unique_lock<RecursiveTimedMutex> lock(writer->getMutex());
+        for (uint32_t i = 0; i < num_instances; ++i)
+        {
+            failed += history.register_instance(instance_handle(i), lock, std::chrono::steady_clock::now()) ? 0 : 1;
+        }
+    }
+
+    std::chrono::nanoseconds elapsed;
+    failed += update_deadlines(history, num_instances, num_updates, elapsed);
+    std::cout << "PublisherHistory: " << elapsed.count() / num_updates << " ns per deadline update" << std::endl;
+
+    RTPSDomain::removeRTPSWriter(writer);
+    if (0 != failed)
+    {
+        std::cout << failed << " operations failed on the PublisherHistory" << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+static int test_subscriber_history(
+        RTPSParticipant* participant,
+        const TopicAttributes& topic_att,
+        uint32_t num_instances,
+        uint32_t num_updates)
+{
+    InstanceType type;
+    SubscriberHistory history(topic_att, &type, ReaderQos(), 4, PREALLOCATED_MEMORY_MODE);
+    ReaderAttributes reader_attr;
+    reader_attr.endpoint.topicKind = WITH_KEY;
+    RTPSReader* reader = RTPSDomain::createRTPSReader(participant, reader_attr, &history);
+    if (nullptr == reader)
+    {
+        std::cout << "Error creating the reader" << std::endl;
+        return 1;
+    }
+
+    uint32_t failed = 0;
+    GUID_t writer_guid(GuidPrefix_t::unknown(), 1U);
+    for (uint32_t i = 0; i < num_instances; ++i)
+    {
+        CacheChange_t* ch = nullptr;
+        if (!reader->reserveCache(&ch, 4))
+        {
+            ++failed;
+            break;
+        }
+
+        ch->writerGUID = writer_guid;
+        ch->sequenceNumber = SequenceNumber_t(0, i + 1);
+        ch->instanceHandle = instance_handle(i);
+        if (!history.received_change(ch, 0))
+        {
+            reader->releaseCache(ch);
+            ++failed;
+        }
+    }
+
+    std::chrono::nanoseconds elapsed;
+    failed += update_deadlines(history, num_instances, num_updates, elapsed);
+    std::cout << "SubscriberHistory: " << elapsed.count() / num_updates << " ns per deadline update" << std::endl;
+
+    RTPSDomain::removeRTPSReader(reader);
+    if (0 != failed)
+    {
+        std::cout << failed << " operations failed on the SubscriberHistory" << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    int columns = 80;
+    uint32_t num_instances = 10000;
+    uint32_t num_updates = 100000;
+    uint32_t domain = 0;
+
+    argc -= (argc > 0); argv += (argc > 0); // skip program name argv[0] if present
+    option::Stats stats(usage, argc, argv);
+    std::vector<option::Option> options(stats.options_max);
+    std::vector<option::Option> buffer(stats.buffer_max);
+    option::Parser parse(usage, argc, argv, &options[0], &buffer[0]);
+
+    if (parse.error())
+    {
+        return 1;
+    }
+
+    if (options[HELP])
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 0;
+    }
+
+    for (int i = 0; i < parse.optionsCount(); ++i)
+    {
+        option::Option& opt = buffer[i];
+        switch (opt.index())
+        {
+            case INSTANCES:
+                num_instances = strtol(opt.arg, nullptr, 10);
+                break;
+            case UPDATES:
+                num_updates = strtol(opt.arg, nullptr, 10);
+                break;
+            case DOMAIN_ID:
+                domain = strtol(opt.arg, nullptr, 10);
+                break;
+            default:
+                break;
+        }
+    }
+
+    if (0 == num_instances || 0 == num_updates)
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 1;
+    }
+
+    RTPSParticipantAttributes participant_attr;
+    RTPSParticipant* participant = RTPSDomain::createParticipant(domain, participant_attr);
+    if (nullptr == participant)
+    {
+        std::cout << "Error creating the participant" << std::endl;
+        return 1;
+    }
+
+    TopicAttributes topic_att;
+    topic_att.topicKind = WITH_KEY;
+    topic_att.topicDataType = "InstanceType";
+    topic_att.historyQos.kind = KEEP_LAST_HISTORY_QOS;
+    topic_att.historyQos.depth = 1;
+    topic_att.resourceLimitsQos.max_instances = static_cast<int32_t>(num_instances);
+    topic_att.resourceLimitsQos.max_samples = static_cast<int32_t>(num_instances);
+    topic_att.resourceLimitsQos.allocated_samples = static_cast<int32_t>(num_instances);
+
+    std::cout << "Instances: " << num_instances << ", deadline updates: " << num_updates << std::endl;
+
+    int result = test_publisher_history(participant, topic_att, num_instances, num_updates);
+    result |= test_subscriber_history(participant, topic_att, num_instances, num_updates);
+
+    RTPSDomain::removeRTPSParticipant(participant);
+    eprosima::fastdds::dds::Log::Reset();
+    return result;
+}
@@ -0,0 +1,211 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_ReaderHistoryTest.cpp
+ *
+ * Measures add, find and remove operations on a ReaderHistory of a given depth.
+ * Changes from two writers are added with some out of order source timestamps, and found and removed in random order.
+ */
+
+#include "../optionarg.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/RTPSDomain.h>
+#include <fastdds/rtps/attributes/HistoryAttributes.h>
+#include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
+#include <fastdds/rtps/attributes/ReaderAttributes.h>
+#include <fastdds/rtps/history/ReaderHistory.h>
+#include <fastdds/rtps/participant/RTPSParticipant.h>
+#include <fastdds/rtps/reader/RTPSReader.h>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+enum  optionIndex
+{
+    UNKNOWN_OPT,
+    HELP,
+    DEPTH,
+    DOMAIN_ID
+};
+
+const option::Descriptor usage[] = {
+    { UNKNOWN_OPT,     0, "",  "",                Arg::None,
+      "Usage: ReaderHistoryTest\n\nGeneral options:" },
+    { HELP,            0, "h", "help",            Arg::None,
+      "  -h           --help                Produce help message." },
+    { DEPTH,           0, "n", "depth",           Arg::Numeric,
+      "  -n <num>,    --depth=<num>         Number of changes on the history (Default: 10000)." },
+    { DOMAIN_ID,       0, "d", "domain",          Arg::Numeric,
+      "  -d <num>,    --domain=<num>        Domain of the participant (Default: 0)." },
+    { 0, 0, 0, 0, 0, 0 }
+};
+
+int main(
+        int argc,
+        char** argv)
+{
+    int columns = 80;
+    uint32_t depth = 10000;
+    uint32_t domain = 0;
+
+    argc -= (argc > 0); argv += (argc > 0); // skip program name argv[0] if present
+    option::Stats stats(usage, argc, argv);
+    std::vector<option::Option> options(stats.options_max);
+    std::vector<option::Option> buffer(stats.buffer_max);
+    option::Parser parse(usage, argc, argv, &options[0], &buffer[0]);
+
+    if (parse.error())
+    {
+        return 1;
+    }
+
+    if (options[HELP])
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 0;
+    }
+
+    for (int i = 0; i < parse.optionsCount(); ++i)
+    {
+        option::Option& opt = buffer[i];
+        switch (opt.index())
+        {
+            case DEPTH:
+                depth = strtol(opt.arg, nullptr, 10);
+                break;
+            case DOMAIN_ID:
+                domain = strtol(opt.arg, nullptr, 10);
+                break;
+            default:
+                break;
+        }
+    }
+
+    if (0 == depth)
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 1;
+    }
+
+    RTPSParticipantAttributes participant_attr;
+    RTPSParticipant* participant = RTPSDomain::createParticipant(domain, participant_attr);
+    if (nullptr == participant)
+    {
+        std::cout << "Error creating the participant" << std::endl;
+        return 1;
+    }
+
+    HistoryAttributes history_attr;
+    history_attr.memoryPolicy = PREALLOCATED_MEMORY_MODE;
+    history_attr.payloadMaxSize = 4;
+    history_attr.initialReservedCaches = static_cast<int32_t>(depth);
+    history_attr.maximumReservedCaches = 0;
+    ReaderHistory history(history_attr);
+
+    ReaderAttributes reader_attr;
+    RTPSReader* reader = RTPSDomain::createRTPSReader(participant, reader_attr, &history);
+    if (nullptr == reader)
+    {
+        std::cout << "Error creating the reader" << std::endl;
+        RTPSDomain::removeRTPSParticipant(participant);
+        return 1;
+    }
+
+    const GUID_t writer_guids[] =
+    {
+        GUID_t(GuidPrefix_t::unknown(), 1U),
+        GUID_t(GuidPrefix_t::unknown(), 2U)
+    };
+
+    int result = 0;
+    std::vector<CacheChange_t*> changes(depth, nullptr);
+    for (uint32_t i = 0; i < depth && 0 == result; ++i)
+    {
+        if (!reader->reserveCache(&changes[i], 4))
+        {
+            std::cout << "Error reserving change " << i << std::endl;
+            result = 1;
+            break;
+        }
+
+        CacheChange_t* ch = changes[i];
+        ch->writerGUID = writer_guids[i % 2];
+        ch->sequenceNumber = SequenceNumber_t(0, i / 2 + 1);
+        // One every eight changes arrives late
+        uint32_t ts = (i % 8 == 7) ? i - 5 : i;
+        ch->sourceTimestamp = eprosima::fastrtps::rtps::Time_t(static_cast<int32_t>(ts / 1000), ts % 1000);
+    }
+
+    if (0 == result)
+    {
+        std::vector<CacheChange_t*> order(changes);
+        std::shuffle(order.begin(), order.end(), std::mt19937(depth));
+
+        uint32_t failed = 0;
+
+        auto t0 = std::chrono::steady_clock::now();
+        for (CacheChange_t* ch : changes)
+        {
+            failed += history.add_change(ch) ? 0 : 1;
+        }
+        auto t1 = std::chrono::steady_clock::now();
+        for (CacheChange_t* ch : order)
+        {
+            failed += history.find_change(ch) != history.changesEnd() ? 0 : 1;
+        }
+        auto t2 = std::chrono::steady_clock::now();
+        for (CacheChange_t* ch : order)
+        {
+            failed += history.remove_change(ch) ? 0 : 1;
+        }
+        auto t3 = std::chrono::steady_clock::now();
+
+        using ns = std::chrono::nanoseconds;
+        std::cout << "Depth " << depth
+                  << ": add " << std::chrono::duration_cast<ns>(t1 - t0).count() / depth << " ns/op"
+                  << ", find " << std::chrono::duration_cast<ns>(t2 - t1).count() / depth << " ns/op"
+                  << ", remove " << std::chrono::duration_cast<ns>(t3 - t2).count() / depth << " ns/op"
+                  << std::endl;
+
+        if (0 != failed || 0 != history.getHistorySize())
+        {
+            std::cout << failed << " operations failed" << std::endl;
+            result = 1;
+        }
+    }
+    else
+    {
+        for (CacheChange_t* ch : changes)
+        {
+            if (nullptr != ch)
+            {
+                reader->releaseCache(ch);
+            }
+        }
+    }
+
+    RTPSDomain::removeRTPSReader(reader);
+    RTPSDomain::removeRTPSParticipant(participant);
+    eprosima::fastdds::dds::Log::Reset();
+    return result;
+}
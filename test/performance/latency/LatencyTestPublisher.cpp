@@ -292,6 +292,8 @@ bool LatencyTestPublisher::init(
         {
             DataSharingQosPolicy dsp;
             dsp.on("");
+            // Keep the huge pages setting loaded from the XML profile
+            dsp.huge_pages(dw_qos_.data_sharing().huge_pages());
             dw_qos_.data_sharing(dsp);
             dr_qos_.data_sharing(dsp);
         }
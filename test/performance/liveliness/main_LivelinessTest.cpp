@@ -0,0 +1,160 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_LivelinessTest.cpp
+ *
+ * Measures the time needed to assert the liveliness of a manual by topic writer, through its LivelinessData and
+ * through its GUID, when the LivelinessManager holds a given number of writers.
+ */
+
+#include "../optionarg.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <vector>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastrtps/rtps/common/Time_t.h>
+#include <fastrtps/rtps/resources/ResourceEvent.h>
+#include <fastrtps/rtps/writer/LivelinessManager.h>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+enum  optionIndex
+{
+    UNKNOWN_OPT,
+    HELP,
+    WRITERS,
+    ASSERTIONS
+};
+
+const option::Descriptor usage[] = {
+    { UNKNOWN_OPT,     0, "",  "",                Arg::None,
+      "Usage: LivelinessTest\n\nGeneral options:" },
+    { HELP,            0, "h", "help",            Arg::None,
+      "  -h           --help                Produce help message." },
+    { WRITERS,         0, "w", "writers",         Arg::Numeric,
+      "  -w <num>,    --writers=<num>       Number of writers on the manager (Default: 500)." },
+    { ASSERTIONS,      0, "a", "assertions",      Arg::Numeric,
+      "  -a <num>,    --assertions=<num>    Number of assertions measured (Default: 100000)." },
+    { 0, 0, 0, 0, 0, 0 }
+};
+
+int main(
+        int argc,
+        char** argv)
+{
+    int columns = 80;
+    uint32_t num_writers = 500;
+    uint32_t num_assertions = 100000;
+
+    argc -= (argc > 0); argv += (argc > 0); // skip program name argv[0] if present
+    option::Stats stats(usage, argc, argv);
+    std::vector<option::Option> options(stats.options_max);
+    std::vector<option::Option> buffer(stats.buffer_max);
+    option::Parser parse(usage, argc, argv, &options[0], &buffer[0]);
+
+    if (parse.error())
+    {
+        return 1;
+    }
+
+    if (options[HELP])
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 0;
+    }
+
+    for (int i = 0; i < parse.optionsCount(); ++i)
+    {
+        option::Option& opt = buffer[i];
+        switch (opt.index())
+        {
+            case WRITERS:
+                num_writers = strtol(opt.arg, nullptr, 10);
+                break;
+            case ASSERTIONS:
+                num_assertions = strtol(opt.arg, nullptr, 10);
+                break;
+            default:
+                break;
+        }
+    }
+
+    if (0 == num_writers || 0 == num_assertions)
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 1;
+    }
+
+    int result = 0;
+    {
+        ResourceEvent service;
+        service.init_thread();
+
+        LivelinessManager liveliness_manager(nullptr, service);
+
+        GuidPrefix_t prefix;
+        prefix.value[0] = 1;
+        for (uint32_t i = 1; i <= num_writers; ++i)
+        {
+            liveliness_manager.add_writer(GUID_t(prefix, i), MANUAL_BY_TOPIC_LIVELINESS_QOS, Duration_t(10));
+        }
+        liveliness_manager.assert_liveliness(MANUAL_BY_TOPIC_LIVELINESS_QOS);
+
+        // The last writer added is the worst case of a linear search
+        GUID_t last_writer(prefix, num_writers);
+        LivelinessData* writer = liveliness_manager.get_writer(
+            last_writer, MANUAL_BY_TOPIC_LIVELINESS_QOS, Duration_t(10));
+        if (nullptr == writer)
+        {
+            std::cout << "Writer not found on the manager" << std::endl;
+            return 1;
+        }
+
+        uint32_t failed = 0;
+
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < num_assertions; ++i)
+        {
+            failed += liveliness_manager.assert_liveliness(writer) ? 0 : 1;
+        }
+        double by_handle_ns =
+                std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+        start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < num_assertions; ++i)
+        {
+            failed += liveliness_manager.assert_liveliness(last_writer, MANUAL_BY_TOPIC_LIVELINESS_QOS,
+                    Duration_t(10)) ? 0 : 1;
+        }
+        double by_guid_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+        std::cout << num_writers << " writers: " << by_handle_ns / num_assertions
+                  << " ns per assertion by liveliness data, " << by_guid_ns / num_assertions
+                  << " ns per assertion by GUID" << std::endl;
+
+        if (0 != failed)
+        {
+            std::cout << failed << " assertions failed" << std::endl;
+            result = 1;
+        }
+    }
+
+    eprosima::fastdds::dds::Log::Reset();
+    return result;
+}
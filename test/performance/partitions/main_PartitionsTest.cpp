@@ -0,0 +1,209 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_PartitionsTest.cpp
+ *
+ * Measures the cost of matching the partitions of a writer and a reader, comparing every pair of names with
+ * StringMatching and with a PartitionMatcher.
+ */
+
+#include "../optionarg.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <fastdds/dds/core/policy/QosPolicies.hpp>
+#include <fastrtps/utils/StringMatching.h>
+
+#include <rtps/builtin/discovery/endpoint/PartitionMatcher.hpp>
+
+using eprosima::fastdds::dds::PartitionQosPolicy;
+using eprosima::fastrtps::rtps::PartitionMatcher;
+using eprosima::fastrtps::rtps::StringMatching;
+
+enum  optionIndex
+{
+    UNKNOWN_OPT,
+    HELP,
+    PARTITIONS,
+    WILDCARDS,
+    ITERATIONS
+};
+
+const option::Descriptor usage[] = {
+    { UNKNOWN_OPT,     0, "",  "",                Arg::None,
+      "Usage: PartitionsTest\n\nGeneral options:" },
+    { HELP,            0, "h", "help",            Arg::None,
+      "  -h           --help                Produce help message." },
+    { PARTITIONS,      0, "p", "partitions",      Arg::Numeric,
+      "  -p <num>,    --partitions=<num>    Number of partitions of the writer and the reader (Default: 20)." },
+    { WILDCARDS,       0, "w", "wildcards",       Arg::Numeric,
+      "  -w <num>,    --wildcards=<num>     Percentage of partitions with wildcards (Default: 50)." },
+    { ITERATIONS,      0, "i", "iterations",      Arg::Numeric,
+      "  -i <num>,    --iterations=<num>    Number of times the partitions are matched (Default: 20000)." },
+    { 0, 0, 0, 0, 0, 0 }
+};
+
+//! Fills a set of partitions whose names do not match any name of the set filled with another prefix.
+static void fill_partitions(
+        PartitionQosPolicy& partitions,
+        const std::string& prefix,
+        uint32_t count,
+        uint32_t wildcards)
+{
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        std::string name = prefix + "/area" + std::to_string(i);
+        if (i * 100 < count * wildcards)
+        {
+            name += "/*";
+        }
+        partitions.push_back(name.c_str());
+    }
+}
+
+static bool match_pairs(
+        const PartitionQosPolicy& writer_partitions,
+        const PartitionQosPolicy& reader_partitions)
+{
+    for (auto wit = writer_partitions.begin(); wit != writer_partitions.end(); ++wit)
+    {
+        for (auto rit = reader_partitions.begin(); rit != reader_partitions.end(); ++rit)
+        {
+            if (StringMatching::matchString(wit->name(), rit->name()))
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    int columns = 80;
+    uint32_t count = 20;
+    uint32_t wildcards = 50;
+    uint32_t iterations = 20000;
+
+    argc -= (argc > 0); argv += (argc > 0); // skip program name argv[0] if present
+    option::Stats stats(usage, argc, argv);
+    std::vector<option::Option> options(stats.options_max);
+    std::vector<option::Option> buffer(stats.buffer_max);
+    option::Parser parse(usage, argc, argv, &options[0], &buffer[0]);
+
+    if (parse.error())
+    {
+        return 1;
+    }
+
+    if (options[HELP])
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 0;
+    }
+
+    for (int i = 0; i < parse.optionsCount(); ++i)
+    {
+        option::Option& opt = buffer[i];
+        switch (opt.index())
+        {
+            case PARTITIONS:
+                count = strtol(opt.arg, nullptr, 10);
+                break;
+            case WILDCARDS:
+                wildcards = strtol(opt.arg, nullptr, 10);
+                break;
+            case ITERATIONS:
+                iterations = strtol(opt.arg, nullptr, 10);
+                break;
+            default:
+                break;
+        }
+    }
+
+    if (0 == count || 100 < wildcards || 0 == iterations)
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 1;
+    }
+
+    std::cout << "Partitions: " << count << ", with wildcards: " << wildcards << "%, iterations: " << iterations
+              << std::endl;
+
+    // Sets without any matching pair, so every pair of names has to be checked.
+    PartitionQosPolicy writer_partitions;
+    PartitionQosPolicy reader_partitions;
+    fill_partitions(writer_partitions, "writer", count, wildcards);
+    fill_partitions(reader_partitions, "reader", count, wildcards);
+
+    uint32_t matched = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; ++i)
+    {
+        matched += match_pairs(writer_partitions, reader_partitions) ? 1 : 0;
+    }
+    double pairs_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; ++i)
+    {
+        PartitionMatcher writer_matcher(writer_partitions);
+        PartitionMatcher reader_matcher(reader_partitions);
+        matched += writer_matcher.matches(reader_matcher) ? 1 : 0;
+    }
+    double compile_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    PartitionMatcher writer_matcher(writer_partitions);
+    PartitionMatcher reader_matcher(reader_partitions);
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; ++i)
+    {
+        matched += writer_matcher.matches(reader_matcher) ? 1 : 0;
+    }
+    double compiled_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    // Lookup of a memoized result, as done by EDP once both sets have been matched.
+    std::unordered_map<std::string, bool> results;
+    results[PartitionMatcher::key(writer_partitions) + '\n' + PartitionMatcher::key(reader_partitions)] = false;
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; ++i)
+    {
+        matched += results.at(PartitionMatcher::key(writer_partitions) + '\n' +
+                        PartitionMatcher::key(reader_partitions)) ? 1 : 0;
+    }
+    double cached_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << std::fixed << std::setprecision(1)
+              << "Every pair of names:     " << pairs_ns / iterations << " ns per match" << std::endl
+              << "Compiling and matching:  " << compile_ns / iterations << " ns per match" << std::endl
+              << "Compiled matchers:       " << compiled_ns / iterations << " ns per match" << std::endl
+              << "Memoized result:         " << cached_ns / iterations << " ns per match" << std::endl;
+
+    if (0 != matched)
+    {
+        std::cout << "Unexpected match of the partitions" << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,203 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_ProfilesTest.cpp
+ *
+ * Measures the startup cost of an application whose XML file contains many profiles but only uses a few of them:
+ * the time to load the XML file and the time until the first participant is created with one of its profiles.
+ * Set FASTDDS_DEFERRED_XML_PROFILES=1 to measure the deferred parsing of profiles.
+ */
+
+#include "../optionarg.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/log/Log.hpp>
+#include <fastrtps/xmlparser/XMLProfileManager.h>
+
+using namespace eprosima::fastdds::dds;
+using namespace eprosima::fastrtps::xmlparser;
+
+enum  optionIndex
+{
+    UNKNOWN_OPT,
+    HELP,
+    PROFILES_OPT,
+    ITERATIONS,
+    XML_FILE
+};
+
+const option::Descriptor usage[] = {
+    { UNKNOWN_OPT,     0, "",  "",                Arg::None,
+      "Usage: ProfilesTest\n\nGeneral options:" },
+    { HELP,            0, "h", "help",            Arg::None,
+      "  -h           --help                Produce help message." },
+    { PROFILES_OPT,    0, "p", "profiles",        Arg::Numeric,
+      "  -p <num>,    --profiles=<num>      Number of profiles of each kind in the XML file (Default: 1000)." },
+    { ITERATIONS,      0, "i", "iterations",      Arg::Numeric,
+      "  -i <num>,    --iterations=<num>    Number of times the startup is measured (Default: 10)." },
+    { XML_FILE,        0, "",  "xml",             Arg::String,
+      "               --xml=<file>          Generated XML file (Default: profiles_test.xml)." },
+    { 0, 0, 0, 0, 0, 0 }
+};
+
+static void write_profiles(
+        const std::string& filename,
+        uint32_t profiles)
+{
+    std::ofstream xml(filename);
+    xml << "<?xml version=\"1.0\" encoding=\"UTF-8\" ?>\n";
+    xml << "<dds>\n<profiles xmlns=\"http://www.eprosima.com/XMLSchemas/fastRTPS_Profiles\">\n";
+    xml << "<transport_descriptors><transport_descriptor><transport_id>udp_transport</transport_id>"
+        << "<type>UDPv4</type></transport_descriptor></transport_descriptors>\n";
+
+    for (uint32_t i = 0; i < profiles; ++i)
+    {
+        xml << "<participant profile_name=\"participant_" << i << "\"><rtps>"
+            << "<name>participant_" << i << "</name>"
+            << "<builtin><discovery_config><leaseDuration><sec>" << (10 + i % 10) << "</sec></leaseDuration>"
+            << "</discovery_config></builtin>"
+            << "<userTransports><transport_id>udp_transport</transport_id></userTransports>"
+            << "<useBuiltinTransports>false</useBuiltinTransports>"
+            << "</rtps></participant>\n";
+        xml << "<data_writer profile_name=\"data_writer_" << i << "\">"
+            << "<topic><name>topic_" << i << "</name><dataType>type_" << i << "</dataType>"
+            << "<historyQos><kind>KEEP_LAST</kind><depth>" << (1 + i % 20) << "</depth></historyQos></topic>"
+            << "<qos><reliability><kind>RELIABLE</kind></reliability>"
+            << "<durability><kind>TRANSIENT_LOCAL</kind></durability></qos>"
+            << "</data_writer>\n";
+        xml << "<data_reader profile_name=\"data_reader_" << i << "\">"
+            << "<topic><name>topic_" << i << "</name><dataType>type_" << i << "</dataType></topic>"
+            << "<qos><reliability><kind>BEST_EFFORT</kind></reliability></qos>"
+            << "</data_reader>\n";
+    }
+
+    xml << "</profiles>\n</dds>\n";
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    int columns = 80;
+    uint32_t profiles = 1000;
+    uint32_t iterations = 10;
+    std::string xml_file = "profiles_test.xml";
+
+    argc -= (argc > 0); argv += (argc > 0); // skip program name argv[0] if present
+    option::Stats stats(usage, argc, argv);
+    std::vector<option::Option> options(stats.options_max);
+    std::vector<option::Option> buffer(stats.buffer_max);
+    option::Parser parse(usage, argc, argv, &options[0], &buffer[0]);
+
+    if (parse.error())
+    {
+        return 1;
+    }
+
+    if (options[HELP])
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 0;
+    }
+
+    for (int i = 0; i < parse.optionsCount(); ++i)
+    {
+        option::Option& opt = buffer[i];
+        switch (opt.index())
+        {
+            case PROFILES_OPT:
+                profiles = strtol(opt.arg, nullptr, 10);
+                break;
+            case ITERATIONS:
+                iterations = strtol(opt.arg, nullptr, 10);
+                break;
+            case XML_FILE:
+                xml_file = opt.arg;
+                break;
+            default:
+                break;
+        }
+    }
+
+    if (0 == profiles || 0 == iterations)
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 1;
+    }
+
+    const char* deferred = std::getenv("FASTDDS_DEFERRED_XML_PROFILES");
+    std::cout << "Profiles of each kind: " << profiles << ", iterations: " << iterations << ", deferred parsing: "
+              << ((deferred != nullptr && deferred[0] == '1') ? "yes" : "no") << std::endl;
+
+    write_profiles(xml_file, profiles);
+
+    DomainParticipantFactory* factory = DomainParticipantFactory::get_instance();
+    std::string participant_profile = "participant_" + std::to_string(profiles / 2);
+
+    double load_total = 0;
+    double startup_total = 0;
+    int result = 0;
+    for (uint32_t i = 0; i < iterations && 0 == result; ++i)
+    {
+        XMLProfileManager::DeleteInstance();
+
+        auto start = std::chrono::steady_clock::now();
+        if (XMLP_ret::XML_OK != XMLProfileManager::loadXMLFile(xml_file))
+        {
+            std::cout << "Error loading " << xml_file << std::endl;
+            result = 1;
+            break;
+        }
+        auto loaded = std::chrono::steady_clock::now();
+
+        DomainParticipant* participant = factory->create_participant_with_profile(0, participant_profile);
+        auto created = std::chrono::steady_clock::now();
+        if (nullptr == participant)
+        {
+            std::cout << "Error creating participant with profile " << participant_profile << std::endl;
+            result = 1;
+            break;
+        }
+        factory->delete_participant(participant);
+
+        double load_ms = std::chrono::duration<double, std::milli>(loaded - start).count();
+        double startup_ms = std::chrono::duration<double, std::milli>(created - start).count();
+        load_total += load_ms;
+        startup_total += startup_ms;
+        std::cout << std::fixed << std::setprecision(3) << "Iteration " << i << ": load " << load_ms
+                  << " ms, first participant " << startup_ms << " ms" << std::endl;
+    }
+
+    if (0 == result)
+    {
+        std::cout << std::fixed << std::setprecision(3) << "Mean: load " << load_total / iterations
+                  << " ms, first participant " << startup_total / iterations << " ms" << std::endl;
+    }
+
+    XMLProfileManager::DeleteInstance();
+    std::remove(xml_file.c_str());
+    eprosima::fastdds::dds::Log::Reset();
+    return result;
+}
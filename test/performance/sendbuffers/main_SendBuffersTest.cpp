@@ -0,0 +1,159 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_SendBuffersTest.cpp
+ *
+ * Measures the cost of getting and returning send buffers from many threads of the same participant, with enough
+ * buffers for all of them or with threads waiting for buffers.
+ */
+
+#include "../optionarg.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <rtps/messages/SendBuffersManager.hpp>
+#include <rtps/participant/RTPSParticipantImpl.h>
+
+using namespace eprosima::fastrtps::rtps;
+
+enum  optionIndex
+{
+    UNKNOWN_OPT,
+    HELP,
+    THREADS,
+    BUFFERS,
+    ITERATIONS
+};
+
+const option::Descriptor usage[] = {
+    { UNKNOWN_OPT,     0, "",  "",                Arg::None,
+      "Usage: SendBuffersTest\n\nGeneral options:" },
+    { HELP,            0, "h", "help",            Arg::None,
+      "  -h           --help                Produce help message." },
+    { THREADS,         0, "t", "threads",         Arg::Numeric,
+      "  -t <num>,    --threads=<num>       Number of threads getting buffers (Default: 16)." },
+    { BUFFERS,         0, "b", "buffers",         Arg::Numeric,
+      "  -b <num>,    --buffers=<num>       Number of buffers of the pool (Default: 16)." },
+    { ITERATIONS,      0, "i", "iterations",      Arg::Numeric,
+      "  -i <num>,    --iterations=<num>    Buffers taken by each thread (Default: 20000)." },
+    { 0, 0, 0, 0, 0, 0 }
+};
+
+int main(
+        int argc,
+        char** argv)
+{
+    int columns = 80;
+    uint32_t num_threads = 16;
+    uint32_t num_buffers = 16;
+    uint32_t iterations = 20000;
+
+    argc -= (argc > 0); argv += (argc > 0); // skip program name argv[0] if present
+    option::Stats stats(usage, argc, argv);
+    std::vector<option::Option> options(stats.options_max);
+    std::vector<option::Option> buffer(stats.buffer_max);
+    option::Parser parse(usage, argc, argv, &options[0], &buffer[0]);
+
+    if (parse.error())
+    {
+        return 1;
+    }
+
+    if (options[HELP])
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 0;
+    }
+
+    for (int i = 0; i < parse.optionsCount(); ++i)
+    {
+        option::Option& opt = buffer[i];
+        switch (opt.index())
+        {
+            case THREADS:
+                num_threads = strtol(opt.arg, nullptr, 10);
+                break;
+            case BUFFERS:
+                num_buffers = strtol(opt.arg, nullptr, 10);
+                break;
+            case ITERATIONS:
+                iterations = strtol(opt.arg, nullptr, 10);
+                break;
+            default:
+                break;
+        }
+    }
+
+    if (0 == num_threads || 0 == num_buffers || 0 == iterations)
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 1;
+    }
+
+    std::cout << "Threads: " << num_threads << ", buffers: " << num_buffers << ", iterations: " << iterations
+              << std::endl;
+
+    RTPSParticipantImpl participant;
+    participant.guid_.guidPrefix.value[0] = 1;
+
+    SendBuffersManager manager(num_buffers, false);
+    manager.init(&participant);
+
+    std::atomic<bool> shared{false};
+    std::vector<std::thread> threads;
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t n = 0; n < num_threads; ++n)
+    {
+        threads.emplace_back([&, n]()
+                {
+                    octet mark = static_cast<octet>(n + 1);
+                    for (uint32_t i = 0; i < iterations; ++i)
+                    {
+                        std::unique_ptr<RTPSMessageGroup_t> buffer = manager.get_buffer(&participant);
+                        octet* data = buffer->rtpsmsg_submessage_.buffer;
+                        data[0] = mark;
+                        std::this_thread::yield();
+                        if (mark != data[0])
+                        {
+                            shared = true;
+                        }
+                        manager.return_buffer(std::move(buffer));
+                    }
+                });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    double elapsed_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    SendBuffersStatistics statistics = manager.get_statistics();
+    std::cout << elapsed_ns / (static_cast<double>(num_threads) * iterations) << " ns per buffer, "
+              << statistics.wait_count << " waits" << std::endl;
+
+    if (shared)
+    {
+        std::cout << "A buffer was given to two threads at once" << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,61 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RTPSParticipantImpl.h
+ */
+
+#ifndef _RTPS_PARTICIPANT_RTPSPARTICIPANTIMPL_H_
+#define _RTPS_PARTICIPANT_RTPSPARTICIPANTIMPL_H_
+
+#include <fastrtps/config.h>
+#include <fastdds/rtps/common/Guid.h>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Participant with only the information SendBuffersManager needs to create its buffers.
+ */
+class RTPSParticipantImpl
+{
+public:
+
+    const GUID_t& getGuid() const
+    {
+        return guid_;
+    }
+
+    uint32_t getMaxMessageSize() const
+    {
+        return 65500u;
+    }
+
+#if HAVE_SECURITY
+    bool is_secure() const
+    {
+        return false;
+    }
+
+#endif // if HAVE_SECURITY
+
+    GUID_t guid_;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // _RTPS_PARTICIPANT_RTPSPARTICIPANTIMPL_H_
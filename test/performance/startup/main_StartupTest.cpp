@@ -0,0 +1,183 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_StartupTest.cpp
+ *
+ * Measures the time taken by create_participant and the resident memory of the process after each creation.
+ */
+
+#include "../optionarg.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/domain/qos/DomainParticipantQos.hpp>
+#include <fastdds/dds/log/Log.hpp>
+
+using namespace eprosima::fastdds::dds;
+
+enum  optionIndex
+{
+    UNKNOWN_OPT,
+    HELP,
+    PARTICIPANTS,
+    LAZY,
+    TYPELOOKUP
+};
+
+const option::Descriptor usage[] = {
+    { UNKNOWN_OPT,     0, "",  "",                Arg::None,
+      "Usage: StartupTest\n\nGeneral options:" },
+    { HELP,            0, "h", "help",            Arg::None,
+      "  -h           --help                Produce help message." },
+    { PARTICIPANTS,    0, "p", "participants",    Arg::Numeric,
+      "  -p <num>,    --participants=<num>  Number of participants created one after the other (Default: 10)." },
+    { LAZY,            0, "l", "lazy",            Arg::None,
+      "  -l           --lazy                Create the participants with the fastdds.lazy_startup property." },
+    { TYPELOOKUP,      0, "t", "typelookup",      Arg::None,
+      "  -t           --typelookup          Enable the TypeLookup service client and server." },
+    { 0, 0, 0, 0, 0, 0 }
+};
+
+//! Resident set size of the process in KiB, or 0 when it cannot be read.
+static uint64_t resident_kib()
+{
+    uint64_t rss = 0;
+#ifdef __linux__
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line))
+    {
+        if (0 == line.compare(0, 6, "VmRSS:"))
+        {
+            rss = std::stoull(line.substr(6));
+            break;
+        }
+    }
+#endif // ifdef __linux__
+    return rss;
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    int columns = 80;
+    uint32_t participants = 10;
+    bool lazy = false;
+    bool typelookup = false;
+
+    argc -= (argc > 0); argv += (argc > 0); // skip program name argv[0] if present
+    option::Stats stats(usage, argc, argv);
+    std::vector<option::Option> options(stats.options_max);
+    std::vector<option::Option> buffer(stats.buffer_max);
+    option::Parser parse(usage, argc, argv, &options[0], &buffer[0]);
+
+    if (parse.error())
+    {
+        return 1;
+    }
+
+    if (options[HELP])
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 0;
+    }
+
+    for (int i = 0; i < parse.optionsCount(); ++i)
+    {
+        option::Option& opt = buffer[i];
+        switch (opt.index())
+        {
+            case PARTICIPANTS:
+                participants = strtol(opt.arg, nullptr, 10);
+                break;
+            case LAZY:
+                lazy = true;
+                break;
+            case TYPELOOKUP:
+                typelookup = true;
+                break;
+            default:
+                break;
+        }
+    }
+
+    if (0 == participants)
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 1;
+    }
+
+    DomainParticipantFactory* factory = DomainParticipantFactory::get_instance();
+    DomainParticipantQos qos = factory->get_default_participant_qos();
+    if (lazy)
+    {
+        qos.properties().properties().emplace_back("fastdds.lazy_startup", "true");
+    }
+    if (typelookup)
+    {
+        qos.wire_protocol().builtin.typelookup_config.use_client = true;
+        qos.wire_protocol().builtin.typelookup_config.use_server = true;
+    }
+
+    std::cout << "Participants: " << participants << ", lazy startup: " << (lazy ? "yes" : "no")
+              << ", TypeLookup service: " << (typelookup ? "yes" : "no") << std::endl;
+
+    uint64_t initial_rss = resident_kib();
+    std::vector<DomainParticipant*> created;
+    double total_ms = 0;
+    int result = 0;
+    for (uint32_t i = 0; i < participants; ++i)
+    {
+        auto start = std::chrono::steady_clock::now();
+        DomainParticipant* participant = factory->create_participant(0, qos);
+        auto end = std::chrono::steady_clock::now();
+        if (nullptr == participant)
+        {
+            std::cout << "Error creating participant " << i << std::endl;
+            result = 1;
+            break;
+        }
+        created.push_back(participant);
+
+        double elapsed_ms = std::chrono::duration<double, std::milli>(end - start).count();
+        total_ms += elapsed_ms;
+        std::cout << std::fixed << std::setprecision(3) << "Participant " << i << ": " << elapsed_ms
+                  << " ms, RSS " << resident_kib() << " KiB" << std::endl;
+    }
+
+    if (0 == result)
+    {
+        std::cout << std::fixed << std::setprecision(3) << "Mean create_participant: " << total_ms / participants
+                  << " ms, RSS increase per participant: "
+                  << static_cast<double>(resident_kib() - initial_rss) / participants << " KiB" << std::endl;
+    }
+
+    for (DomainParticipant* participant : created)
+    {
+        factory->delete_participant(participant);
+    }
+
+    Log::Reset();
+    return result;
+}
@@ -0,0 +1,314 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_TCPCoalescingTest.cpp
+ *
+ * Measures the throughput of small messages sent by several threads through the same TCP connection, with and
+ * without write coalescing.
+ */
+
+#include "../optionarg.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/transport/TCPv4TransportDescriptor.h>
+#include <fastdds/rtps/transport/TransportInterface.h>
+#include <fastdds/rtps/transport/TransportReceiverInterface.h>
+#include <fastrtps/utils/IPLocator.h>
+#include <fastrtps/utils/Semaphore.h>
+
+using namespace eprosima::fastrtps::rtps;
+using eprosima::fastdds::rtps::Locators;
+using eprosima::fastdds::rtps::SendResourceList;
+using eprosima::fastdds::rtps::TCPv4TransportDescriptor;
+using eprosima::fastdds::rtps::TransportInterface;
+using eprosima::fastdds::rtps::TransportReceiverInterface;
+using eprosima::fastrtps::Semaphore;
+
+enum  optionIndex
+{
+    UNKNOWN_OPT,
+    HELP,
+    THREADS,
+    MESSAGES,
+    SIZE,
+    LATENCY,
+    PORT,
+    COALESCING
+};
+
+const option::Descriptor usage[] = {
+    { UNKNOWN_OPT,     0, "",  "",                Arg::None,
+      "Usage: TCPCoalescingTest\n\nGeneral options:" },
+    { HELP,            0, "h", "help",            Arg::None,
+      "  -h           --help                Produce help message." },
+    { THREADS,         0, "t", "threads",         Arg::Numeric,
+      "  -t <num>,    --threads=<num>       Number of sending threads (Default: 4)." },
+    { MESSAGES,        0, "n", "messages",        Arg::Numeric,
+      "  -n <num>,    --messages=<num>      Number of messages sent by each thread (Default: 5000)." },
+    { SIZE,            0, "s", "size",            Arg::Numeric,
+      "  -s <num>,    --size=<num>          Size of the messages in bytes, at least 8 (Default: 16)." },
+    { LATENCY,         0, "l", "latency",         Arg::Numeric,
+      "  -l <num>,    --latency=<num>       Maximum coalescing latency in microseconds (Default: 50)." },
+    { PORT,            0, "p", "port",            Arg::Numeric,
+      "  -p <num>,    --port=<num>          Listening port (Default: 7600)." },
+    { COALESCING,      0, "c", "coalescing",      Arg::None,
+      "  -c           --coalescing          Enable write coalescing and TCP_CORK." },
+    { 0, 0, 0, 0, 0, 0 }
+};
+
+//! Counts the received messages, checking each thread's ones arrive in order.
+class CountingReceiver : public TransportReceiverInterface
+{
+public:
+
+    CountingReceiver(
+            uint32_t num_threads,
+            uint32_t num_messages)
+        : next_seq_(num_threads, 0)
+        , expected_(num_threads * num_messages)
+    {
+    }
+
+    void OnDataReceived(
+            const octet* data,
+            const uint32_t size,
+            const Locator_t& /*local_locator*/,
+            const Locator_t& /*remote_locator*/) override
+    {
+        if (size < 2 * sizeof(uint32_t))
+        {
+            ++errors;
+            return;
+        }
+
+        uint32_t thread_id;
+        uint32_t seq;
+        memcpy(&thread_id, data, sizeof(thread_id));
+        memcpy(&seq, data + sizeof(thread_id), sizeof(seq));
+
+        if (warm_up_id == thread_id)
+        {
+            warm_up.post();
+            return;
+        }
+
+        if (thread_id >= next_seq_.size() || seq != next_seq_[thread_id]++)
+        {
+            ++errors;
+        }
+
+        if (expected_ == ++received_)
+        {
+            done.post();
+        }
+    }
+
+    static constexpr uint32_t warm_up_id = 0xFFFFFFFF;
+
+    std::atomic<uint32_t> errors{0};
+
+    Semaphore warm_up;
+
+    Semaphore done;
+
+private:
+
+    std::vector<uint32_t> next_seq_;
+
+    uint32_t expected_;
+
+    std::atomic<uint32_t> received_{0};
+};
+
+constexpr uint32_t CountingReceiver::warm_up_id;
+
+int main(
+        int argc,
+        char** argv)
+{
+    int columns = 80;
+    uint32_t num_threads = 4;
+    uint32_t num_messages = 5000;
+    uint32_t message_size = 16;
+    uint32_t latency_us = 50;
+    uint16_t port = 7600;
+    bool coalescing = false;
+
+    argc -= (argc > 0); argv += (argc > 0); // skip program name argv[0] if present
+    option::Stats stats(usage, argc, argv);
+    std::vector<option::Option> options(stats.options_max);
+    std::vector<option::Option> buffer(stats.buffer_max);
+    option::Parser parse(usage, argc, argv, &options[0], &buffer[0]);
+
+    if (parse.error())
+    {
+        return 1;
+    }
+
+    if (options[HELP])
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 0;
+    }
+
+    for (int i = 0; i < parse.optionsCount(); ++i)
+    {
+        option::Option& opt = buffer[i];
+        switch (opt.index())
+        {
+            case THREADS:
+                num_threads = strtol(opt.arg, nullptr, 10);
+                break;
+            case MESSAGES:
+                num_messages = strtol(opt.arg, nullptr, 10);
+                break;
+            case SIZE:
+                message_size = strtol(opt.arg, nullptr, 10);
+                break;
+            case LATENCY:
+                latency_us = strtol(opt.arg, nullptr, 10);
+                break;
+            case PORT:
+                port = static_cast<uint16_t>(strtol(opt.arg, nullptr, 10));
+                break;
+            case COALESCING:
+                coalescing = true;
+                break;
+            default:
+                break;
+        }
+    }
+
+    if (0 == num_threads || 0 == num_messages || message_size < 2 * sizeof(uint32_t) || 0 == port)
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 1;
+    }
+
+    std::cout << (coalescing ? "Coalesced" : "Non-coalesced") << " writes. Threads: " << num_threads
+              << ", messages per thread: " << num_messages << ", size: " << message_size << std::endl;
+
+    TCPv4TransportDescriptor recv_descriptor;
+    recv_descriptor.add_listener_port(port);
+    std::unique_ptr<TransportInterface> receive_transport(recv_descriptor.create_transport());
+
+    TCPv4TransportDescriptor send_descriptor;
+    send_descriptor.enable_write_coalescing = coalescing;
+    send_descriptor.write_coalescing_max_latency_us = latency_us;
+    send_descriptor.enable_tcp_cork = coalescing;
+    std::unique_ptr<TransportInterface> send_transport(send_descriptor.create_transport());
+
+    if (!receive_transport->init() || !send_transport->init())
+    {
+        std::cout << "Error initializing the transports" << std::endl;
+        return 1;
+    }
+
+    Locator_t locator;
+    locator.kind = LOCATOR_KIND_TCPv4;
+    locator.port = port;
+    IPLocator::setIPv4(locator, 127, 0, 0, 1);
+    IPLocator::setLogicalPort(locator, 7410);
+
+    CountingReceiver receiver(num_threads, num_messages);
+    SendResourceList send_resource_list;
+    if (!receive_transport->OpenInputChannel(locator, &receiver, 0xFFFF) ||
+            !send_transport->OpenOutputChannel(send_resource_list, locator) || send_resource_list.empty())
+    {
+        std::cout << "Error opening the channels" << std::endl;
+        return 1;
+    }
+
+    LocatorList_t locator_list;
+    locator_list.push_back(locator);
+
+    auto send_message = [&](const octet* message)
+            {
+                Locators locators_begin(locator_list.begin());
+                Locators locators_end(locator_list.end());
+                return send_resource_list.at(0)->send(message, message_size, &locators_begin, &locators_end,
+                               std::chrono::steady_clock::now() + std::chrono::milliseconds(100));
+            };
+
+    // Wait for the connection to be established
+    std::vector<octet> warm_up_message(message_size, 0);
+    memcpy(warm_up_message.data(), &CountingReceiver::warm_up_id, sizeof(uint32_t));
+    while (!send_message(warm_up_message.data()))
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    receiver.warm_up.wait();
+
+    std::atomic<uint32_t> send_errors{0};
+    auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < num_threads; ++i)
+    {
+        threads.emplace_back([&, i]()
+                {
+                    std::vector<octet> message(message_size, 0);
+                    memcpy(message.data(), &i, sizeof(i));
+                    for (uint32_t seq = 0; seq < num_messages; ++seq)
+                    {
+                        memcpy(message.data() + sizeof(i), &seq, sizeof(seq));
+                        if (!send_message(message.data()))
+                        {
+                            ++send_errors;
+                        }
+                    }
+                });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    int result = 0;
+    if (0 != send_errors)
+    {
+        std::cout << send_errors << " messages could not be sent" << std::endl;
+        result = 1;
+    }
+    else
+    {
+        receiver.done.wait();
+    }
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    std::cout << "Throughput of " << message_size << " bytes messages: "
+              << (num_threads * num_messages * 1000000.0 / elapsed.count()) << " msg/s" << std::endl;
+
+    if (0 != receiver.errors)
+    {
+        std::cout << receiver.errors << " messages received out of order" << std::endl;
+        result = 1;
+    }
+
+    send_resource_list.clear();
+    receive_transport->CloseInputChannel(locator);
+    eprosima::fastdds::dds::Log::Reset();
+    return result;
+}
@@ -0,0 +1,249 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_TCPConnectionsTest.cpp
+ *
+ * Measures the time needed to establish and use many loopback TCP connections between two transports, and the
+ * number of threads created for them, with reception on a thread per connection or on the reactor threads.
+ */
+
+#include "../optionarg.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/transport/TCPv4TransportDescriptor.h>
+#include <fastdds/rtps/transport/TransportInterface.h>
+#include <fastdds/rtps/transport/TransportReceiverInterface.h>
+#include <fastrtps/utils/IPLocator.h>
+#include <fastrtps/utils/Semaphore.h>
+
+using namespace eprosima::fastrtps::rtps;
+using eprosima::fastdds::rtps::Locators;
+using eprosima::fastdds::rtps::SendResourceList;
+using eprosima::fastdds::rtps::TCPv4TransportDescriptor;
+using eprosima::fastdds::rtps::TransportInterface;
+using eprosima::fastdds::rtps::TransportReceiverInterface;
+using eprosima::fastrtps::Semaphore;
+
+enum  optionIndex
+{
+    UNKNOWN_OPT,
+    HELP,
+    CONNECTIONS,
+    REACTOR,
+    PORT
+};
+
+const option::Descriptor usage[] = {
+    { UNKNOWN_OPT,     0, "",  "",                Arg::None,
+      "Usage: TCPConnectionsTest\n\nGeneral options:" },
+    { HELP,            0, "h", "help",            Arg::None,
+      "  -h           --help                Produce help message." },
+    { CONNECTIONS,     0, "n", "connections",     Arg::Numeric,
+      "  -n <num>,    --connections=<num>   Number of connections (Default: 64)." },
+    { REACTOR,         0, "r", "reactor",         Arg::Numeric,
+      "  -r <num>,    --reactor=<num>       Reactor threads of each transport, 0 for a thread per connection "
+      "(Default: 2)." },
+    { PORT,            0, "p", "port",            Arg::Numeric,
+      "  -p <num>,    --port=<num>          First listening port (Default: 7610)." },
+    { 0, 0, 0, 0, 0, 0 }
+};
+
+//! Counts the received messages.
+class CountingReceiver : public TransportReceiverInterface
+{
+public:
+
+    void OnDataReceived(
+            const octet* /*data*/,
+            const uint32_t /*size*/,
+            const Locator_t& /*local_locator*/,
+            const Locator_t& /*remote_locator*/) override
+    {
+        received.post();
+    }
+
+    Semaphore received;
+};
+
+//! Number of threads of the process, or 0 if it cannot be known.
+static uint32_t get_process_threads()
+{
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line))
+    {
+        if (0 == line.compare(0, 8, "Threads:"))
+        {
+            return static_cast<uint32_t>(std::stoul(line.substr(8)));
+        }
+    }
+    return 0;
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    int columns = 80;
+    uint32_t num_connections = 64;
+    uint32_t reactor_threads = 2;
+    uint32_t port = 7610;
+
+    argc -= (argc > 0); argv += (argc > 0); // skip program name argv[0] if present
+    option::Stats stats(usage, argc, argv);
+    std::vector<option::Option> options(stats.options_max);
+    std::vector<option::Option> buffer(stats.buffer_max);
+    option::Parser parse(usage, argc, argv, &options[0], &buffer[0]);
+
+    if (parse.error())
+    {
+        return 1;
+    }
+
+    if (options[HELP])
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 0;
+    }
+
+    for (int i = 0; i < parse.optionsCount(); ++i)
+    {
+        option::Option& opt = buffer[i];
+        switch (opt.index())
+        {
+            case CONNECTIONS:
+                num_connections = strtol(opt.arg, nullptr, 10);
+                break;
+            case REACTOR:
+                reactor_threads = strtol(opt.arg, nullptr, 10);
+                break;
+            case PORT:
+                port = strtol(opt.arg, nullptr, 10);
+                break;
+            default:
+                break;
+        }
+    }
+
+    if (0 == num_connections || 0 == port || 0xFFFF < port + num_connections)
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 1;
+    }
+
+    std::cout << "Connections: " << num_connections << ", reactor threads: " << reactor_threads << std::endl;
+
+    TCPv4TransportDescriptor recv_descriptor;
+    recv_descriptor.reactor_threads = reactor_threads;
+    for (uint32_t i = 0; i < num_connections; ++i)
+    {
+        recv_descriptor.add_listener_port(static_cast<uint16_t>(port + i));
+    }
+    std::unique_ptr<TransportInterface> receive_transport(recv_descriptor.create_transport());
+
+    TCPv4TransportDescriptor send_descriptor;
+    send_descriptor.reactor_threads = reactor_threads;
+    std::unique_ptr<TransportInterface> send_transport(send_descriptor.create_transport());
+
+    if (!receive_transport->init() || !send_transport->init())
+    {
+        std::cout << "Error initializing the transports" << std::endl;
+        return 1;
+    }
+
+    Locator_t input_locator;
+    input_locator.kind = LOCATOR_KIND_TCPv4;
+    input_locator.port = port;
+    IPLocator::setIPv4(input_locator, 127, 0, 0, 1);
+    IPLocator::setLogicalPort(input_locator, 7410);
+
+    CountingReceiver receiver;
+    if (!receive_transport->OpenInputChannel(input_locator, &receiver, 0xFFFF))
+    {
+        std::cout << "Error opening the input channel" << std::endl;
+        return 1;
+    }
+
+    uint32_t threads_before = get_process_threads();
+    auto start = std::chrono::steady_clock::now();
+
+    SendResourceList send_resource_list;
+    std::vector<Locator_t> output_locators;
+    for (uint32_t i = 0; i < num_connections; ++i)
+    {
+        Locator_t output_locator = input_locator;
+        IPLocator::setPhysicalPort(output_locator, static_cast<uint16_t>(port + i));
+        output_locators.push_back(output_locator);
+        if (!send_transport->OpenOutputChannel(send_resource_list, output_locator))
+        {
+            std::cout << "Error opening output channel " << i << std::endl;
+            return 1;
+        }
+    }
+
+    // Send a message through each connection, waiting for their negotiation to finish
+    octet message[5] = { 'H', 'e', 'l', 'l', 'o' };
+    for (uint32_t i = 0; i < num_connections; ++i)
+    {
+        LocatorList_t destination;
+        destination.push_back(output_locators[i]);
+        Locators destination_begin(destination.begin());
+        Locators destination_end(destination.end());
+
+        while (!send_resource_list.at(i)->send(message, sizeof(message), &destination_begin, &destination_end,
+                std::chrono::steady_clock::now() + std::chrono::microseconds(100)))
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+
+    for (uint32_t i = 0; i < num_connections; ++i)
+    {
+        receiver.received.wait();
+    }
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    uint32_t threads_after = get_process_threads();
+
+    std::cout << num_connections << " TCP connections established and used in " << elapsed.count() << " ms"
+              << std::endl;
+    int result = 0;
+    if (0 != threads_before && 0 != threads_after)
+    {
+        std::cout << "Threads created for the connections: " << threads_after - threads_before << std::endl;
+
+        // On reactor mode, reception threads are not created per connection
+        if (0 < reactor_threads && threads_after - threads_before >= num_connections / 2)
+        {
+            std::cout << "The number of threads grows with the number of connections" << std::endl;
+            result = 1;
+        }
+    }
+
+    send_resource_list.clear();
+    receive_transport->CloseInputChannel(input_locator);
+    eprosima::fastdds::dds::Log::Reset();
+    return result;
+}
@@ -0,0 +1,273 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_TypeLookupTest.cpp
+ *
+ * Measures the time needed by late joining participants to retrieve the TypeObjects of many dynamic types through
+ * the TypeLookup service.
+ * The first participant serves the types. A new client participant is created on each round, requests all the types
+ * in batches, and the time until all of them are received is printed.
+ */
+
+#include "../optionarg.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/domain/DomainParticipantListener.hpp>
+#include <fastdds/dds/domain/qos/DomainParticipantQos.hpp>
+#include <fastdds/dds/log/Log.hpp>
+#include <fastrtps/types/DynamicType.h>
+#include <fastrtps/types/DynamicTypeBuilder.h>
+#include <fastrtps/types/DynamicTypeBuilderFactory.h>
+#include <fastrtps/types/DynamicTypeBuilderPtr.h>
+#include <fastrtps/types/TypeObjectFactory.h>
+
+using namespace eprosima::fastdds::dds;
+using namespace eprosima::fastrtps::types;
+
+enum  optionIndex
+{
+    UNKNOWN_OPT,
+    HELP,
+    TYPES,
+    BATCH,
+    ROUNDS,
+    DOMAIN_ID
+};
+
+const option::Descriptor usage[] = {
+    { UNKNOWN_OPT,     0, "",  "",                Arg::None,
+      "Usage: TypeLookupTest\n\nGeneral options:" },
+    { HELP,            0, "h", "help",            Arg::None,
+      "  -h           --help                Produce help message." },
+    { TYPES,           0, "n", "types",           Arg::Numeric,
+      "  -n <num>,    --types=<num>         Number of served types (Default: 600)." },
+    { BATCH,           0, "b", "batch",           Arg::Numeric,
+      "  -b <num>,    --batch=<num>         Number of types requested at once (Default: 20)." },
+    { ROUNDS,          0, "r", "rounds",          Arg::Numeric,
+      "  -r <num>,    --rounds=<num>        Number of late joining clients (Default: 3)." },
+    { DOMAIN_ID,       0, "d", "domain",          Arg::Numeric,
+      "  -d <num>,    --domain=<num>        Domain of the participants (Default: 0)." },
+    { 0, 0, 0, 0, 0, 0 }
+};
+
+class TypeLookupListener : public DomainParticipantListener
+{
+public:
+
+    void on_participant_discovery(
+            DomainParticipant* /*participant*/,
+            eprosima::fastrtps::rtps::ParticipantDiscoveryInfo&& info) override
+    {
+        if (eprosima::fastrtps::rtps::ParticipantDiscoveryInfo::DISCOVERED_PARTICIPANT == info.status)
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            discovered_ = true;
+            cv_.notify_one();
+        }
+    }
+
+    void on_type_discovery(
+            DomainParticipant* /*participant*/,
+            const eprosima::fastrtps::rtps::SampleIdentity& /*request_sample_id*/,
+            const eprosima::fastrtps::string_255& /*topic*/,
+            const TypeIdentifier* /*identifier*/,
+            const TypeObject* /*object*/,
+            DynamicType_ptr /*dyn_type*/) override
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        ++received_;
+        cv_.notify_one();
+    }
+
+    bool wait_discovery(
+            const std::chrono::seconds& timeout)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return cv_.wait_for(lock, timeout, [&]()
+                       {
+                           return discovered_;
+                       });
+    }
+
+    bool wait_types(
+            size_t expected,
+            const std::chrono::seconds& timeout)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return cv_.wait_for(lock, timeout, [&]()
+                       {
+                           return received_ >= expected;
+                       });
+    }
+
+private:
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool discovered_ = false;
+    size_t received_ = 0;
+};
+
+int main(
+        int argc,
+        char** argv)
+{
+    int columns = 80;
+    uint32_t num_types = 600;
+    uint32_t batch_size = 20;
+    uint32_t num_rounds = 3;
+    uint32_t domain = 0;
+
+    argc -= (argc > 0); argv += (argc > 0); // skip program name argv[0] if present
+    option::Stats stats(usage, argc, argv);
+    std::vector<option::Option> options(stats.options_max);
+    std::vector<option::Option> buffer(stats.buffer_max);
+    option::Parser parse(usage, argc, argv, &options[0], &buffer[0]);
+
+    if (parse.error())
+    {
+        return 1;
+    }
+
+    if (options[HELP])
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 0;
+    }
+
+    for (int i = 0; i < parse.optionsCount(); ++i)
+    {
+        option::Option& opt = buffer[i];
+        switch (opt.index())
+        {
+            case TYPES:
+                num_types = strtol(opt.arg, nullptr, 10);
+                break;
+            case BATCH:
+                batch_size = strtol(opt.arg, nullptr, 10);
+                break;
+            case ROUNDS:
+                num_rounds = strtol(opt.arg, nullptr, 10);
+                break;
+            case DOMAIN_ID:
+                domain = strtol(opt.arg, nullptr, 10);
+                break;
+            default:
+                break;
+        }
+    }
+
+    if (0 == num_types || 0 == batch_size || 0 == num_rounds)
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 1;
+    }
+
+    std::cout << "Types: " << num_types << ", batch: " << batch_size << ", rounds: " << num_rounds << std::endl;
+
+    // Register the dynamic types served by the first participant.
+    DynamicTypeBuilderFactory* builder_factory = DynamicTypeBuilderFactory::get_instance();
+    TypeObjectFactory* object_factory = TypeObjectFactory::get_instance();
+    TypeIdentifierSeq type_ids;
+    for (uint32_t i = 0; i < num_types; ++i)
+    {
+        DynamicTypeBuilder_ptr builder = builder_factory->create_struct_builder();
+        builder->set_name("TypeLookupTestType" + std::to_string(i));
+        builder->add_member(0, "index", builder_factory->create_uint32_type());
+        builder->add_member(1, "name", builder_factory->create_string_type());
+        DynamicType_ptr dyn_type = builder->build();
+
+        TypeObject type_object;
+        builder_factory->build_type_object(dyn_type, type_object, true);
+        const TypeIdentifier* type_id = object_factory->get_type_identifier(dyn_type->get_name(), true);
+        if (nullptr == type_id)
+        {
+            std::cout << "Error registering type " << i << std::endl;
+            return 1;
+        }
+        type_ids.push_back(*type_id);
+    }
+
+    DomainParticipantFactory* factory = DomainParticipantFactory::get_instance();
+
+    DomainParticipantQos server_qos;
+    server_qos.wire_protocol().builtin.typelookup_config.use_server = true;
+    DomainParticipant* server = factory->create_participant(domain, server_qos);
+    if (nullptr == server)
+    {
+        std::cout << "Error creating the server participant" << std::endl;
+        return 1;
+    }
+
+    DomainParticipantQos client_qos;
+    client_qos.wire_protocol().builtin.typelookup_config.use_client = true;
+
+    int result = 0;
+    for (uint32_t round = 0; round < num_rounds && 0 == result; ++round)
+    {
+        TypeLookupListener listener;
+        DomainParticipant* client = factory->create_participant(domain, client_qos, &listener);
+        if (nullptr == client)
+        {
+            std::cout << "Error creating client participant " << round << std::endl;
+            result = 1;
+            break;
+        }
+
+        if (!listener.wait_discovery(std::chrono::seconds(10)))
+        {
+            std::cout << "Client " << round << " did not discover the server" << std::endl;
+            result = 1;
+        }
+        else
+        {
+            auto start = std::chrono::steady_clock::now();
+
+            for (uint32_t first = 0; first < num_types; first += batch_size)
+            {
+                uint32_t last = std::min(num_types, first + batch_size);
+                TypeIdentifierSeq batch(type_ids.begin() + first, type_ids.begin() + last);
+                client->get_types(batch);
+            }
+
+            if (!listener.wait_types(num_types, std::chrono::seconds(30)))
+            {
+                std::cout << "Client " << round << " did not receive all the types" << std::endl;
+                result = 1;
+            }
+            auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - start);
+
+            std::cout << num_types << " types resolved by client " << round << " in " << elapsed.count() << " ms"
+                      << std::endl;
+        }
+
+        factory->delete_participant(client);
+    }
+
+    factory->delete_participant(server);
+    Log::Reset();
+    return result;
+}
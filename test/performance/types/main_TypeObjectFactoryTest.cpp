@@ -0,0 +1,187 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_TypeObjectFactoryTest.cpp
+ *
+ * Measures the throughput of concurrent lookups on the TypeObjectFactory registry.
+ */
+
+#include "../optionarg.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastrtps/types/DynamicType.h>
+#include <fastrtps/types/DynamicTypeBuilder.h>
+#include <fastrtps/types/DynamicTypeBuilderFactory.h>
+#include <fastrtps/types/DynamicTypeBuilderPtr.h>
+#include <fastrtps/types/TypeObjectFactory.h>
+
+using namespace eprosima::fastrtps::types;
+
+enum  optionIndex
+{
+    UNKNOWN_OPT,
+    HELP,
+    THREADS,
+    TYPES,
+    ITERATIONS
+};
+
+const option::Descriptor usage[] = {
+    { UNKNOWN_OPT,     0, "",  "",                Arg::None,
+      "Usage: TypeObjectFactoryTest\n\nGeneral options:" },
+    { HELP,            0, "h", "help",            Arg::None,
+      "  -h           --help                Produce help message." },
+    { THREADS,         0, "t", "threads",         Arg::Numeric,
+      "  -t <num>,    --threads=<num>       Number of threads looking up types concurrently (Default: 4)." },
+    { TYPES,           0, "n", "types",           Arg::Numeric,
+      "  -n <num>,    --types=<num>         Number of registered types (Default: 2000)." },
+    { ITERATIONS,      0, "i", "iterations",      Arg::Numeric,
+      "  -i <num>,    --iterations=<num>    Times each thread looks up all the types (Default: 20)." },
+    { 0, 0, 0, 0, 0, 0 }
+};
+
+int main(
+        int argc,
+        char** argv)
+{
+    int columns = 80;
+    uint32_t threads = 4;
+    uint32_t types = 2000;
+    uint32_t iterations = 20;
+
+    argc -= (argc > 0); argv += (argc > 0); // skip program name argv[0] if present
+    option::Stats stats(usage, argc, argv);
+    std::vector<option::Option> options(stats.options_max);
+    std::vector<option::Option> buffer(stats.buffer_max);
+    option::Parser parse(usage, argc, argv, &options[0], &buffer[0]);
+
+    if (parse.error())
+    {
+        return 1;
+    }
+
+    if (options[HELP])
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 0;
+    }
+
+    for (int i = 0; i < parse.optionsCount(); ++i)
+    {
+        option::Option& opt = buffer[i];
+        switch (opt.index())
+        {
+            case THREADS:
+                threads = strtol(opt.arg, nullptr, 10);
+                break;
+            case TYPES:
+                types = strtol(opt.arg, nullptr, 10);
+                break;
+            case ITERATIONS:
+                iterations = strtol(opt.arg, nullptr, 10);
+                break;
+            default:
+                break;
+        }
+    }
+
+    if (0 == threads || 0 == types || 0 == iterations)
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 1;
+    }
+
+    std::cout << "Threads: " << threads << ", types: " << types << ", iterations: " << iterations << std::endl;
+
+    // Register the types, keeping copies of their identifiers as a remote participant would receive them.
+    DynamicTypeBuilderFactory* builder_factory = DynamicTypeBuilderFactory::get_instance();
+    TypeObjectFactory* object_factory = TypeObjectFactory::get_instance();
+    std::vector<std::string> names;
+    std::vector<TypeIdentifier> identifiers;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < types; ++i)
+    {
+        DynamicTypeBuilder_ptr builder = builder_factory->create_struct_builder();
+        builder->set_name("TypeObjectFactoryTestType" + std::to_string(i));
+        builder->add_member(0, "index", builder_factory->create_uint32_type());
+        builder->add_member(1, "name", builder_factory->create_string_type());
+        DynamicType_ptr dyn_type = builder->build();
+
+        TypeObject type_object;
+        builder_factory->build_type_object(dyn_type, type_object, true);
+        const TypeIdentifier* identifier = object_factory->get_type_identifier(dyn_type->get_name(), true);
+        if (nullptr == identifier)
+        {
+            std::cout << "Error registering type " << i << std::endl;
+            return 1;
+        }
+        names.push_back(dyn_type->get_name());
+        identifiers.push_back(*identifier);
+    }
+    double register_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    std::cout << std::fixed << std::setprecision(3) << "Registration: " << register_ms << " ms" << std::endl;
+
+    std::atomic<uint32_t> errors(0);
+    std::vector<std::thread> workers;
+    start = std::chrono::steady_clock::now();
+    for (uint32_t t = 0; t < threads; ++t)
+    {
+        workers.emplace_back([&, t]()
+                {
+                    for (uint32_t iteration = 0; iteration < iterations; ++iteration)
+                    {
+                        for (uint32_t i = 0; i < types; ++i)
+                        {
+                            // Each thread walks the types from a different offset.
+                            uint32_t index = (i + t * (types / threads)) % types;
+                            const TypeIdentifier* by_name = object_factory->get_type_identifier(names[index], true);
+                            const TypeObject* by_identifier = object_factory->get_type_object(&identifiers[index]);
+                            if (nullptr == by_name || nullptr == by_identifier ||
+                            names[index] != object_factory->get_type_name(&identifiers[index]))
+                            {
+                                ++errors;
+                            }
+                        }
+                    }
+                });
+    }
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+    double lookup_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    uint64_t lookups = static_cast<uint64_t>(threads) * iterations * types * 3;
+    std::cout << std::fixed << std::setprecision(3) << "Lookups: " << lookups << " in " << lookup_ms << " ms ("
+              << lookups / lookup_ms * 1000 << " lookups/s)" << std::endl;
+
+    eprosima::fastdds::dds::Log::Reset();
+
+    if (0 != errors)
+    {
+        std::cout << "Failed lookups: " << errors << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -813,6 +813,90 @@ TEST(DataWriterTests, LoanNegativeTests)
     ASSERT_TRUE(DomainParticipantFactory::get_instance()->delete_participant(participant) == ReturnCode_t::RETCODE_OK);
 }
 
+TEST(DataWriterTests, SerializedLoanTests)
+{
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(0, PARTICIPANT_QOS_DEFAULT);
+    ASSERT_NE(participant, nullptr);
+
+    PublisherQos pqos = PUBLISHER_QOS_DEFAULT;
+    pqos.entity_factory().autoenable_created_entities = false;
+    Publisher* publisher = participant->create_publisher(pqos);
+    ASSERT_NE(publisher, nullptr);
+
+    // Non-plain type
+    TypeSupport type(new TopicDataTypeMock());
+    type.register_type(participant);
+
+    Topic* topic = participant->create_topic("serialized_loan_topic", type.get_type_name(), TOPIC_QOS_DEFAULT);
+    ASSERT_NE(topic, nullptr);
+
+    DataWriterQos wqos;
+    wqos.history().depth = 1;
+
+    DataWriter* datawriter = publisher->create_datawriter(topic, wqos);
+    ASSERT_NE(datawriter, nullptr);
+
+    fastrtps::rtps::octet* buffer = nullptr;
+    fastrtps::rtps::octet* buffer_2 = nullptr;
+    fastrtps::rtps::octet* buffer_3 = nullptr;
+    uint32_t buffer_size = 0;
+    constexpr uint32_t max_size = 1024u;
+
+    // Check for not enabled
+    EXPECT_EQ(ReturnCode_t::RETCODE_NOT_ENABLED, datawriter->loan_serialized_payload(buffer, buffer_size, max_size));
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, datawriter->enable());
+
+    // Check the buffer can hold the representation header
+    EXPECT_EQ(ReturnCode_t::RETCODE_BAD_PARAMETER, datawriter->loan_serialized_payload(buffer, buffer_size, 2u));
+    EXPECT_EQ(nullptr, buffer);
+
+    // Non-plain types cannot loan samples, but can loan serialized payloads
+    void* sample = nullptr;
+    EXPECT_EQ(ReturnCode_t::RETCODE_ILLEGAL_OPERATION, datawriter->loan_sample(sample));
+
+    // Loan and discard
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, datawriter->loan_serialized_payload(buffer, buffer_size, max_size));
+    ASSERT_NE(nullptr, buffer);
+    EXPECT_LE(max_size, buffer_size);
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, datawriter->discard_serialized_loan(buffer));
+    EXPECT_EQ(nullptr, buffer);
+    EXPECT_EQ(ReturnCode_t::RETCODE_BAD_PARAMETER, datawriter->discard_serialized_loan(buffer));
+
+    // Resource limits:
+    // Depth has been configured to 1, so pool will allow up to depth + 1 loans.
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, datawriter->loan_serialized_payload(buffer, buffer_size, max_size));
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, datawriter->loan_serialized_payload(buffer_2, buffer_size, max_size));
+    EXPECT_EQ(ReturnCode_t::RETCODE_OUT_OF_RESOURCES,
+            datawriter->loan_serialized_payload(buffer_3, buffer_size, max_size));
+    EXPECT_EQ(nullptr, buffer_3);
+
+    // Check preconditions on delete_datawriter
+    EXPECT_EQ(ReturnCode_t::RETCODE_PRECONDITION_NOT_MET, publisher->delete_datawriter(datawriter));
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, datawriter->discard_serialized_loan(buffer_2));
+
+    // Write a serialized buffer
+    buffer[0] = 0;
+    buffer[1] = CDR_LE;
+    buffer[2] = buffer[3] = 0;
+    fastrtps::rtps::octet* wrong_buffer = buffer + 1;
+    EXPECT_EQ(ReturnCode_t::RETCODE_BAD_PARAMETER, datawriter->write_serialized_loan(wrong_buffer, 8u));
+    EXPECT_EQ(ReturnCode_t::RETCODE_BAD_PARAMETER, datawriter->write_serialized_loan(buffer, buffer_size + 1));
+    EXPECT_EQ(ReturnCode_t::RETCODE_BAD_PARAMETER, datawriter->write_serialized_loan(buffer, 2u));
+    EXPECT_NE(nullptr, buffer);
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, datawriter->write_serialized_loan(buffer, 8u));
+    EXPECT_EQ(nullptr, buffer);
+
+    // Written buffers are owned by the writer again
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, datawriter->loan_serialized_payload(buffer, buffer_size, max_size));
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, datawriter->write_serialized_loan(buffer, 8u));
+
+    ASSERT_TRUE(publisher->delete_datawriter(datawriter) == ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(participant->delete_topic(topic) == ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(participant->delete_publisher(publisher) == ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(DomainParticipantFactory::get_instance()->delete_participant(participant) == ReturnCode_t::RETCODE_OK);
+}
+
 class DataWriterUnsupportedTests : public ::testing::Test
 {
 public:
@@ -132,6 +132,41 @@ TEST(CacheChange, FragmentManagement)
     }
 }
 
+/*!
+ * @fn TEST(CacheChange, MissingFragmentsWindow)
+ * @brief This test checks that the missing fragments of a change with lots of fragments are reported
+ * on a window starting at the first missing one.
+ */
+TEST(CacheChange, MissingFragmentsWindow)
+{
+    constexpr uint32_t num_fragments = 10000;
+    constexpr uint16_t fragment_size = 4;
+
+    CacheChange_t uut(num_fragments * fragment_size);
+    uut.serializedPayload.length = num_fragments * fragment_size;
+    uut.setFragmentSize(fragment_size, true);
+
+    SerializedPayload_t payload(fragment_size * 500);
+    payload.length = fragment_size * 500;
+
+    // Receive fragments [1, 500] and even fragments in [502, 1500]
+    uut.add_fragments(payload, 1, 500);
+    for (uint32_t i = 502; i <= 1500; i += 2)
+    {
+        uut.add_fragments(payload, i, 1);
+    }
+
+    FragmentNumberSet_t fns;
+    uut.get_missing_fragments(fns);
+
+    EXPECT_EQ(fns.base(), 501u);
+    EXPECT_EQ(fns.max(), 501u + 254u);
+    for (FragmentNumber_t i = 501; i <= 501 + 255; i++)
+    {
+        EXPECT_EQ(fns.is_set(i), (i % 2) == 1) << "  index: " << i;
+    }
+}
+
 int main(
         int argc,
         char **argv)
@@ -253,6 +253,59 @@ TEST_F(EdpTests, CheckPartitionCompatibility)
     check_expectations(true);
 }
 
+TEST_F(EdpTests, CheckPartitionSetsCompatibility)
+{
+    // Literal names only match the same name
+    wdata->m_qos.m_partition.push_back("sensors/front");
+    wdata->m_qos.m_partition.push_back("sensors/rear");
+    rdata->m_qos.m_partition.push_back("sensors/left");
+    rdata->m_qos.m_partition.push_back("sensors/right");
+    check_expectations(false);
+
+    // A wildcard on the reader matches a literal on the writer
+    rdata->m_qos.m_partition.push_back("sensors/r*");
+    check_expectations(true);
+
+    // A wildcard on the writer matches a literal on the reader
+    wdata->m_qos.m_partition.clear();
+    wdata->m_qos.m_partition.push_back("actuators/*");
+    wdata->m_qos.m_partition.push_back("sensors/?ight");
+    check_expectations(true);
+
+    // Wildcards on both sides
+    rdata->m_qos.m_partition.clear();
+    rdata->m_qos.m_partition.push_back("actuators/arm*");
+    check_expectations(true);
+
+    // Going back to previously checked sets gives the same results
+    wdata->m_qos.m_partition.clear();
+    wdata->m_qos.m_partition.push_back("sensors/front");
+    wdata->m_qos.m_partition.push_back("sensors/rear");
+    rdata->m_qos.m_partition.clear();
+    rdata->m_qos.m_partition.push_back("sensors/left");
+    rdata->m_qos.m_partition.push_back("sensors/right");
+    check_expectations(false);
+}
+
+TEST_F(EdpTests, CheckPartitionCompatibilityManySets)
+{
+    // More distinct sets than compiled matchers are kept, so the cache is emptied several times while matching.
+    for (size_t i = 0; i < 3000; ++i)
+    {
+        std::string name = "area" + std::to_string(i);
+
+        wdata->m_qos.m_partition.clear();
+        wdata->m_qos.m_partition.push_back(name.c_str());
+        rdata->m_qos.m_partition.clear();
+        rdata->m_qos.m_partition.push_back((name + "*").c_str());
+        check_expectations(true);
+
+        rdata->m_qos.m_partition.clear();
+        rdata->m_qos.m_partition.push_back((name + "/other").c_str());
+        check_expectations(false);
+    }
+}
+
 TEST_F(EdpTests, CheckDurabilityCompatibility)
 {
     std::vector<QosTestingCase<DurabilityQosPolicyKind>> testing_cases{
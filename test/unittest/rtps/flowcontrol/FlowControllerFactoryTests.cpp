@@ -1,5 +1,6 @@
 #include <rtps/flowcontrol/FlowControllerFactory.hpp>
 #include <rtps/flowcontrol//FlowControllerImpl.hpp>
+#include <rtps/flowcontrol/FlowControllerShards.hpp>
 
 #include <gtest/gtest.h>
 
@@ -101,6 +102,16 @@ TEST(FlowControllerFactory, register_flow_controllers)
                     FlowControllerPriorityWithReservationSchedule>*>(flow_controller);
     ASSERT_TRUE(nullptr != async_reserv_flow);
 
+    const char* async_edf = "AsyncFlowControllerEarliestDeadline";
+    flow_controller_descr.name = async_edf;
+    flow_controller_descr.scheduler = FlowControllerSchedulerPolicy::EARLIEST_DEADLINE_FIRST;
+    factory.register_flow_controller(flow_controller_descr);
+    flow_controller = factory.retrieve_flow_controller(async_edf, writer_attributes);
+    FlowControllerImpl<FlowControllerAsyncPublishMode,
+            FlowControllerEarliestDeadlineFirstSchedule>* async_edf_flow = dynamic_cast<FlowControllerImpl<FlowControllerAsyncPublishMode,
+                    FlowControllerEarliestDeadlineFirstSchedule>*>(flow_controller);
+    ASSERT_TRUE(nullptr != async_edf_flow);
+
     flow_controller_descr.max_bytes_per_period = 1;
     flow_controller_descr.period_ms = 1;
 
@@ -144,6 +155,55 @@ TEST(FlowControllerFactory, register_flow_controllers)
             FlowControllerPriorityWithReservationSchedule>* async_limited_reserv_flow = dynamic_cast<FlowControllerImpl<FlowControllerLimitedAsyncPublishMode,
                     FlowControllerPriorityWithReservationSchedule>*>(flow_controller);
     ASSERT_TRUE(nullptr != async_limited_reserv_flow);
+
+    const char* async_limited_edf = "AsyncLimitedFlowControllerEarliestDeadline";
+    flow_controller_descr.name = async_limited_edf;
+    flow_controller_descr.scheduler = FlowControllerSchedulerPolicy::EARLIEST_DEADLINE_FIRST;
+    factory.register_flow_controller(flow_controller_descr);
+    flow_controller = factory.retrieve_flow_controller(async_limited_edf, writer_attributes);
+    FlowControllerImpl<FlowControllerLimitedAsyncPublishMode,
+            FlowControllerEarliestDeadlineFirstSchedule>* async_limited_edf_flow = dynamic_cast<FlowControllerImpl<FlowControllerLimitedAsyncPublishMode,
+                    FlowControllerEarliestDeadlineFirstSchedule>*>(flow_controller);
+    ASSERT_TRUE(nullptr != async_limited_edf_flow);
+}
+
+TEST(FlowControllerFactory, sender_threads)
+{
+    FlowControllerFactory factory;
+    FlowController* flow_controller = nullptr;
+    FlowControllerDescriptor flow_controller_descr;
+    eprosima::fastrtps::rtps::WriterAttributes writer_attributes;
+    eprosima::fastrtps::rtps::WriterAttributes async_attributes;
+    async_attributes.mode = eprosima::fastrtps::rtps::ASYNCHRONOUS_WRITER;
+
+    // Initialize factory with several threads for the default asynchronous flow controller.
+    factory.init(nullptr, 4);
+
+    flow_controller = factory.retrieve_flow_controller(FASTDDS_FLOW_CONTROLLER_DEFAULT, async_attributes);
+    FlowControllerShards* default_shards = dynamic_cast<FlowControllerShards*>(flow_controller);
+    ASSERT_TRUE(nullptr != default_shards);
+    ASSERT_EQ(4u, default_shards->number_of_shards());
+
+    // Asynchronous flow controller with several threads.
+    const char* async_threads = "AsyncFlowControllerThreads";
+    flow_controller_descr.name = async_threads;
+    flow_controller_descr.sender_threads = 2;
+    factory.register_flow_controller(flow_controller_descr);
+    flow_controller = factory.retrieve_flow_controller(async_threads, writer_attributes);
+    FlowControllerShards* async_shards = dynamic_cast<FlowControllerShards*>(flow_controller);
+    ASSERT_TRUE(nullptr != async_shards);
+    ASSERT_EQ(2u, async_shards->number_of_shards());
+
+    // Limited flow controllers use only one thread.
+    const char* async_limited_threads = "AsyncLimitedFlowControllerThreads";
+    flow_controller_descr.name = async_limited_threads;
+    flow_controller_descr.max_bytes_per_period = 10000;
+    factory.register_flow_controller(flow_controller_descr);
+    flow_controller = factory.retrieve_flow_controller(async_limited_threads, writer_attributes);
+    FlowControllerImpl<FlowControllerLimitedAsyncPublishMode,
+            FlowControllerFifoSchedule>* async_limited_flow = dynamic_cast<FlowControllerImpl<FlowControllerLimitedAsyncPublishMode,
+                    FlowControllerFifoSchedule>*>(flow_controller);
+    ASSERT_TRUE(nullptr != async_limited_flow);
 }
 
 int main(
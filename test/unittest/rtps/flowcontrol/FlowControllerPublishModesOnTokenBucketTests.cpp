@@ -0,0 +1,176 @@
+#include "FlowControllerPublishModesTests.hpp"
+
+using namespace eprosima::fastdds::rtps;
+using namespace testing;
+
+struct FlowControllerTokenBucketPublishModeMock : FlowControllerTokenBucketPublishMode
+{
+    FlowControllerTokenBucketPublishModeMock(
+            eprosima::fastrtps::rtps::RTPSParticipantImpl* participant,
+            const FlowControllerDescriptor* descriptor)
+        : FlowControllerTokenBucketPublishMode(participant, descriptor)
+    {
+        group_mock = &group;
+    }
+
+    static eprosima::fastrtps::rtps::RTPSMessageGroup* get_group()
+    {
+        return group_mock;
+    }
+
+    static eprosima::fastrtps::rtps::RTPSMessageGroup* group_mock;
+};
+eprosima::fastrtps::rtps::RTPSMessageGroup* FlowControllerTokenBucketPublishModeMock::group_mock = nullptr;
+
+TYPED_TEST(FlowControllerPublishModes, token_bucket_publish_mode)
+{
+    FlowControllerDescriptor flow_controller_descr;
+    flow_controller_descr.max_bytes_per_period = 10200;
+    flow_controller_descr.period_ms = 10;
+    flow_controller_descr.burst_bytes = 20400;
+    FlowControllerImpl<FlowControllerTokenBucketPublishModeMock, TypeParam> async(nullptr,
+            &flow_controller_descr);
+    async.init();
+
+    ASSERT_EQ(20400u, async.get_max_payload());
+
+    // Instantiate writers.
+    eprosima::fastrtps::rtps::RTPSWriter writer1;
+
+    // Initialize callback to get info.
+    auto send_functor = [&](
+        eprosima::fastrtps::rtps::CacheChange_t* change,
+        eprosima::fastrtps::rtps::RTPSMessageGroup&,
+        eprosima::fastrtps::rtps::LocatorSelectorSender&,
+        const std::chrono::time_point<std::chrono::steady_clock>&)
+            {
+                this->last_thread_delivering_sample = std::this_thread::get_id();
+                this->current_bytes_processed += change->serializedPayload.length;
+                EXPECT_CALL(*FlowControllerTokenBucketPublishModeMock::get_group(),
+                        get_current_bytes_processed()).WillRepeatedly(
+                    ReturnPointee(&this->current_bytes_processed));
+                {
+                    std::unique_lock<std::mutex> lock(this->changes_delivered_mutex);
+                    this->changes_delivered.push_back(change);
+                }
+                this->number_changes_delivered_cv.notify_one();
+            };
+
+    // Register writers.
+    async.register_writer(&writer1);
+
+    // Without per-locator limits the locators of the writer are not shaped.
+    EXPECT_EQ(nullptr, writer1.traffic_shaper_);
+
+    eprosima::fastrtps::rtps::CacheChange_t changes[10];
+    for (uint32_t i = 0; i < 10; ++i)
+    {
+        INIT_CACHE_CHANGE(changes[i], writer1, i + 1);
+        EXPECT_CALL(writer1,
+                deliver_sample_nts(&changes[i], _, Ref(writer1.async_locator_selector_), _)).
+                WillOnce(DoAll(send_functor, Return(eprosima::fastrtps::rtps::DeliveryRetCode::DELIVERED)));
+    }
+
+    EXPECT_CALL(*FlowControllerTokenBucketPublishModeMock::get_group(),
+            reset_current_bytes_processed()).WillRepeatedly([&]()
+            {
+                this->current_bytes_processed = 0;
+            });
+    EXPECT_CALL(*FlowControllerTokenBucketPublishModeMock::get_group(), get_current_bytes_processed()).
+            WillRepeatedly(ReturnPointee(&this->current_bytes_processed));
+
+    // Send 10 samples of 10000 bytes. The bucket starts full, so only the first two can be sent at once and the
+    // rest are sent at the configured rate.
+    auto start = std::chrono::steady_clock::now();
+    writer1.getMutex().lock();
+    for (uint32_t i = 0; i < 10; ++i)
+    {
+        ASSERT_TRUE(async.add_new_sample(&writer1, &changes[i],
+                std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    }
+    writer1.getMutex().unlock();
+    this->wait_changes_was_delivered(10);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    EXPECT_NE(std::this_thread::get_id(), this->last_thread_delivering_sample);
+    this->changes_delivered.clear();
+
+    // 80000 bytes at 1020 bytes per millisecond.
+    EXPECT_LE(std::chrono::milliseconds(70), elapsed);
+
+    async.unregister_writer(&writer1);
+}
+
+TEST(FlowControllerTokenBucket, per_locator_shaping)
+{
+    FlowControllerDescriptor flow_controller_descr;
+    flow_controller_descr.max_bytes_per_period = 102000;
+    flow_controller_descr.period_ms = 10;
+    flow_controller_descr.burst_bytes = 102000;
+    flow_controller_descr.max_bytes_per_period_per_locator = 10000;
+    flow_controller_descr.burst_bytes_per_locator = 20000;
+    FlowControllerTokenBucketPublishMode publish_mode(nullptr, &flow_controller_descr);
+
+    eprosima::fastrtps::rtps::RTPSWriter writer1;
+    publish_mode.register_writer(&writer1);
+    EXPECT_EQ(&publish_mode, writer1.traffic_shaper_);
+
+    eprosima::fastrtps::rtps::Locator_t slow_locator;
+    slow_locator.kind = LOCATOR_KIND_UDPv4;
+    slow_locator.port = 7410;
+    eprosima::fastrtps::rtps::Locator_t other_locator;
+    other_locator.kind = LOCATOR_KIND_UDPv4;
+    other_locator.port = 7411;
+
+    // Each locator has its own bucket, which starts full.
+    EXPECT_TRUE(publish_mode.consume(slow_locator, 10000));
+    EXPECT_TRUE(publish_mode.consume(slow_locator, 10000));
+    EXPECT_FALSE(publish_mode.consume(slow_locator, 10000));
+    EXPECT_TRUE(publish_mode.consume(other_locator, 10000));
+
+    // The bucket of the locator is refilled at the configured rate.
+    std::this_thread::sleep_for(std::chrono::milliseconds(15));
+    EXPECT_TRUE(publish_mode.consume(slow_locator, 10000));
+
+    publish_mode.unregister_writer(&writer1);
+    EXPECT_EQ(nullptr, writer1.traffic_shaper_);
+}
+
+TEST(FlowControllerTokenBucket, idle_locator_buckets_are_removed)
+{
+    FlowControllerDescriptor flow_controller_descr;
+    flow_controller_descr.max_bytes_per_period = 102000;
+    flow_controller_descr.period_ms = 10;
+    flow_controller_descr.burst_bytes = 102000;
+    flow_controller_descr.max_bytes_per_period_per_locator = 10000;
+    flow_controller_descr.burst_bytes_per_locator = 20000;
+    FlowControllerTokenBucketPublishMode publish_mode(nullptr, &flow_controller_descr);
+
+    eprosima::fastrtps::rtps::Locator_t active_locator;
+    active_locator.kind = LOCATOR_KIND_UDPv4;
+    active_locator.port = 7410;
+    eprosima::fastrtps::rtps::Locator_t idle_locator;
+    idle_locator.kind = LOCATOR_KIND_UDPv4;
+    idle_locator.port = 7411;
+
+    EXPECT_TRUE(publish_mode.consume(active_locator, 20000));
+    EXPECT_TRUE(publish_mode.consume(idle_locator, 20000));
+    EXPECT_EQ(2u, publish_mode.shaped_locators());
+
+    // Both buckets are full again after 20 milliseconds, and have been full for a period after 30.
+    std::this_thread::sleep_for(std::chrono::milliseconds(35));
+    EXPECT_TRUE(publish_mode.consume(active_locator, 10000));
+
+    // Make the next wait return without blocking.
+    publish_mode.process_deliver_retcode(eprosima::fastrtps::rtps::DeliveryRetCode::EXCEEDED_LIMIT);
+    std::mutex mutex;
+    std::unique_lock<std::mutex> lock(mutex);
+    EXPECT_TRUE(publish_mode.wait(lock));
+
+    // Only the bucket of the idle locator is removed.
+    EXPECT_EQ(1u, publish_mode.shaped_locators());
+
+    // A removed bucket is created again full.
+    EXPECT_TRUE(publish_mode.consume(idle_locator, 20000));
+    EXPECT_FALSE(publish_mode.consume(idle_locator, 10000));
+    EXPECT_EQ(2u, publish_mode.shaped_locators());
+}
@@ -3,6 +3,9 @@
 
 #include <gtest/gtest.h>
 
+#include <memory>
+#include <string>
+
 namespace eprosima {
 namespace fastrtps {
 namespace rtps {
@@ -2543,6 +2546,277 @@ TEST_F(FlowControllerSchedulers, PriorityWithReservation)
     async.unregister_writer(&writer10);
 }
 
+TEST_F(FlowControllerSchedulers, EarliestDeadlineFirst)
+{
+    FlowControllerDescriptor flow_controller_descr;
+    flow_controller_descr.max_bytes_per_period = 10200;
+    flow_controller_descr.period_ms = 10;
+    FlowControllerImpl<FlowControllerLimitedAsyncPublishModeMock, FlowControllerEarliestDeadlineFirstSchedule> async(
+        nullptr, &flow_controller_descr);
+    async.init();
+
+    // Instantiate writers.
+    eprosima::fastrtps::rtps::Property latency_budget_property;
+    latency_budget_property.name("fastdds.sfc.latency_budget_us");
+    eprosima::fastrtps::rtps::RTPSWriter writer1;
+    latency_budget_property.value("30000");
+    writer1.m_att.endpoint.properties.properties().push_back(latency_budget_property);
+    eprosima::fastrtps::rtps::RTPSWriter writer2;
+    latency_budget_property.value("10000");
+    writer2.m_att.endpoint.properties.properties().push_back(latency_budget_property);
+    // Writer without latency budget.
+    eprosima::fastrtps::rtps::RTPSWriter writer3;
+
+    // Initialize callback to get info.
+    auto send_functor = [&](
+        eprosima::fastrtps::rtps::CacheChange_t* change,
+        eprosima::fastrtps::rtps::RTPSMessageGroup&,
+        eprosima::fastrtps::rtps::LocatorSelectorSender&,
+        const std::chrono::time_point<std::chrono::steady_clock>&)
+            {
+                this->current_bytes_processed += change->serializedPayload.length;
+                {
+                    std::unique_lock<std::mutex> lock(this->changes_delivered_mutex);
+                    this->changes_delivered.push_back(change);
+                }
+                this->number_changes_delivered_cv.notify_one();
+            };
+
+    // Register writers.
+    async.register_writer(&writer1);
+    async.register_writer(&writer2);
+    async.register_writer(&writer3);
+
+    // Deadlines: 30ms, 35ms, 20ms, 35ms, none, none.
+    eprosima::fastrtps::rtps::CacheChange_t change_writer1_1;
+    eprosima::fastrtps::rtps::CacheChange_t change_writer1_2;
+    INIT_CACHE_CHANGE(change_writer1_1, writer1, 1);
+    INIT_CACHE_CHANGE(change_writer1_2, writer1, 2);
+    change_writer1_1.sourceTimestamp.from_ns(0);
+    change_writer1_2.sourceTimestamp.from_ns(5000000);
+    eprosima::fastrtps::rtps::CacheChange_t change_writer2_1;
+    eprosima::fastrtps::rtps::CacheChange_t change_writer2_2;
+    INIT_CACHE_CHANGE(change_writer2_1, writer2, 1);
+    INIT_CACHE_CHANGE(change_writer2_2, writer2, 2);
+    change_writer2_1.sourceTimestamp.from_ns(10000000);
+    change_writer2_2.sourceTimestamp.from_ns(25000000);
+    eprosima::fastrtps::rtps::CacheChange_t change_writer3_1;
+    eprosima::fastrtps::rtps::CacheChange_t change_writer3_2;
+    INIT_CACHE_CHANGE(change_writer3_1, writer3, 1);
+    INIT_CACHE_CHANGE(change_writer3_2, writer3, 2);
+    change_writer3_1.sourceTimestamp.from_ns(1000000);
+    change_writer3_2.sourceTimestamp.from_ns(2000000);
+
+    this->current_bytes_processed = 10100;
+    this->allow_resetting = false;
+    EXPECT_CALL(*FlowControllerLimitedAsyncPublishModeMock::get_group(),
+            get_current_bytes_processed()).WillRepeatedly(
+        ReturnPointee(&this->current_bytes_processed));
+    EXPECT_CALL(*FlowControllerLimitedAsyncPublishModeMock::get_group(),
+            reset_current_bytes_processed()).WillRepeatedly([&]()
+            {
+                if (this->allow_resetting)
+                {
+                    this->current_bytes_processed = 0;
+                }
+            });
+    auto& call_change_writer2_1 = EXPECT_CALL(writer2,
+                    deliver_sample_nts(&change_writer2_1, _, Ref(writer2.async_locator_selector_), _)).
+                    WillOnce(DoAll(send_functor, Return(eprosima::fastrtps::rtps::DeliveryRetCode::DELIVERED)));
+    auto& call_change_writer1_1 = EXPECT_CALL(writer1,
+                    deliver_sample_nts(&change_writer1_1, _, Ref(writer1.async_locator_selector_), _)).
+                    After(call_change_writer2_1).
+                    WillOnce(DoAll(send_functor, Return(eprosima::fastrtps::rtps::DeliveryRetCode::DELIVERED)));
+    auto& call_change_writer1_2 = EXPECT_CALL(writer1,
+                    deliver_sample_nts(&change_writer1_2, _, Ref(writer1.async_locator_selector_), _)).
+                    After(call_change_writer1_1).
+                    WillOnce(DoAll(send_functor, Return(eprosima::fastrtps::rtps::DeliveryRetCode::DELIVERED)));
+    auto& call_change_writer2_2 = EXPECT_CALL(writer2,
+                    deliver_sample_nts(&change_writer2_2, _, Ref(writer2.async_locator_selector_), _)).
+                    After(call_change_writer1_2).
+                    WillOnce(DoAll(send_functor, Return(eprosima::fastrtps::rtps::DeliveryRetCode::DELIVERED)));
+    auto& call_change_writer3_1 = EXPECT_CALL(writer3,
+                    deliver_sample_nts(&change_writer3_1, _, Ref(writer3.async_locator_selector_), _)).
+                    After(call_change_writer2_2).
+                    WillOnce(DoAll(send_functor, Return(eprosima::fastrtps::rtps::DeliveryRetCode::DELIVERED)));
+    EXPECT_CALL(writer3,
+            deliver_sample_nts(&change_writer3_2, _, Ref(writer3.async_locator_selector_), _)).
+            After(call_change_writer3_1).
+            WillOnce(DoAll(send_functor, Return(eprosima::fastrtps::rtps::DeliveryRetCode::DELIVERED)));
+
+    writer3.getMutex().lock();
+    ASSERT_TRUE(async.add_new_sample(&writer3, &change_writer3_1,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    ASSERT_TRUE(async.add_new_sample(&writer3, &change_writer3_2,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    writer3.getMutex().unlock();
+    writer1.getMutex().lock();
+    ASSERT_TRUE(async.add_new_sample(&writer1, &change_writer1_1,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    ASSERT_TRUE(async.add_new_sample(&writer1, &change_writer1_2,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    writer1.getMutex().unlock();
+    writer2.getMutex().lock();
+    ASSERT_TRUE(async.add_new_sample(&writer2, &change_writer2_1,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    ASSERT_TRUE(async.add_new_sample(&writer2, &change_writer2_2,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    writer2.getMutex().unlock();
+    this->allow_resetting = true;
+    this->wait_changes_was_delivered(6);
+    this->changes_delivered.clear();
+    this->current_bytes_processed = 0;
+
+    // Unregister writers.
+    async.unregister_writer(&writer1);
+    async.unregister_writer(&writer2);
+    async.unregister_writer(&writer3);
+}
+
+/*!
+ * Congestion scenario: three bulk writers enqueue a burst of samples with a large latency budget while an urgent
+ * writer publishes periodically with a short one. The flow controller can send one sample every 10 ms.
+ *
+ * @return Number of samples delivered after their latency budget.
+ */
+template<typename SampleScheduling>
+size_t count_latency_budget_misses()
+{
+    constexpr size_t num_bulk_writers = 3;
+    constexpr size_t bulk_samples = 10;
+    constexpr size_t urgent_samples = 6;
+    constexpr int64_t bulk_budget_ns = 1000000000;
+    constexpr int64_t urgent_budget_ns = 40000000;
+
+    FlowControllerDescriptor flow_controller_descr;
+    flow_controller_descr.max_bytes_per_period = 10200;
+    flow_controller_descr.period_ms = 10;
+    FlowControllerImpl<FlowControllerLimitedAsyncPublishModeMock, SampleScheduling> async(nullptr,
+            &flow_controller_descr);
+    async.init();
+
+    eprosima::fastrtps::rtps::Property latency_budget_property;
+    latency_budget_property.name("fastdds.sfc.latency_budget_us");
+    std::vector<std::unique_ptr<eprosima::fastrtps::rtps::RTPSWriter>> bulk_writers;
+    for (size_t i = 0; i < num_bulk_writers; ++i)
+    {
+        bulk_writers.emplace_back(new eprosima::fastrtps::rtps::RTPSWriter());
+        latency_budget_property.value(std::to_string(bulk_budget_ns / 1000));
+        bulk_writers.back()->m_att.endpoint.properties.properties().push_back(latency_budget_property);
+    }
+    eprosima::fastrtps::rtps::RTPSWriter urgent_writer;
+    latency_budget_property.value(std::to_string(urgent_budget_ns / 1000));
+    urgent_writer.m_att.endpoint.properties.properties().push_back(latency_budget_property);
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    size_t delivered = 0;
+    size_t misses = 0;
+    uint32_t current_bytes_processed = 0;
+    const size_t total_samples = num_bulk_writers * bulk_samples + urgent_samples;
+
+    auto send_functor = [&](
+        eprosima::fastrtps::rtps::CacheChange_t* change,
+        eprosima::fastrtps::rtps::RTPSMessageGroup&,
+        eprosima::fastrtps::rtps::LocatorSelectorSender&,
+        const std::chrono::time_point<std::chrono::steady_clock>&)
+            {
+                current_bytes_processed += change->serializedPayload.length;
+                int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now().time_since_epoch()).count();
+                int64_t budget = change->writerGUID == urgent_writer.getGuid() ? urgent_budget_ns : bulk_budget_ns;
+                std::unique_lock<std::mutex> lock(mutex);
+                if (now > change->sourceTimestamp.to_ns() + budget)
+                {
+                    ++misses;
+                }
+                ++delivered;
+                cv.notify_one();
+            };
+
+    EXPECT_CALL(*FlowControllerLimitedAsyncPublishModeMock::get_group(),
+            get_current_bytes_processed()).WillRepeatedly(ReturnPointee(&current_bytes_processed));
+    EXPECT_CALL(*FlowControllerLimitedAsyncPublishModeMock::get_group(),
+            reset_current_bytes_processed()).WillRepeatedly([&]()
+            {
+                current_bytes_processed = 0;
+            });
+
+    for (auto& writer : bulk_writers)
+    {
+        async.register_writer(writer.get());
+        EXPECT_CALL(*writer, deliver_sample_nts(_, _, _, _)).
+                WillRepeatedly(DoAll(send_functor, Return(eprosima::fastrtps::rtps::DeliveryRetCode::DELIVERED)));
+    }
+    async.register_writer(&urgent_writer);
+    EXPECT_CALL(urgent_writer, deliver_sample_nts(_, _, _, _)).
+            WillRepeatedly(DoAll(send_functor, Return(eprosima::fastrtps::rtps::DeliveryRetCode::DELIVERED)));
+
+    auto now_ns = []()
+            {
+                return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now().time_since_epoch()).count();
+            };
+
+    // Burst of bulk samples.
+    std::vector<std::unique_ptr<eprosima::fastrtps::rtps::CacheChange_t[]>> changes;
+    for (auto& writer : bulk_writers)
+    {
+        changes.emplace_back(new eprosima::fastrtps::rtps::CacheChange_t[bulk_samples]);
+        writer->getMutex().lock();
+        for (size_t i = 0; i < bulk_samples; ++i)
+        {
+            INIT_CACHE_CHANGE(changes.back()[i], (*writer), i + 1);
+            changes.back()[i].sourceTimestamp.from_ns(now_ns());
+            EXPECT_TRUE(async.add_new_sample(writer.get(), &changes.back()[i],
+                    std::chrono::steady_clock::now() + std::chrono::hours(24)));
+        }
+        writer->getMutex().unlock();
+    }
+
+    // Periodic urgent samples.
+    changes.emplace_back(new eprosima::fastrtps::rtps::CacheChange_t[urgent_samples]);
+    for (size_t i = 0; i < urgent_samples; ++i)
+    {
+        INIT_CACHE_CHANGE(changes.back()[i], urgent_writer, i + 1);
+        changes.back()[i].sourceTimestamp.from_ns(now_ns());
+        urgent_writer.getMutex().lock();
+        EXPECT_TRUE(async.add_new_sample(&urgent_writer, &changes.back()[i],
+                std::chrono::steady_clock::now() + std::chrono::hours(24)));
+        urgent_writer.getMutex().unlock();
+        std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&]()
+                {
+                    return total_samples == delivered;
+                });
+    }
+
+    for (auto& writer : bulk_writers)
+    {
+        async.unregister_writer(writer.get());
+    }
+    async.unregister_writer(&urgent_writer);
+
+    return misses;
+}
+
+/*!
+ * Under congestion the EARLIEST_DEADLINE_FIRST scheduler misses no more latency budgets than FIFO.
+ */
+TEST_F(FlowControllerSchedulers, LatencyBudgetMissesUnderCongestion)
+{
+    size_t fifo_misses = count_latency_budget_misses<FlowControllerFifoSchedule>();
+    size_t edf_misses = count_latency_budget_misses<FlowControllerEarliestDeadlineFirstSchedule>();
+
+    // FIFO sends the urgent samples after the whole burst, so it always misses some of them.
+    EXPECT_LT(0u, fifo_misses);
+    EXPECT_LE(edf_misses, fifo_misses);
+}
+
 int main(
         int argc,
         char** argv)
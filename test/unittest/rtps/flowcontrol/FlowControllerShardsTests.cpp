@@ -0,0 +1,195 @@
+#include <rtps/flowcontrol/FlowControllerShards.hpp>
+#include <rtps/flowcontrol/FlowControllerImpl.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <set>
+#include <thread>
+
+using namespace eprosima::fastdds::rtps;
+using namespace testing;
+
+class FlowControllerShardsTests : public testing::Test
+{
+protected:
+
+    struct WriterData
+    {
+        eprosima::fastrtps::rtps::RTPSWriter writer;
+        std::unique_ptr<eprosima::fastrtps::rtps::CacheChange_t[]> changes;
+        std::set<std::thread::id> threads;
+        std::vector<uint32_t> delivered;
+    };
+
+    std::unique_ptr<FlowController> create_flow_controller(
+            uint32_t sender_threads)
+    {
+        std::vector<std::unique_ptr<FlowController>> shards;
+        for (uint32_t i = 0; i < sender_threads; ++i)
+        {
+            shards.emplace_back(new FlowControllerImpl<FlowControllerAsyncPublishMode,
+                    FlowControllerFifoSchedule>(nullptr, nullptr));
+        }
+        std::unique_ptr<FlowController> flow_controller(new FlowControllerShards(std::move(shards)));
+        flow_controller->init();
+        return flow_controller;
+    }
+
+    /*!
+     * Sends num_samples samples from each writer and waits for all of them to be delivered.
+     * Each delivery takes send_time, emulating the time spent on the transports.
+     */
+    void send_samples(
+            FlowController& flow_controller,
+            std::vector<std::unique_ptr<WriterData>>& writers,
+            uint32_t num_samples,
+            std::chrono::microseconds send_time)
+    {
+        size_t total_samples = writers.size() * num_samples;
+        std::atomic<size_t> delivered{0};
+
+        for (auto& data : writers)
+        {
+            WriterData* writer_data = data.get();
+            writer_data->changes.reset(new eprosima::fastrtps::rtps::CacheChange_t[num_samples]);
+            for (uint32_t i = 0; i < num_samples; ++i)
+            {
+                eprosima::fastrtps::rtps::CacheChange_t& change = writer_data->changes[i];
+                change.writerGUID = writer_data->writer.getGuid();
+                change.writer_info.previous = nullptr;
+                change.writer_info.next = nullptr;
+                change.sequenceNumber.low = i + 1;
+                change.serializedPayload.length = 1000;
+            }
+
+            EXPECT_CALL(writer_data->writer, deliver_sample_nts(_, _, _, _)).WillRepeatedly(
+                [&, writer_data, send_time](
+                    eprosima::fastrtps::rtps::CacheChange_t* change,
+                    eprosima::fastrtps::rtps::RTPSMessageGroup&,
+                    eprosima::fastrtps::rtps::LocatorSelectorSender&,
+                    const std::chrono::time_point<std::chrono::steady_clock>&)
+                {
+                    std::this_thread::sleep_for(send_time);
+                    writer_data->threads.insert(std::this_thread::get_id());
+                    writer_data->delivered.push_back(change->sequenceNumber.low);
+                    if (total_samples == ++delivered)
+                    {
+                        std::lock_guard<std::mutex> lock(mutex_);
+                        cv_.notify_one();
+                    }
+                    return eprosima::fastrtps::rtps::DeliveryRetCode::DELIVERED;
+                });
+        }
+
+        for (uint32_t i = 0; i < num_samples; ++i)
+        {
+            for (auto& data : writers)
+            {
+                data->writer.getMutex().lock();
+                EXPECT_TRUE(flow_controller.add_new_sample(&data->writer, &data->changes[i],
+                        std::chrono::steady_clock::now() + std::chrono::hours(24)));
+                data->writer.getMutex().unlock();
+            }
+        }
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [&]()
+                {
+                    return total_samples == delivered;
+                });
+    }
+
+    std::vector<std::unique_ptr<WriterData>> create_writers(
+            FlowController& flow_controller,
+            size_t num_writers)
+    {
+        std::vector<std::unique_ptr<WriterData>> writers;
+        for (size_t i = 0; i < num_writers; ++i)
+        {
+            writers.emplace_back(new WriterData());
+            flow_controller.register_writer(&writers.back()->writer);
+        }
+        return writers;
+    }
+
+    void unregister_writers(
+            FlowController& flow_controller,
+            std::vector<std::unique_ptr<WriterData>>& writers)
+    {
+        for (auto& data : writers)
+        {
+            flow_controller.unregister_writer(&data->writer);
+        }
+    }
+
+    std::mutex mutex_;
+
+    std::condition_variable cv_;
+};
+
+TEST_F(FlowControllerShardsTests, writers_distributed_in_order)
+{
+    std::unique_ptr<FlowController> flow_controller = create_flow_controller(4);
+    auto writers = create_writers(*flow_controller, 8);
+
+    send_samples(*flow_controller, writers, 50, std::chrono::microseconds(10));
+
+    std::set<std::thread::id> all_threads;
+    for (auto& data : writers)
+    {
+        // All the samples of a writer are sent in order by the same thread.
+        ASSERT_EQ(1u, data->threads.size());
+        all_threads.insert(*data->threads.begin());
+        ASSERT_EQ(50u, data->delivered.size());
+        for (uint32_t i = 0; i < 50; ++i)
+        {
+            EXPECT_EQ(i + 1, data->delivered[i]);
+        }
+    }
+
+    // Writers are distributed among all the threads.
+    EXPECT_EQ(4u, all_threads.size());
+
+    unregister_writers(*flow_controller, writers);
+}
+
+TEST_F(FlowControllerShardsTests, remove_change)
+{
+    std::unique_ptr<FlowController> flow_controller = create_flow_controller(2);
+    auto writers = create_writers(*flow_controller, 2);
+
+    eprosima::fastrtps::rtps::CacheChange_t change;
+    change.writerGUID = writers[1]->writer.getGuid();
+    change.writer_info.previous = nullptr;
+    change.writer_info.next = nullptr;
+    change.serializedPayload.length = 1000;
+
+    // The writer doesn't deliver its samples, so they stay on the queue.
+    EXPECT_CALL(writers[1]->writer, deliver_sample_nts(_, _, _, _)).
+            WillRepeatedly(Return(eprosima::fastrtps::rtps::DeliveryRetCode::NOT_DELIVERED));
+    writers[1]->writer.getMutex().lock();
+    ASSERT_TRUE(flow_controller->add_new_sample(&writers[1]->writer, &change,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    writers[1]->writer.getMutex().unlock();
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    writers[1]->writer.getMutex().lock();
+    EXPECT_TRUE(nullptr != change.writer_info.next && nullptr != change.writer_info.previous);
+    flow_controller->remove_change(&change);
+    EXPECT_TRUE(nullptr == change.writer_info.next && nullptr == change.writer_info.previous);
+    writers[1]->writer.getMutex().unlock();
+
+    unregister_writers(*flow_controller, writers);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,251 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <rtps/DataSharing/ReaderPool.hpp>
+#include <rtps/DataSharing/WriterPool.hpp>
+#include <utils/SystemInfo.hpp>
+
+#include <memory>
+#include <vector>
+
+using namespace eprosima::fastrtps::rtps;
+
+constexpr uint32_t pool_size = 10u;
+constexpr uint32_t payload_size = 16u;
+
+/**
+ * Writer with a GUID that does not collide with the pools of other processes running the tests.
+ */
+class DataSharingTestWriter : public RTPSWriter
+{
+public:
+
+    DataSharingTestWriter()
+    {
+        uint32_t pid = eprosima::SystemInfo::instance().process_id();
+        memcpy(m_guid.guidPrefix.value, &pid, sizeof(pid));
+    }
+
+};
+
+class DataSharingPayloadPoolTests : public ::testing::Test
+{
+protected:
+
+    void SetUp() override
+    {
+        PoolConfig config{PREALLOCATED_MEMORY_MODE, payload_size, pool_size, pool_size};
+        writer_pool_ = std::dynamic_pointer_cast<WriterPool>(DataSharingPayloadPool::get_writer_pool(config));
+        ASSERT_TRUE(writer_pool_);
+        ASSERT_TRUE(writer_pool_->init_shared_memory(&writer_, ""));
+    }
+
+    static GUID_t reader_guid(
+            uint32_t index)
+    {
+        GUID_t guid;
+        guid.guidPrefix.value[0] = 1u;
+        guid.entityId.value[0] = static_cast<octet>(index >> 8);
+        guid.entityId.value[1] = static_cast<octet>(index);
+        guid.entityId.value[3] = 0x07;
+        return guid;
+    }
+
+    std::shared_ptr<ReaderPool> open_reader_pool(
+            const GUID_t& guid)
+    {
+        auto pool = std::static_pointer_cast<ReaderPool>(DataSharingPayloadPool::get_reader_pool(false));
+        EXPECT_TRUE(pool->init_shared_memory(writer_.getGuid(), ""));
+        pool->reader_guid(guid);
+        return pool;
+    }
+
+    /**
+     * Adds a new change to the writer's shared history
+     */
+    void add_change(
+            uint64_t filtered_readers)
+    {
+        CacheChange_t* change = new CacheChange_t();
+        ASSERT_TRUE(writer_pool_->get_payload(payload_size, *change));
+        change->writerGUID = writer_.getGuid();
+        change->sequenceNumber = SequenceNumber_t(0, static_cast<uint32_t>(changes_.size() + 1));
+        change->serializedPayload.length = payload_size;
+        writer_pool_->add_to_shared_history(change, filtered_readers);
+        changes_.emplace_back(change);
+    }
+
+    /**
+     * Reads all the available changes from a reader pool
+     * @return The sequence numbers read, with 0 added before each one preceded by skipped entries
+     */
+    static std::vector<uint32_t> read_all(
+            ReaderPool& pool)
+    {
+        std::vector<uint32_t> read;
+        while (true)
+        {
+            CacheChange_t ch;
+            SequenceNumber_t last_sequence;
+            pool.get_next_unread_payload(ch, last_sequence);
+            if (ch.sequenceNumber == c_SequenceNumber_Unknown)
+            {
+                break;
+            }
+
+            if (pool.filtered_since_last_read())
+            {
+                read.push_back(0u);
+            }
+            read.push_back(ch.sequenceNumber.low);
+            pool.release_payload(ch);
+            pool.advance_to_next_payload();
+        }
+        return read;
+    }
+
+    void TearDown() override
+    {
+        for (std::unique_ptr<CacheChange_t>& change : changes_)
+        {
+            writer_pool_->remove_from_shared_history(change.get());
+            writer_pool_->release_payload(*change);
+        }
+        changes_.clear();
+    }
+
+    DataSharingTestWriter writer_;
+
+    std::shared_ptr<WriterPool> writer_pool_;
+
+    std::vector<std::unique_ptr<CacheChange_t>> changes_;
+};
+
+/*
+ * Readers skip the entries the writer filtered out for them, and keep reading the rest.
+ */
+TEST_F(DataSharingPayloadPoolTests, filtered_reader_skips_entries)
+{
+    GUID_t filtered_guid = reader_guid(1);
+    GUID_t other_guid = reader_guid(2);
+    ASSERT_TRUE(writer_pool_->register_reader(filtered_guid));
+    ASSERT_TRUE(writer_pool_->register_reader(other_guid));
+
+    uint64_t filtered_mask = writer_pool_->reader_mask(filtered_guid);
+    ASSERT_NE(0u, filtered_mask);
+    ASSERT_NE(filtered_mask, writer_pool_->reader_mask(other_guid));
+
+    add_change(0u);
+    add_change(filtered_mask);
+    add_change(filtered_mask);
+    add_change(0u);
+    add_change(filtered_mask);
+
+    std::shared_ptr<ReaderPool> filtered_reader = open_reader_pool(filtered_guid);
+    std::shared_ptr<ReaderPool> other_reader = open_reader_pool(other_guid);
+
+    // The jump on the sequence numbers is signaled, so it is not taken as lost data
+    EXPECT_EQ(std::vector<uint32_t>({1u, 0u, 4u}), read_all(*filtered_reader));
+    EXPECT_EQ(std::vector<uint32_t>({1u, 2u, 3u, 4u, 5u}), read_all(*other_reader));
+}
+
+/*
+ * Readers without a slot, or pools without the reader GUID, receive every change.
+ */
+TEST_F(DataSharingPayloadPoolTests, unknown_reader_receives_all)
+{
+    add_change(~uint64_t(0));
+    add_change(~uint64_t(0));
+
+    std::shared_ptr<ReaderPool> unregistered_reader = open_reader_pool(reader_guid(1));
+    std::shared_ptr<ReaderPool> anonymous_reader = open_reader_pool(c_Guid_Unknown);
+
+    EXPECT_EQ(std::vector<uint32_t>({1u, 2u}), read_all(*unregistered_reader));
+    EXPECT_EQ(std::vector<uint32_t>({1u, 2u}), read_all(*anonymous_reader));
+}
+
+/*
+ * A slot released on unmatch is given to the next reader without the flags of its previous owner.
+ */
+TEST_F(DataSharingPayloadPoolTests, slot_reassigned_after_unmatch)
+{
+    GUID_t old_guid = reader_guid(1);
+    GUID_t new_guid = reader_guid(2);
+    ASSERT_TRUE(writer_pool_->register_reader(old_guid));
+    uint64_t mask = writer_pool_->reader_mask(old_guid);
+
+    add_change(mask);
+    add_change(0u);
+
+    std::shared_ptr<ReaderPool> old_reader = open_reader_pool(old_guid);
+
+    writer_pool_->unregister_reader(old_guid);
+    EXPECT_EQ(0u, writer_pool_->reader_mask(old_guid));
+
+    ASSERT_TRUE(writer_pool_->register_reader(new_guid));
+    EXPECT_EQ(mask, writer_pool_->reader_mask(new_guid));
+
+    add_change(mask);
+
+    // The entries flagged for the previous owner are read by the new one
+    std::shared_ptr<ReaderPool> new_reader = open_reader_pool(new_guid);
+    EXPECT_EQ(std::vector<uint32_t>({1u, 2u}), read_all(*new_reader));
+
+    // The previous owner no longer finds its slot, so it does not take the flags of the new one
+    EXPECT_EQ(std::vector<uint32_t>({1u, 2u, 3u}), read_all(*old_reader));
+}
+
+/*
+ * Readers beyond the available slots are not filtered.
+ */
+TEST_F(DataSharingPayloadPoolTests, more_readers_than_slots)
+{
+    uint64_t all_masks = 0u;
+    for (uint32_t i = 0; i < DataSharingPayloadPool::MAX_FILTERED_READERS; ++i)
+    {
+        ASSERT_TRUE(writer_pool_->register_reader(reader_guid(i)));
+        uint64_t mask = writer_pool_->reader_mask(reader_guid(i));
+        EXPECT_EQ(0u, all_masks & mask);
+        all_masks |= mask;
+    }
+    EXPECT_EQ(~uint64_t(0), all_masks);
+
+    GUID_t extra_guid = reader_guid(DataSharingPayloadPool::MAX_FILTERED_READERS);
+    EXPECT_FALSE(writer_pool_->register_reader(extra_guid));
+    EXPECT_EQ(0u, writer_pool_->reader_mask(extra_guid));
+
+    add_change(all_masks);
+    add_change(0u);
+
+    std::shared_ptr<ReaderPool> last_reader = open_reader_pool(
+        reader_guid(DataSharingPayloadPool::MAX_FILTERED_READERS - 1));
+    std::shared_ptr<ReaderPool> extra_reader = open_reader_pool(extra_guid);
+    EXPECT_EQ(std::vector<uint32_t>({0u, 2u}), read_all(*last_reader));
+    EXPECT_EQ(std::vector<uint32_t>({1u, 2u}), read_all(*extra_reader));
+
+    // Once a slot is released the extra reader can take it
+    writer_pool_->unregister_reader(reader_guid(5));
+    EXPECT_TRUE(writer_pool_->register_reader(extra_guid));
+    EXPECT_NE(0u, writer_pool_->reader_mask(extra_guid));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,174 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <fastrtps/publisher/PublisherHistory.h>
+#include <fastdds/rtps/writer/RTPSWriter.h>
+#include <fastrtps/utils/TimedMutex.hpp>
+
+#include <chrono>
+#include <mutex>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+/**
+ * PublisherHistory attached to a writer mock.
+ */
+class TestPublisherHistory : public PublisherHistory
+{
+public:
+
+    TestPublisherHistory(
+            const TopicAttributes& topic_att,
+            RTPSWriter* writer,
+            RecursiveTimedMutex* mutex)
+        : PublisherHistory(topic_att, 4, PREALLOCATED_MEMORY_MODE)
+    {
+        mp_writer = writer;
+        mp_mutex = mutex;
+    }
+
+};
+
+class PublisherHistoryTests : public ::testing::Test
+{
+protected:
+
+    PublisherHistoryTests()
+        : lock_(mutex_, std::defer_lock)
+    {
+        topic_att_.topicKind = WITH_KEY;
+        topic_att_.historyQos.kind = KEEP_LAST_HISTORY_QOS;
+        topic_att_.historyQos.depth = 1;
+        topic_att_.resourceLimitsQos.max_instances = 10;
+    }
+
+    static InstanceHandle_t instance(
+            uint8_t key)
+    {
+        InstanceHandle_t handle;
+        handle.value[0] = key;
+        return handle;
+    }
+
+    bool register_instance(
+            PublisherHistory& history,
+            uint8_t key)
+    {
+        return history.register_instance(instance(key), lock_, std::chrono::steady_clock::now());
+    }
+
+    TopicAttributes topic_att_;
+
+    RTPSWriter writer_;
+
+    RecursiveTimedMutex mutex_;
+
+    std::unique_lock<RecursiveTimedMutex> lock_;
+
+    std::chrono::steady_clock::time_point now_ = std::chrono::steady_clock::now();
+};
+
+/*
+ * A keyed history without instances has no next deadline.
+ */
+TEST_F(PublisherHistoryTests, no_deadline_without_instances)
+{
+    TestPublisherHistory history(topic_att_, &writer_, &mutex_);
+
+    InstanceHandle_t handle;
+    std::chrono::steady_clock::time_point next_deadline;
+    EXPECT_FALSE(history.get_next_deadline(handle, next_deadline));
+}
+
+/*
+ * The next deadline is the earliest one of all the instances, also after they are updated.
+ */
+TEST_F(PublisherHistoryTests, next_deadline_follows_updates)
+{
+    TestPublisherHistory history(topic_att_, &writer_, &mutex_);
+    for (uint8_t key = 1; key <= 3; ++key)
+    {
+        ASSERT_TRUE(register_instance(history, key));
+    }
+
+    ASSERT_TRUE(history.set_next_deadline(instance(1), now_ + std::chrono::seconds(3)));
+    ASSERT_TRUE(history.set_next_deadline(instance(2), now_ + std::chrono::seconds(1)));
+    ASSERT_TRUE(history.set_next_deadline(instance(3), now_ + std::chrono::seconds(2)));
+
+    InstanceHandle_t handle;
+    std::chrono::steady_clock::time_point next_deadline;
+    ASSERT_TRUE(history.get_next_deadline(handle, next_deadline));
+    EXPECT_EQ(instance(2), handle);
+    EXPECT_EQ(now_ + std::chrono::seconds(1), next_deadline);
+
+    // The earliest instance is pushed back
+    ASSERT_TRUE(history.set_next_deadline(instance(2), now_ + std::chrono::seconds(4)));
+    ASSERT_TRUE(history.get_next_deadline(handle, next_deadline));
+    EXPECT_EQ(instance(3), handle);
+    EXPECT_EQ(now_ + std::chrono::seconds(2), next_deadline);
+
+    // Another instance is brought forward
+    ASSERT_TRUE(history.set_next_deadline(instance(1), now_ + std::chrono::milliseconds(500)));
+    ASSERT_TRUE(history.get_next_deadline(handle, next_deadline));
+    EXPECT_EQ(instance(1), handle);
+    EXPECT_EQ(now_ + std::chrono::milliseconds(500), next_deadline);
+
+    // Unknown instances are not added
+    EXPECT_FALSE(history.set_next_deadline(instance(4), now_));
+    ASSERT_TRUE(history.get_next_deadline(handle, next_deadline));
+    EXPECT_EQ(instance(1), handle);
+}
+
+/*
+ * Removed instances are no longer returned as the next deadline.
+ */
+TEST_F(PublisherHistoryTests, removed_instance_leaves_deadlines)
+{
+    TestPublisherHistory history(topic_att_, &writer_, &mutex_);
+    ASSERT_TRUE(register_instance(history, 1));
+    ASSERT_TRUE(register_instance(history, 2));
+    ASSERT_TRUE(history.set_next_deadline(instance(1), now_ + std::chrono::seconds(1)));
+    ASSERT_TRUE(history.set_next_deadline(instance(2), now_ + std::chrono::seconds(2)));
+
+    ASSERT_TRUE(history.remove_instance_changes(instance(1), SequenceNumber_t(0, 1)));
+    EXPECT_FALSE(history.is_key_registered(instance(1)));
+
+    InstanceHandle_t handle;
+    std::chrono::steady_clock::time_point next_deadline;
+    ASSERT_TRUE(history.get_next_deadline(handle, next_deadline));
+    EXPECT_EQ(instance(2), handle);
+    EXPECT_EQ(now_ + std::chrono::seconds(2), next_deadline);
+
+    ASSERT_TRUE(history.remove_instance_changes(instance(2), SequenceNumber_t(0, 1)));
+    EXPECT_FALSE(history.get_next_deadline(handle, next_deadline));
+
+    // A registered instance again gets its deadline indexed
+    ASSERT_TRUE(register_instance(history, 1));
+    ASSERT_TRUE(history.set_next_deadline(instance(1), now_ + std::chrono::seconds(5)));
+    ASSERT_TRUE(history.get_next_deadline(handle, next_deadline));
+    EXPECT_EQ(instance(1), handle);
+    EXPECT_EQ(now_ + std::chrono::seconds(5), next_deadline);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleMock(&argc, argv);
+    return RUN_ALL_TESTS();
+}
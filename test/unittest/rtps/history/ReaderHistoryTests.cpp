@@ -218,6 +218,84 @@ TEST_F(ReaderHistoryTests, remove_changes_with_guid)
     ASSERT_EQ(history->getHistorySize(), num_changes - num_sequence_numbers);
 }
 
+TEST_F(ReaderHistoryTests, remove_fragmented_changes_until)
+{
+    // First change of each writer still has missing fragments
+    for (uint32_t i = 0; i < num_changes; i += num_sequence_numbers)
+    {
+        changes_list[i]->serializedPayload.reserve(history_attr.payloadMaxSize);
+        changes_list[i]->serializedPayload.length = 2;
+        changes_list[i]->setFragmentSize(1, true);
+    }
+
+    for (uint32_t i = 0; i < num_changes; i++)
+    {
+        history->add_change(changes_list[i]);
+    }
+
+    EXPECT_CALL(*readerMock, change_removed_by_history(_)).Times(1).
+            WillRepeatedly(Return(true));
+    EXPECT_CALL(*readerMock, releaseCache(_)).Times(1);
+
+    GUID_t w1 = GUID_t(GuidPrefix_t::unknown(), 1U);
+    ASSERT_TRUE(history->remove_fragmented_changes_until(SequenceNumber_t(0, 2U), w1));
+    ASSERT_EQ(history->getHistorySize(), num_changes - 1U);
+    ASSERT_EQ(history->find_change(changes_list[0]), history->changesEnd());
+    for (uint32_t i = 1; i < num_changes; i++)
+    {
+        ASSERT_NE(history->find_change(changes_list[i]), history->changesEnd());
+    }
+}
+
+TEST_F(ReaderHistoryTests, find_change_by_writer_and_sequence_number)
+{
+    for (uint32_t i = 0; i < num_changes; i++)
+    {
+        history->add_change(changes_list[i]);
+    }
+
+    // The change used for searching does not need to carry the source timestamp of the stored one
+    for (uint32_t i = 0; i < num_changes; i++)
+    {
+        CacheChange_t ch;
+        ch.writerGUID = changes_list[i]->writerGUID;
+        ch.sequenceNumber = changes_list[i]->sequenceNumber;
+        ch.sourceTimestamp = rtps::Time_t(1, 0);
+
+        auto it = history->find_change(&ch);
+        ASSERT_NE(it, history->changesEnd());
+        ASSERT_EQ(*it, changes_list[i]);
+    }
+
+    CacheChange_t unknown;
+    unknown.writerGUID = GUID_t(GuidPrefix_t::unknown(), num_writers + 1);
+    unknown.sequenceNumber = SequenceNumber_t(0, 1U);
+    ASSERT_EQ(history->find_change(&unknown), history->changesEnd());
+}
+
+TEST_F(ReaderHistoryTests, find_change_with_equal_timestamps)
+{
+    EXPECT_CALL(*readerMock, change_removed_by_history(_)).Times(num_changes).
+            WillRepeatedly(Return(true));
+    EXPECT_CALL(*readerMock, releaseCache(_)).Times(num_changes);
+
+    for (uint32_t i = 0; i < num_changes; i++)
+    {
+        changes_list[i]->sourceTimestamp = rtps::Time_t(0, 0);
+        history->add_change(changes_list[i]);
+    }
+
+    // Changes are removed from the index when removed from the history
+    for (uint32_t i = num_changes; i > 0; i--)
+    {
+        auto it = history->find_change(changes_list[i - 1]);
+        ASSERT_NE(it, history->changesEnd());
+        ASSERT_EQ(*it, changes_list[i - 1]);
+        ASSERT_TRUE(history->remove_change(changes_list[i - 1]));
+        ASSERT_EQ(history->find_change(changes_list[i - 1]), history->changesEnd());
+    }
+}
+
 int main(
         int argc,
         char** argv)
@@ -0,0 +1,218 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <fastdds/dds/topic/TopicDataType.hpp>
+#include <fastrtps/rtps/reader/StatefulReader.h>
+#include <fastrtps/subscriber/SubscriberHistory.h>
+#include <fastrtps/utils/TimedMutex.hpp>
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+using namespace ::testing;
+
+/**
+ * Type whose samples are never deserialized, as the changes carry their instance handle.
+ */
+class KeyedTestType : public eprosima::fastdds::dds::TopicDataType
+{
+public:
+
+    KeyedTestType()
+    {
+        setName("KeyedTestType");
+        m_typeSize = 4;
+        m_isGetKeyDefined = true;
+    }
+
+    bool serialize(
+            void*,
+            SerializedPayload_t*) override
+    {
+        return false;
+    }
+
+    bool deserialize(
+            SerializedPayload_t*,
+            void*) override
+    {
+        return false;
+    }
+
+    std::function<uint32_t()> getSerializedSizeProvider(
+            void*) override
+    {
+        return []()
+               {
+                   return 4u;
+               };
+    }
+
+    void* createData() override
+    {
+        return new uint32_t();
+    }
+
+    void deleteData(
+            void* data) override
+    {
+        delete static_cast<uint32_t*>(data);
+    }
+
+    bool getKey(
+            void*,
+            InstanceHandle_t*,
+            bool) override
+    {
+        return false;
+    }
+
+};
+
+class SubscriberHistoryTests : public Test
+{
+protected:
+
+    void SetUp() override
+    {
+        topic_att_.topicKind = WITH_KEY;
+        topic_att_.historyQos.kind = KEEP_LAST_HISTORY_QOS;
+        topic_att_.historyQos.depth = 1;
+        topic_att_.resourceLimitsQos.max_instances = 2;
+
+        history_.reset(new SubscriberHistory(topic_att_, &type_, ReaderQos(), 4, PREALLOCATED_MEMORY_MODE));
+        reader_.reset(new NiceMock<StatefulReader>(history_.get(), &mutex_));
+    }
+
+    static InstanceHandle_t instance(
+            uint8_t key)
+    {
+        InstanceHandle_t handle;
+        handle.value[0] = key;
+        return handle;
+    }
+
+    /**
+     * Receives a change for an instance.
+     */
+    CacheChange_t* receive(
+            uint8_t key)
+    {
+        changes_.emplace_back(new CacheChange_t());
+        CacheChange_t* change = changes_.back().get();
+        change->writerGUID = GUID_t(GuidPrefix_t::unknown(), 1u);
+        change->sequenceNumber = SequenceNumber_t(0, static_cast<uint32_t>(changes_.size()));
+        change->instanceHandle = instance(key);
+        EXPECT_TRUE(history_->received_change(change, 0));
+        return change;
+    }
+
+    TopicAttributes topic_att_;
+
+    KeyedTestType type_;
+
+    RecursiveTimedMutex mutex_;
+
+    std::unique_ptr<SubscriberHistory> history_;
+
+    std::unique_ptr<StatefulReader> reader_;
+
+    std::vector<std::unique_ptr<CacheChange_t>> changes_;
+
+    std::chrono::steady_clock::time_point now_ = std::chrono::steady_clock::now();
+};
+
+/*
+ * A keyed history without instances has no next deadline.
+ */
+TEST_F(SubscriberHistoryTests, no_deadline_without_instances)
+{
+    InstanceHandle_t handle;
+    std::chrono::steady_clock::time_point next_deadline;
+    EXPECT_FALSE(history_->get_next_deadline(handle, next_deadline));
+}
+
+/*
+ * The next deadline is the earliest one of all the instances, also after they are updated.
+ */
+TEST_F(SubscriberHistoryTests, next_deadline_follows_updates)
+{
+    receive(1);
+    receive(2);
+    ASSERT_TRUE(history_->set_next_deadline(instance(1), now_ + std::chrono::seconds(1)));
+    ASSERT_TRUE(history_->set_next_deadline(instance(2), now_ + std::chrono::seconds(2)));
+
+    InstanceHandle_t handle;
+    std::chrono::steady_clock::time_point next_deadline;
+    ASSERT_TRUE(history_->get_next_deadline(handle, next_deadline));
+    EXPECT_EQ(instance(1), handle);
+    EXPECT_EQ(now_ + std::chrono::seconds(1), next_deadline);
+
+    // A new sample on the earliest instance pushes its deadline back
+    receive(1);
+    ASSERT_TRUE(history_->set_next_deadline(instance(1), now_ + std::chrono::seconds(3)));
+    ASSERT_TRUE(history_->get_next_deadline(handle, next_deadline));
+    EXPECT_EQ(instance(2), handle);
+    EXPECT_EQ(now_ + std::chrono::seconds(2), next_deadline);
+
+    // Unknown instances are not added
+    EXPECT_FALSE(history_->set_next_deadline(instance(3), now_));
+    ASSERT_TRUE(history_->get_next_deadline(handle, next_deadline));
+    EXPECT_EQ(instance(2), handle);
+}
+
+/*
+ * An instance replaced by a new one, once the maximum number of instances is reached, leaves the deadlines.
+ */
+TEST_F(SubscriberHistoryTests, replaced_instance_leaves_deadlines)
+{
+    CacheChange_t* change = receive(1);
+    receive(2);
+    ASSERT_TRUE(history_->set_next_deadline(instance(1), now_ + std::chrono::seconds(1)));
+    ASSERT_TRUE(history_->set_next_deadline(instance(2), now_ + std::chrono::seconds(2)));
+
+    // The empty instance is kept until another one needs its place
+    ASSERT_TRUE(history_->remove_change_sub(change));
+    InstanceHandle_t handle;
+    std::chrono::steady_clock::time_point next_deadline;
+    ASSERT_TRUE(history_->get_next_deadline(handle, next_deadline));
+    EXPECT_EQ(instance(1), handle);
+
+    receive(3);
+    ASSERT_TRUE(history_->set_next_deadline(instance(3), now_ + std::chrono::seconds(3)));
+    EXPECT_FALSE(history_->set_next_deadline(instance(1), now_));
+
+    ASSERT_TRUE(history_->get_next_deadline(handle, next_deadline));
+    EXPECT_EQ(instance(2), handle);
+    EXPECT_EQ(now_ + std::chrono::seconds(2), next_deadline);
+
+    ASSERT_TRUE(history_->set_next_deadline(instance(2), now_ + std::chrono::seconds(4)));
+    ASSERT_TRUE(history_->get_next_deadline(handle, next_deadline));
+    EXPECT_EQ(instance(3), handle);
+    EXPECT_EQ(now_ + std::chrono::seconds(3), next_deadline);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleMock(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,359 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/common/NetworkBuffer.hpp>
+#include <fastdds/rtps/messages/RTPSMessageGroup.h>
+#include <fastdds/rtps/messages/RTPSMessageSenderInterface.hpp>
+#include <fastdds/rtps/writer/RTPSWriter.h>
+
+#include <rtps/participant/RTPSParticipantImpl.h>
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+using namespace eprosima::fastrtps::rtps;
+using ::testing::ReturnRef;
+
+/**
+ * Sender keeping a contiguous copy of every message, and the slices of the gathered ones.
+ */
+class GatheringSender : public RTPSMessageSenderInterface
+{
+public:
+
+    struct SentMessage
+    {
+        //! Whether the message was sent as a list of slices
+        bool gathered = false;
+
+        //! Slices of a gathered message
+        std::vector<NetworkBuffer> slices;
+
+        //! Contents of the message
+        std::vector<octet> data;
+    };
+
+    GatheringSender()
+    {
+        GUID_t reader_guid;
+        reader_guid.guidPrefix.value[0] = 2;
+        reader_guid.entityId = c_EntityId_Unknown;
+        reader_guid.entityId.value[3] = 4;
+        remote_guids_.push_back(reader_guid);
+        remote_participants_.push_back(reader_guid.guidPrefix);
+    }
+
+    bool destinations_have_changed() const override
+    {
+        return false;
+    }
+
+    GuidPrefix_t destination_guid_prefix() const override
+    {
+        return remote_participants_.front();
+    }
+
+    const std::vector<GuidPrefix_t>& remote_participants() const override
+    {
+        return remote_participants_;
+    }
+
+    const std::vector<GUID_t>& remote_guids() const override
+    {
+        return remote_guids_;
+    }
+
+    bool send(
+            CDRMessage_t* message,
+            std::chrono::steady_clock::time_point /*max_blocking_time_point*/) const override
+    {
+        SentMessage sent;
+        sent.data.assign(message->buffer, message->buffer + message->length);
+        messages.push_back(std::move(sent));
+        return true;
+    }
+
+    bool send(
+            const std::vector<NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            std::chrono::steady_clock::time_point /*max_blocking_time_point*/) const override
+    {
+        SentMessage sent;
+        sent.gathered = true;
+        sent.slices = buffers;
+        sent.data.resize(total_bytes);
+        EXPECT_EQ(total_bytes, copy_network_buffers(buffers, sent.data.data()));
+        messages.push_back(std::move(sent));
+        return true;
+    }
+
+    mutable std::vector<SentMessage> messages;
+
+private:
+
+    std::vector<GuidPrefix_t> remote_participants_;
+
+    std::vector<GUID_t> remote_guids_;
+};
+
+class RTPSMessageGroupTests : public ::testing::Test
+{
+protected:
+
+    void SetUp() override
+    {
+        participant_guid_.guidPrefix.value[0] = 1;
+        ON_CALL(participant_, getGuid()).WillByDefault(ReturnRef(participant_guid_));
+#if HAVE_SECURITY
+        ON_CALL(participant_, is_secure()).WillByDefault(::testing::Return(false));
+        ON_CALL(participant_, security_attributes()).WillByDefault(ReturnRef(security_attributes_));
+#endif // if HAVE_SECURITY
+        writer_.m_guid.guidPrefix = participant_guid_.guidPrefix;
+    }
+
+    /**
+     * Creates a change whose payload bytes depend on its sequence number.
+     */
+    std::unique_ptr<CacheChange_t> create_change(
+            uint32_t payload_size)
+    {
+        std::unique_ptr<CacheChange_t> change(new CacheChange_t(payload_size));
+        change->kind = ALIVE;
+        change->writerGUID = writer_.m_guid;
+        change->sequenceNumber = SequenceNumber_t(0, ++last_sequence_number_);
+        change->serializedPayload.length = payload_size;
+        for (uint32_t i = 0; i < payload_size; ++i)
+        {
+            change->serializedPayload.data[i] = static_cast<octet>(i + last_sequence_number_);
+        }
+        return change;
+    }
+
+    /**
+     * Checks the submessage lengths of a message lead exactly to its end.
+     */
+    static void check_submessages(
+            const std::vector<octet>& message)
+    {
+        ASSERT_GE(message.size(), static_cast<size_t>(RTPSMESSAGE_HEADER_SIZE));
+        size_t pos = RTPSMESSAGE_HEADER_SIZE;
+        while (pos < message.size())
+        {
+            ASSERT_LE(pos + 4, message.size());
+            bool little_endian = 0 != (message[pos + 1] & 0x01);
+            uint16_t length = little_endian ?
+                    static_cast<uint16_t>(message[pos + 2] | (message[pos + 3] << 8)) :
+                    static_cast<uint16_t>((message[pos + 2] << 8) | message[pos + 3]);
+            pos += 4u + length;
+        }
+        EXPECT_EQ(message.size(), pos);
+    }
+
+    /**
+     * Checks the bytes of a payload are found on a message.
+     */
+    static bool contains(
+            const std::vector<octet>& message,
+            const octet* payload,
+            uint32_t payload_size)
+    {
+        return std::search(message.begin(), message.end(), payload, payload + payload_size) != message.end();
+    }
+
+    /**
+     * Checks a slice of a gathered message points to the buffer of a payload.
+     */
+    static bool references(
+            const GatheringSender::SentMessage& message,
+            const octet* payload,
+            uint32_t payload_size)
+    {
+        for (const NetworkBuffer& slice : message.slices)
+        {
+            if (slice.buffer == payload && slice.size == payload_size)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    ::testing::NiceMock<RTPSParticipantImpl> participant_;
+
+    GUID_t participant_guid_;
+
+#if HAVE_SECURITY
+    security::ParticipantSecurityAttributes security_attributes_;
+#endif // if HAVE_SECURITY
+
+    RTPSWriter writer_;
+
+    GatheringSender sender_;
+
+    uint32_t last_sequence_number_ = 0;
+};
+
+#ifndef FASTDDS_STATISTICS
+
+/*
+ * Large payloads are sent from the buffers of the changes, interleaved with the serialized submessages.
+ */
+TEST_F(RTPSMessageGroupTests, large_payloads_are_referenced)
+{
+    std::unique_ptr<CacheChange_t> large_1 = create_change(8000);
+    std::unique_ptr<CacheChange_t> small = create_change(100);
+    std::unique_ptr<CacheChange_t> large_2 = create_change(5001);
+    uint32_t bytes_processed = 0;
+
+    {
+        RTPSMessageGroup group(&participant_, &writer_, &sender_,
+                std::chrono::steady_clock::now() + std::chrono::seconds(1));
+        ASSERT_TRUE(group.add_data(*large_1, false));
+        ASSERT_TRUE(group.add_data(*small, false));
+        ASSERT_TRUE(group.add_data(*large_2, false));
+        bytes_processed = group.get_current_bytes_processed();
+    }
+
+    ASSERT_EQ(1u, sender_.messages.size());
+    const GatheringSender::SentMessage& message = sender_.messages.front();
+    ASSERT_TRUE(message.gathered);
+
+    // Serialized part, large payload, serialized part with the small payload, large payload and padding
+    EXPECT_EQ(5u, message.slices.size());
+    EXPECT_TRUE(references(message, large_1->serializedPayload.data, 8000));
+    EXPECT_TRUE(references(message, large_2->serializedPayload.data, 5001));
+    EXPECT_FALSE(references(message, small->serializedPayload.data, 100));
+
+    check_submessages(message.data);
+    EXPECT_TRUE(contains(message.data, large_1->serializedPayload.data, 8000));
+    EXPECT_TRUE(contains(message.data, small->serializedPayload.data, 100));
+    EXPECT_TRUE(contains(message.data, large_2->serializedPayload.data, 5001));
+    EXPECT_EQ(0u, message.data.size() % 4);
+
+    // The referenced payloads count for the size of the message being built
+    EXPECT_EQ(bytes_processed, message.data.size());
+}
+
+/*
+ * Small payloads are copied into the message, which is sent contiguous.
+ */
+TEST_F(RTPSMessageGroupTests, small_payloads_are_copied)
+{
+    std::unique_ptr<CacheChange_t> small_1 = create_change(100);
+    std::unique_ptr<CacheChange_t> small_2 = create_change(4095);
+
+    {
+        RTPSMessageGroup group(&participant_, &writer_, &sender_,
+                std::chrono::steady_clock::now() + std::chrono::seconds(1));
+        ASSERT_TRUE(group.add_data(*small_1, false));
+        ASSERT_TRUE(group.add_data(*small_2, false));
+    }
+
+    ASSERT_EQ(1u, sender_.messages.size());
+    const GatheringSender::SentMessage& message = sender_.messages.front();
+    EXPECT_FALSE(message.gathered);
+    check_submessages(message.data);
+    EXPECT_TRUE(contains(message.data, small_1->serializedPayload.data, 100));
+    EXPECT_TRUE(contains(message.data, small_2->serializedPayload.data, 4095));
+}
+
+/*
+ * The room reserved for the referenced payloads is given back when the message is sent, so the following messages
+ * can be as big as the first one.
+ */
+TEST_F(RTPSMessageGroupTests, referenced_payloads_are_released)
+{
+    constexpr uint32_t num_changes = 40;
+    constexpr uint32_t payload_size = 20000;
+
+    std::vector<std::unique_ptr<CacheChange_t>> changes;
+    for (uint32_t i = 0; i < num_changes; ++i)
+    {
+        changes.push_back(create_change(payload_size));
+    }
+
+    {
+        RTPSMessageGroup group(&participant_, &writer_, &sender_,
+                std::chrono::steady_clock::now() + std::chrono::seconds(1));
+        for (const std::unique_ptr<CacheChange_t>& change : changes)
+        {
+            ASSERT_TRUE(group.add_data(*change, false));
+        }
+    }
+
+    // Three changes fit on each message
+    ASSERT_EQ((num_changes + 2) / 3, sender_.messages.size());
+
+    size_t change_index = 0;
+    for (const GatheringSender::SentMessage& message : sender_.messages)
+    {
+        ASSERT_TRUE(message.gathered);
+        EXPECT_LE(message.data.size(), participant_.getMaxMessageSize());
+        check_submessages(message.data);
+        for (size_t i = 0; i < 3 && change_index < changes.size(); ++i, ++change_index)
+        {
+            EXPECT_TRUE(references(message, changes[change_index]->serializedPayload.data, payload_size));
+        }
+    }
+    EXPECT_EQ(changes.size(), change_index);
+}
+
+/*
+ * The fragments of a change are sent from its buffer.
+ */
+TEST_F(RTPSMessageGroupTests, fragments_are_referenced)
+{
+    constexpr uint32_t fragment_size = 30000;
+    std::unique_ptr<CacheChange_t> change = create_change(100000);
+    change->setFragmentSize(fragment_size);
+    uint32_t num_fragments = change->getFragmentCount();
+    ASSERT_EQ(4u, num_fragments);
+
+    {
+        RTPSMessageGroup group(&participant_, &writer_, &sender_,
+                std::chrono::steady_clock::now() + std::chrono::seconds(1));
+        for (uint32_t fragment = 1; fragment <= num_fragments; ++fragment)
+        {
+            ASSERT_TRUE(group.add_data_frag(*change, fragment, false));
+        }
+    }
+
+    // Two fragments fit on each message
+    ASSERT_EQ(2u, sender_.messages.size());
+    for (uint32_t fragment = 1; fragment <= num_fragments; ++fragment)
+    {
+        const GatheringSender::SentMessage& message = sender_.messages[(fragment - 1) / 2];
+        uint32_t offset = (fragment - 1) * fragment_size;
+        uint32_t size = std::min(fragment_size, change->serializedPayload.length - offset);
+        ASSERT_TRUE(message.gathered);
+        check_submessages(message.data);
+        EXPECT_TRUE(references(message, change->serializedPayload.data + offset, size));
+    }
+}
+
+#endif // ifndef FASTDDS_STATISTICS
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleMock(&argc, argv);
+    return RUN_ALL_TESTS();
+}
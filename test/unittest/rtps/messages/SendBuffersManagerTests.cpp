@@ -0,0 +1,187 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <rtps/messages/SendBuffersManager.hpp>
+#include <rtps/participant/RTPSParticipantImpl.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace eprosima::fastrtps::rtps;
+using ::testing::ReturnRef;
+
+class SendBuffersManagerTests : public ::testing::Test
+{
+protected:
+
+    void SetUp() override
+    {
+        guid_.guidPrefix.value[0] = 1;
+        ON_CALL(participant_, getGuid()).WillByDefault(ReturnRef(guid_));
+#if HAVE_SECURITY
+        ON_CALL(participant_, is_secure()).WillByDefault(::testing::Return(false));
+#endif // if HAVE_SECURITY
+    }
+
+    /**
+     * Run several threads getting and returning buffers, checking no buffer is given to two threads at once.
+     */
+    void run_concurrent(
+            SendBuffersManager& manager,
+            size_t num_threads,
+            size_t iterations)
+    {
+        std::atomic<bool> failed{false};
+        std::vector<std::thread> threads;
+
+        for (size_t n = 0; n < num_threads; ++n)
+        {
+            threads.emplace_back([&, n]()
+                    {
+                        octet mark = static_cast<octet>(n + 1);
+                        for (size_t i = 0; i < iterations; ++i)
+                        {
+                            std::unique_ptr<RTPSMessageGroup_t> buffer = manager.get_buffer(&participant_);
+                            octet* data = buffer->rtpsmsg_submessage_.buffer;
+                            data[0] = mark;
+                            std::this_thread::yield();
+                            if (mark != data[0])
+                            {
+                                failed = true;
+                            }
+                            manager.return_buffer(std::move(buffer));
+                        }
+                    });
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_FALSE(failed);
+    }
+
+    ::testing::NiceMock<RTPSParticipantImpl> participant_;
+    GUID_t guid_;
+};
+
+TEST_F(SendBuffersManagerTests, reuses_reserved_buffers)
+{
+    SendBuffersManager manager(2, false);
+    manager.init(&participant_);
+
+    for (int i = 0; i < 10; ++i)
+    {
+        auto buffer_1 = manager.get_buffer(&participant_);
+        auto buffer_2 = manager.get_buffer(&participant_);
+        ASSERT_NE(buffer_1.get(), buffer_2.get());
+        manager.return_buffer(std::move(buffer_1));
+        manager.return_buffer(std::move(buffer_2));
+    }
+
+    SendBuffersStatistics statistics = manager.get_statistics();
+    EXPECT_EQ(statistics.created_buffers, 2u);
+    EXPECT_EQ(statistics.exhausted_count, 0u);
+    EXPECT_EQ(statistics.wait_count, 0u);
+}
+
+TEST_F(SendBuffersManagerTests, grows_when_allowed)
+{
+    SendBuffersManager manager(1, true);
+    manager.init(&participant_);
+
+    std::vector<std::unique_ptr<RTPSMessageGroup_t>> buffers;
+    for (int i = 0; i < 3; ++i)
+    {
+        buffers.push_back(manager.get_buffer(&participant_));
+    }
+    for (auto& buffer : buffers)
+    {
+        manager.return_buffer(std::move(buffer));
+    }
+
+    SendBuffersStatistics statistics = manager.get_statistics();
+    EXPECT_EQ(statistics.created_buffers, 3u);
+    EXPECT_EQ(statistics.exhausted_count, 2u);
+    EXPECT_EQ(statistics.wait_count, 0u);
+}
+
+TEST_F(SendBuffersManagerTests, waits_when_exhausted)
+{
+    SendBuffersManager manager(1, false);
+    manager.init(&participant_);
+
+    auto buffer = manager.get_buffer(&participant_);
+    RTPSMessageGroup_t* first = buffer.get();
+
+    std::atomic<bool> got_buffer{false};
+    std::thread waiting_thread([&]()
+            {
+                auto other = manager.get_buffer(&participant_);
+                EXPECT_EQ(first, other.get());
+                got_buffer = true;
+                manager.return_buffer(std::move(other));
+            });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    EXPECT_FALSE(got_buffer);
+    manager.return_buffer(std::move(buffer));
+    waiting_thread.join();
+    EXPECT_TRUE(got_buffer);
+
+    SendBuffersStatistics statistics = manager.get_statistics();
+    EXPECT_EQ(statistics.created_buffers, 1u);
+    EXPECT_EQ(statistics.exhausted_count, 1u);
+    EXPECT_EQ(statistics.wait_count, 1u);
+    EXPECT_GT(statistics.total_wait_time.count(), 0);
+}
+
+/*!
+ * Many threads of the same participant getting and returning buffers never share a buffer.
+ */
+TEST_F(SendBuffersManagerTests, concurrent_writers)
+{
+    constexpr size_t num_threads = 8;
+    constexpr size_t iterations = 200;
+
+    {
+        // Enough buffers for all the threads
+        SendBuffersManager manager(num_threads, false);
+        manager.init(&participant_);
+        run_concurrent(manager, num_threads, iterations);
+        EXPECT_EQ(manager.get_statistics().created_buffers, num_threads);
+    }
+
+    {
+        // Threads should wait for buffers
+        SendBuffersManager manager(num_threads / 4, false);
+        manager.init(&participant_);
+        run_concurrent(manager, num_threads, iterations);
+        EXPECT_EQ(manager.get_statistics().created_buffers, num_threads / 4);
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,137 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <rtps/reader/FragmentedChangeTracker.hpp>
+
+#include <chrono>
+#include <vector>
+
+using namespace eprosima::fastrtps::rtps;
+using clock_type = FragmentedChangeTracker::clock;
+
+TEST(FragmentedChangeTrackerTests, statistics)
+{
+    FragmentedChangeTracker tracker;
+    CacheChange_t change_1(100);
+    CacheChange_t change_2(200);
+
+    auto t0 = clock_type::now();
+    tracker.started(&change_1, t0);
+    tracker.started(&change_2, t0);
+    EXPECT_EQ(tracker.statistics().pending_samples, 2u);
+    EXPECT_EQ(tracker.statistics().pending_bytes, 300u);
+
+    tracker.progressed(&change_1, t0 + std::chrono::milliseconds(5));
+    tracker.completed(&change_1, t0 + std::chrono::milliseconds(10));
+    EXPECT_EQ(tracker.statistics().pending_samples, 1u);
+    EXPECT_EQ(tracker.statistics().pending_bytes, 200u);
+    EXPECT_EQ(tracker.statistics().completed_samples, 1u);
+    EXPECT_EQ(tracker.statistics().max_reassembly_time, std::chrono::milliseconds(10));
+    EXPECT_EQ(tracker.statistics().total_reassembly_time, std::chrono::milliseconds(10));
+
+    // Removed changes do not count as completed
+    tracker.removed(&change_2);
+    EXPECT_EQ(tracker.statistics().pending_samples, 0u);
+    EXPECT_EQ(tracker.statistics().pending_bytes, 0u);
+    EXPECT_EQ(tracker.statistics().completed_samples, 1u);
+
+    // Completing an untracked change has no effect
+    tracker.completed(&change_2, t0 + std::chrono::milliseconds(20));
+    EXPECT_EQ(tracker.statistics().completed_samples, 1u);
+}
+
+TEST(FragmentedChangeTrackerTests, evict_over_limits)
+{
+    FragmentedChangeTracker tracker;
+    tracker.configure(2, 250, clock_type::duration::zero());
+
+    CacheChange_t change_1(100);
+    CacheChange_t change_2(100);
+    std::vector<CacheChange_t*> discarded;
+    auto discard = [&discarded](CacheChange_t* change)
+            {
+                discarded.push_back(change);
+            };
+
+    auto t0 = clock_type::now();
+    tracker.evict(100, t0, discard);
+    tracker.started(&change_1, t0);
+    tracker.evict(100, t0, discard);
+    tracker.started(&change_2, t0 + std::chrono::milliseconds(1));
+    EXPECT_TRUE(discarded.empty());
+
+    // change_1 has received fragments more recently than change_2
+    tracker.progressed(&change_1, t0 + std::chrono::milliseconds(2));
+
+    // A third change exceeds the number of samples, so the stalest should be evicted
+    tracker.evict(10, t0 + std::chrono::milliseconds(3), discard);
+    ASSERT_EQ(discarded.size(), 1u);
+    EXPECT_EQ(discarded[0], &change_2);
+    EXPECT_EQ(tracker.statistics().pending_samples, 1u);
+    EXPECT_EQ(tracker.statistics().evicted_samples, 1u);
+
+    // A big change exceeds the number of bytes
+    discarded.clear();
+    tracker.evict(200, t0 + std::chrono::milliseconds(4), discard);
+    ASSERT_EQ(discarded.size(), 1u);
+    EXPECT_EQ(discarded[0], &change_1);
+    EXPECT_EQ(tracker.statistics().pending_bytes, 0u);
+
+    // Nothing left to evict, so a change bigger than the limit is allowed
+    discarded.clear();
+    tracker.evict(1000, t0 + std::chrono::milliseconds(5), discard);
+    EXPECT_TRUE(discarded.empty());
+}
+
+TEST(FragmentedChangeTrackerTests, evict_stale)
+{
+    FragmentedChangeTracker tracker;
+    tracker.configure(0, 0, std::chrono::milliseconds(100));
+
+    CacheChange_t change_1(100);
+    CacheChange_t change_2(100);
+    std::vector<CacheChange_t*> discarded;
+    auto discard = [&discarded](CacheChange_t* change)
+            {
+                discarded.push_back(change);
+            };
+
+    auto t0 = clock_type::now();
+    tracker.started(&change_1, t0);
+    tracker.started(&change_2, t0);
+    tracker.progressed(&change_2, t0 + std::chrono::milliseconds(80));
+
+    tracker.evict(0, t0 + std::chrono::milliseconds(50), discard);
+    EXPECT_TRUE(discarded.empty());
+
+    tracker.evict(0, t0 + std::chrono::milliseconds(150), discard);
+    ASSERT_EQ(discarded.size(), 1u);
+    EXPECT_EQ(discarded[0], &change_1);
+
+    tracker.evict(0, t0 + std::chrono::milliseconds(200), discard);
+    ASSERT_EQ(discarded.size(), 2u);
+    EXPECT_EQ(discarded[1], &change_2);
+    EXPECT_EQ(tracker.statistics().evicted_samples, 2u);
+    EXPECT_EQ(tracker.statistics().pending_samples, 0u);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -19,6 +19,7 @@
 #include <fastrtps/rtps/resources/ResourceEvent.h>
 #include <fastrtps/rtps/common/Time_t.h>
 #include <asio.hpp>
+#include <iostream>
 #include <thread>
 #include <condition_variable>
 #include <gtest/gtest.h>
@@ -478,6 +479,66 @@ TEST_F(LivelinessManagerTests, TimerOwnerRemoved)
     EXPECT_EQ(num_writers_lost, 1u);
 }
 
+//! Tests that a manual by topic writer keeps its liveliness when asserted through its liveliness data before the
+//! lease duration expires, and loses it when it stops asserting
+TEST_F(LivelinessManagerTests, AssertLivelinessByHandle)
+{
+    LivelinessManager liveliness_manager(
+                std::bind(&LivelinessManagerTests::liveliness_changed,
+                          this,
+                          std::placeholders::_1,
+                          std::placeholders::_2,
+                          std::placeholders::_3,
+                          std::placeholders::_4,
+                          std::placeholders::_5),
+                service_);
+
+    GuidPrefix_t guidP;
+    guidP.value[0] = 1;
+
+    liveliness_manager.add_writer(GUID_t(guidP, 1), MANUAL_BY_TOPIC_LIVELINESS_QOS, Duration_t(0.2));
+    liveliness_manager.add_writer(GUID_t(guidP, 2), MANUAL_BY_TOPIC_LIVELINESS_QOS, Duration_t(0.2));
+
+    EXPECT_EQ(liveliness_manager.get_writer(GUID_t(guidP, 3), MANUAL_BY_TOPIC_LIVELINESS_QOS, Duration_t(0.2)),
+            nullptr);
+    EXPECT_EQ(liveliness_manager.get_writer(GUID_t(guidP, 1), MANUAL_BY_TOPIC_LIVELINESS_QOS, Duration_t(0.1)),
+            nullptr);
+    EXPECT_FALSE(liveliness_manager.assert_liveliness(nullptr));
+
+    LivelinessData* writer = liveliness_manager.get_writer(
+        GUID_t(guidP, 2), MANUAL_BY_TOPIC_LIVELINESS_QOS, Duration_t(0.2));
+    ASSERT_NE(writer, nullptr);
+
+    // First assertion makes the writer alive
+    EXPECT_TRUE(liveliness_manager.assert_liveliness(writer));
+    wait_liveliness_recovered(1u);
+    EXPECT_EQ(writer_recovering_liveliness, GUID_t(guidP, 2));
+    auto liveliness_data = liveliness_manager.get_liveliness_data();
+    EXPECT_EQ(liveliness_data[0].status, LivelinessData::WriterStatus::NOT_ASSERTED);
+    EXPECT_EQ(liveliness_data[1].status, LivelinessData::WriterStatus::ALIVE);
+
+    // Keep asserting for longer than the lease duration
+    for (int i = 0; i < 10; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        EXPECT_TRUE(liveliness_manager.assert_liveliness(writer));
+    }
+    EXPECT_EQ(num_writers_lost, 0u);
+    EXPECT_EQ(num_writers_recovered, 1u);
+    liveliness_data = liveliness_manager.get_liveliness_data();
+    EXPECT_EQ(liveliness_data[1].status, LivelinessData::WriterStatus::ALIVE);
+    EXPECT_GT(liveliness_data[1].time, std::chrono::steady_clock::now());
+
+    // Stop asserting
+    wait_liveliness_lost(1u);
+    EXPECT_EQ(writer_losing_liveliness, GUID_t(guidP, 2));
+
+    // Asserting again recovers liveliness
+    EXPECT_TRUE(liveliness_manager.assert_liveliness(writer));
+    wait_liveliness_recovered(2u);
+    EXPECT_EQ(writer_recovering_liveliness, GUID_t(guidP, 2));
+}
+
 }
 }
 
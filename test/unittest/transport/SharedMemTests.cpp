@@ -28,6 +28,7 @@
 #include <memory>
 #include <gtest/gtest.h>
 #include <thread>
+#include <vector>
 
 using namespace eprosima::fastrtps;
 using namespace eprosima::fastrtps::rtps;
@@ -1424,6 +1425,237 @@ TEST_F(SHMTransportTests, dead_listener_sender_port_recover)
     thread_wait_deadlock.join();
 }
 
+TEST_F(SHMTransportTests, single_producer_lock_free_push)
+{
+    const std::string domain_name("SHMTests");
+
+    auto shared_mem_manager = SharedMemManager::create(domain_name);
+    SharedMemGlobal* shared_mem_global = shared_mem_manager->global_segment();
+
+    shared_mem_global->remove_port(0);
+    auto read_port = shared_mem_global->open_port(0, 4, 1000, SharedMemGlobal::Port::OpenMode::ReadExclusive);
+    uint32_t listener_index;
+    auto listener = read_port->create_listener(&listener_index);
+
+    auto write_port = shared_mem_global->open_port(0, 4, 1000, SharedMemGlobal::Port::OpenMode::Write);
+
+    SharedMemSegment::Id random_id;
+    random_id.generate();
+
+    const uint32_t num_messages = 10000;
+    std::atomic_bool is_listener_closed(false);
+    std::thread thread_listener([&]
+            {
+                for (uint32_t i = 0; i < num_messages; i++)
+                {
+                    while (listener->head() == nullptr)
+                    {
+                        read_port->wait_pop(*listener, is_listener_closed, listener_index);
+                    }
+
+                    EXPECT_TRUE(listener->head()->data().source_segment_id == random_id);
+                    EXPECT_EQ(i, listener->head()->data().validity_id);
+                    EXPECT_TRUE(listener->pop());
+                }
+            });
+
+    bool listeners_active;
+    for (uint32_t i = 0; i < num_messages; i++)
+    {
+        SharedMemGlobal::BufferDescriptor foo = {random_id, 0, i};
+        while (!write_port->try_push(foo, &listeners_active))
+        {
+            std::this_thread::yield();
+        }
+        ASSERT_TRUE(listeners_active);
+    }
+
+    thread_listener.join();
+
+    // A second producer disables the lock-free path, communication must continue working
+    auto write_port2 = shared_mem_global->open_port(0, 4, 1000, SharedMemGlobal::Port::OpenMode::Write);
+    SharedMemGlobal::BufferDescriptor foo = {random_id, 0, 0};
+    ASSERT_TRUE(write_port2->try_push(foo, &listeners_active));
+    ASSERT_TRUE(listeners_active);
+    ASSERT_TRUE(listener->head() != nullptr);
+    ASSERT_TRUE(listener->pop());
+
+    read_port->unregister_listener(&listener, listener_index);
+}
+
+TEST_F(SHMTransportTests, busy_poll_listener)
+{
+    const std::string domain_name("SHMTests");
+
+    auto shared_mem_manager = SharedMemManager::create(domain_name);
+
+    auto segment = shared_mem_manager->create_segment(16, 16);
+
+    shared_mem_manager->remove_port(0);
+    auto read_port = shared_mem_manager->open_port(0, 8, 1000, SharedMemGlobal::Port::OpenMode::ReadExclusive);
+    auto write_port = shared_mem_manager->open_port(0, 8, 1000, SharedMemGlobal::Port::OpenMode::Write);
+
+    // Adaptive mode: spins 100us and then blocks. Pure spin mode: never blocks.
+    for (bool busy_poll_only : {false, true})
+    {
+        auto listener = read_port->create_listener(100, busy_poll_only);
+
+        std::atomic<uint32_t> recv_count(0u);
+        auto thread_listener = std::thread([&]
+                        {
+                            while (recv_count.load() < 10u)
+                            {
+                                auto buffer = listener->pop();
+                                if (buffer)
+                                {
+                                    recv_count.fetch_add(1);
+                                }
+                            }
+                        });
+
+        for (uint32_t i = 0; i < 10u; i++)
+        {
+            auto buf = segment->alloc_buffer(1, std::chrono::steady_clock::time_point());
+            ASSERT_TRUE(write_port->try_push(buf));
+
+            // Let the listener fall back to blocking in adaptive mode
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        thread_listener.join();
+        ASSERT_EQ(recv_count.load(), 10u);
+
+        // close() must also break the spin
+        auto closing_thread = std::thread([&]
+                        {
+                            ASSERT_EQ(nullptr, listener->pop());
+                        });
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        listener->close();
+        closing_thread.join();
+    }
+}
+
+TEST_F(SHMTransportTests, huge_pages_segment)
+{
+    const std::string domain_name("SHMTests");
+
+    auto shared_mem_manager = SharedMemManager::create(domain_name);
+
+    // The segment must span whole huge pages, and be usable whether the system has huge pages or not
+    auto segment = shared_mem_manager->create_segment(1024, 16, true);
+    ASSERT_EQ(segment->mem_size() % SharedMemSegment::huge_page_size(), 0u);
+
+    auto buf = segment->alloc_buffer(1024, std::chrono::steady_clock::now() + std::chrono::milliseconds(100));
+    ASSERT_TRUE(buf != nullptr);
+    memset(buf->data(), 0xAA, buf->size());
+
+    ASSERT_EQ(SharedMemSegment::round_to_huge_pages(1) + SharedMemSegment::EXTRA_SEGMENT_SIZE,
+            SharedMemSegment::huge_page_size());
+}
+
+TEST_F(SHMTransportTests, lazy_segment)
+{
+    SharedMemTransportDescriptor my_descriptor;
+    my_descriptor.lazy_segment(true);
+
+    SharedMemTransport transportUnderTest(my_descriptor);
+    ASSERT_TRUE(transportUnderTest.init());
+
+    Locator_t unicastLocator;
+    unicastLocator.kind = LOCATOR_KIND_SHM;
+    unicastLocator.port = g_default_port;
+
+    Locator_t outputChannelLocator;
+    outputChannelLocator.kind = LOCATOR_KIND_SHM;
+    outputChannelLocator.port = g_default_port + 1;
+
+    Semaphore sem;
+    MockReceiverResource receiver(transportUnderTest, unicastLocator);
+    MockMessageReceiver* msg_recv = dynamic_cast<MockMessageReceiver*>(receiver.CreateMessageReceiver());
+
+    eprosima::fastrtps::rtps::SendResourceList send_resource_list;
+    ASSERT_TRUE(transportUnderTest.OpenOutputChannel(send_resource_list, outputChannelLocator));
+    ASSERT_FALSE(send_resource_list.empty());
+    octet message[5] = { 'H', 'e', 'l', 'l', 'o' };
+
+    std::function<void()> recCallback = [&]()
+            {
+                EXPECT_EQ(memcmp(message, msg_recv->data, 5), 0);
+                sem.post();
+            };
+    msg_recv->setCallback(recCallback);
+
+    LocatorList locator_list;
+    locator_list.push_back(unicastLocator);
+
+    // The first send maps the pages of the segment, the following ones reuse them
+    for (int i = 0; i < 2; ++i)
+    {
+        Locators locators_begin(locator_list.begin());
+        Locators locators_end(locator_list.end());
+
+        EXPECT_TRUE(send_resource_list.at(0)->send(message, 5, &locators_begin, &locators_end,
+                (std::chrono::steady_clock::now() + std::chrono::milliseconds(100))));
+        sem.wait();
+    }
+}
+
+/*
+ * Sends a message made of several slices, checking it is received with the slices in order.
+ */
+TEST_F(SHMTransportTests, send_gathered_slices)
+{
+    SharedMemTransportDescriptor my_descriptor;
+
+    SharedMemTransport transportUnderTest(my_descriptor);
+    ASSERT_TRUE(transportUnderTest.init());
+
+    Locator_t unicastLocator;
+    unicastLocator.kind = LOCATOR_KIND_SHM;
+    unicastLocator.port = g_default_port;
+
+    Locator_t outputChannelLocator;
+    outputChannelLocator.kind = LOCATOR_KIND_SHM;
+    outputChannelLocator.port = g_default_port + 1;
+
+    Semaphore sem;
+    MockReceiverResource receiver(transportUnderTest, unicastLocator);
+    MockMessageReceiver* msg_recv = dynamic_cast<MockMessageReceiver*>(receiver.CreateMessageReceiver());
+
+    eprosima::fastrtps::rtps::SendResourceList send_resource_list;
+    ASSERT_TRUE(transportUnderTest.OpenOutputChannel(send_resource_list, outputChannelLocator));
+    ASSERT_FALSE(send_resource_list.empty());
+
+    std::vector<octet> message(300);
+    for (size_t i = 0; i < message.size(); ++i)
+    {
+        message[i] = static_cast<octet>(i);
+    }
+
+    std::vector<NetworkBuffer> slices;
+    for (uint32_t pos = 0; pos < message.size(); pos += 100)
+    {
+        slices.emplace_back(&message[pos], 100);
+    }
+
+    std::function<void()> recCallback = [&]()
+            {
+                EXPECT_EQ(memcmp(message.data(), msg_recv->data, message.size()), 0);
+                sem.post();
+            };
+    msg_recv->setCallback(recCallback);
+
+    LocatorList locator_list;
+    locator_list.push_back(unicastLocator);
+    Locators locators_begin(locator_list.begin());
+    Locators locators_end(locator_list.end());
+
+    EXPECT_TRUE(send_resource_list.at(0)->send(slices, static_cast<uint32_t>(message.size()), &locators_begin,
+            &locators_end, (std::chrono::steady_clock::now() + std::chrono::milliseconds(100))));
+    sem.wait();
+}
+
 TEST_F(SHMTransportTests, port_not_ok_listener_recover)
 {
     const std::string domain_name("SHMTests");
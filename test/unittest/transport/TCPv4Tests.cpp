@@ -14,6 +14,7 @@
 
 #include <memory>
 #include <thread>
+#include <vector>
 
 #include <asio.hpp>
 #include <gtest/gtest.h>
@@ -31,6 +32,7 @@ using namespace eprosima::fastrtps;
 using namespace eprosima::fastrtps::rtps;
 using TCPv4Transport = eprosima::fastdds::rtps::TCPv4Transport;
 using TCPHeader = eprosima::fastdds::rtps::TCPHeader;
+using TCPChannelResourceBasic = eprosima::fastdds::rtps::TCPChannelResourceBasic;
 
 #if defined(_WIN32)
 #define GET_PID _getpid
@@ -73,6 +75,9 @@ public:
 
     void HELPER_SetDescriptorDefaults();
 
+    void HELPER_receive_unordered_data(
+            uint32_t reactor_threads);
+
     TCPv4TransportDescriptor descriptor;
     TCPv4TransportDescriptor descriptorOnlyOutput;
     std::unique_ptr<std::thread> senderThread;
@@ -232,6 +237,74 @@ TEST_F(TCPv4Tests, send_and_receive_between_ports)
     senderThread->join();
     sem.wait();
 }
+
+/*
+ * Sends a message made of several slices, checking it is received with the slices in order.
+ */
+TEST_F(TCPv4Tests, send_gathered_slices)
+{
+    TCPv4TransportDescriptor recvDescriptor;
+    recvDescriptor.add_listener_port(g_default_port);
+    TCPv4Transport receiveTransportUnderTest(recvDescriptor);
+    receiveTransportUnderTest.init();
+
+    TCPv4TransportDescriptor sendDescriptor;
+    TCPv4Transport sendTransportUnderTest(sendDescriptor);
+    sendTransportUnderTest.init();
+
+    Locator_t inputLocator;
+    inputLocator.kind = LOCATOR_KIND_TCPv4;
+    inputLocator.port = g_default_port;
+    IPLocator::setIPv4(inputLocator, 127, 0, 0, 1);
+    IPLocator::setLogicalPort(inputLocator, 7410);
+
+    LocatorList_t locator_list;
+    locator_list.push_back(inputLocator);
+
+    MockReceiverResource receiver(receiveTransportUnderTest, inputLocator);
+    MockMessageReceiver* msg_recv = dynamic_cast<MockMessageReceiver*>(receiver.CreateMessageReceiver());
+    ASSERT_TRUE(receiveTransportUnderTest.IsInputChannelOpen(inputLocator));
+
+    SendResourceList send_resource_list;
+    ASSERT_TRUE(sendTransportUnderTest.OpenOutputChannel(send_resource_list, inputLocator));
+    ASSERT_FALSE(send_resource_list.empty());
+
+    std::vector<octet> message(300);
+    for (size_t i = 0; i < message.size(); ++i)
+    {
+        message[i] = static_cast<octet>(i);
+    }
+
+    std::vector<NetworkBuffer> slices;
+    for (uint32_t pos = 0; pos < message.size(); pos += 100)
+    {
+        slices.emplace_back(&message[pos], 100);
+    }
+
+    Semaphore sem;
+    std::function<void()> recCallback = [&]()
+            {
+                EXPECT_EQ(memcmp(message.data(), msg_recv->data, message.size()), 0);
+                sem.post();
+            };
+    msg_recv->setCallback(recCallback);
+
+    // The send fails until the connection is negotiated
+    bool sent = false;
+    while (!sent)
+    {
+        Locators input_begin(locator_list.begin());
+        Locators input_end(locator_list.end());
+
+        sent = send_resource_list.at(0)->send(slices, static_cast<uint32_t>(message.size()), &input_begin,
+                        &input_end, (std::chrono::steady_clock::now() + std::chrono::microseconds(100)));
+        if (!sent)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+    sem.wait();
+}
 #endif // ifndef __APPLE__
 
 TEST_F(TCPv4Tests, send_is_rejected_if_buffer_size_is_bigger_to_size_specified_in_descriptor)
@@ -1333,6 +1406,150 @@ TEST_F(TCPv4Tests, send_and_receive_between_blocked_interfaces_ports)
 #endif // ifndef __APPLE__
 
 TEST_F(TCPv4Tests, receive_unordered_data)
+{
+    HELPER_receive_unordered_data(0u);
+}
+
+TEST_F(TCPv4Tests, receive_unordered_data_reactor)
+{
+    HELPER_receive_unordered_data(2u);
+}
+
+/*
+ * Sends messages from several threads through a channel coalescing its writes, with a queue bound smaller than the
+ * messages of all the threads, checking they are written whole and in the order each thread sent them.
+ */
+TEST_F(TCPv4Tests, coalesced_send_keeps_messages)
+{
+    constexpr uint32_t num_threads = 4;
+    constexpr uint32_t num_messages = 200;
+    constexpr size_t header_size = 8;
+    constexpr size_t data_size = 24;
+    constexpr size_t message_size = header_size + data_size;
+
+    asio::io_service service;
+    asio::ip::tcp::acceptor acceptor(service, asio::ip::tcp::endpoint(asio::ip::address_v4::loopback(), 0));
+    asio::ip::tcp::socket peer(service);
+    peer.connect(acceptor.local_endpoint());
+    auto socket = std::make_shared<asio::ip::tcp::socket>(service);
+    acceptor.accept(*socket);
+
+    TCPv4TransportDescriptor options;
+    options.sendBufferSize = 65536;
+    options.receiveBufferSize = 65536;
+    options.maxMessageSize = 4 * message_size;
+    options.enable_write_coalescing = true;
+    options.write_coalescing_max_latency_us = 50;
+    TCPChannelResourceBasic channel(nullptr, service, socket, options.maxMessageSize);
+    channel.set_options(&options);
+
+    std::vector<octet> received(num_threads * num_messages * message_size);
+    std::thread reader([&]()
+            {
+                asio::error_code ec;
+                asio::read(peer, asio::buffer(received), ec);
+                EXPECT_FALSE(ec);
+            });
+
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < num_threads; ++i)
+    {
+        threads.emplace_back([&, i]()
+                {
+                    std::array<octet, header_size> header{};
+                    std::array<octet, data_size> data{};
+                    header[0] = static_cast<octet>(i);
+                    for (uint32_t seq = 0; seq < num_messages; ++seq)
+                    {
+                        memcpy(&header[1], &seq, sizeof(seq));
+                        data.fill(static_cast<octet>(seq));
+                        asio::error_code ec;
+                        EXPECT_EQ(message_size, channel.send(header.data(), header_size, data.data(), data_size, ec));
+                        EXPECT_FALSE(ec);
+                    }
+                });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    reader.join();
+
+    std::array<uint32_t, num_threads> next_seq{};
+    for (size_t pos = 0; pos < received.size(); pos += message_size)
+    {
+        uint32_t thread_id = received[pos];
+        ASSERT_LT(thread_id, num_threads);
+        uint32_t seq;
+        memcpy(&seq, &received[pos + 1], sizeof(seq));
+        EXPECT_EQ(next_seq[thread_id]++, seq);
+        for (size_t i = header_size; i < message_size; ++i)
+        {
+            EXPECT_EQ(static_cast<octet>(seq), received[pos + i]);
+        }
+    }
+    for (uint32_t count : next_seq)
+    {
+        EXPECT_EQ(num_messages, count);
+    }
+}
+
+/*
+ * Sends messages from several threads through a channel coalescing its writes whose socket cannot send anymore,
+ * checking every message, also the ones queued by the threads not writing on the socket, reports the error.
+ */
+TEST_F(TCPv4Tests, coalesced_send_reports_errors)
+{
+    constexpr uint32_t num_threads = 4;
+    constexpr uint32_t num_messages = 50;
+    constexpr size_t message_size = 16;
+
+    asio::io_service service;
+    asio::ip::tcp::acceptor acceptor(service, asio::ip::tcp::endpoint(asio::ip::address_v4::loopback(), 0));
+    asio::ip::tcp::socket peer(service);
+    peer.connect(acceptor.local_endpoint());
+    auto socket = std::make_shared<asio::ip::tcp::socket>(service);
+    acceptor.accept(*socket);
+
+    TCPv4TransportDescriptor options;
+    options.sendBufferSize = 65536;
+    options.receiveBufferSize = 65536;
+    options.enable_write_coalescing = true;
+    options.write_coalescing_max_latency_us = 1000;
+    TCPChannelResourceBasic channel(nullptr, service, socket, options.maxMessageSize);
+    channel.set_options(&options);
+
+    socket->shutdown(asio::ip::tcp::socket::shutdown_send);
+
+    std::atomic<uint32_t> num_sent{0};
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < num_threads; ++i)
+    {
+        threads.emplace_back([&]()
+                {
+                    std::array<octet, message_size> message{};
+                    for (uint32_t seq = 0; seq < num_messages; ++seq)
+                    {
+                        asio::error_code ec;
+                        if (0 < channel.send(nullptr, 0, message.data(), message_size, ec) || !ec)
+                        {
+                            ++num_sent;
+                        }
+                    }
+                });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(0u, num_sent.load());
+}
+
+void TCPv4Tests::HELPER_receive_unordered_data(
+        uint32_t reactor_threads)
 {
     constexpr uint16_t logical_port = 7410;
     constexpr uint32_t num_bytes_1 = 3;
@@ -1381,6 +1598,7 @@ TEST_F(TCPv4Tests, receive_unordered_data)
 
     TCPv4TransportDescriptor test_descriptor = descriptor;
     test_descriptor.check_crc = false;
+    test_descriptor.reactor_threads = reactor_threads;
     TCPv4Transport uut(test_descriptor);
     ASSERT_TRUE(uut.init()) << "Failed to initialize transport. Port " << g_default_port << " may be in use";
 
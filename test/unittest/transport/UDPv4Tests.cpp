@@ -14,6 +14,7 @@
 
 #include <thread>
 #include <memory>
+#include <vector>
 
 #include <asio.hpp>
 #include <gtest/gtest.h>
@@ -615,6 +616,61 @@ TEST_F(UDPv4Tests, open_a_blocked_socket)
     }
 }
 
+/*
+ * Sends messages made of several slices, checking they are received as a single datagram with the slices in order.
+ * Lists with more slices than a gather send supports are sent from a contiguous copy.
+ */
+TEST_F(UDPv4Tests, send_gathered_slices)
+{
+    UDPv4TransportDescriptor my_descriptor;
+    UDPv4Transport transportUnderTest(my_descriptor);
+    ASSERT_TRUE(transportUnderTest.init());
+
+    Locator_t unicastLocator;
+    unicastLocator.kind = LOCATOR_KIND_UDPv4;
+    unicastLocator.port = g_default_port;
+    IPLocator::setIPv4(unicastLocator, 127, 0, 0, 1);
+
+    MockReceiverResource receiver(transportUnderTest, unicastLocator);
+    MockMessageReceiver* msg_recv = dynamic_cast<MockMessageReceiver*>(receiver.CreateMessageReceiver());
+
+    SendResourceList send_resource_list;
+    ASSERT_TRUE(transportUnderTest.OpenOutputChannel(send_resource_list, unicastLocator));
+    ASSERT_FALSE(send_resource_list.empty());
+
+    std::vector<octet> message(300);
+    for (size_t i = 0; i < message.size(); ++i)
+    {
+        message[i] = static_cast<octet>(i);
+    }
+
+    Semaphore sem;
+    std::function<void()> recCallback = [&]()
+            {
+                EXPECT_EQ(memcmp(message.data(), msg_recv->data, message.size()), 0);
+                sem.post();
+            };
+    msg_recv->setCallback(recCallback);
+
+    LocatorList_t locator_list;
+    locator_list.push_back(unicastLocator);
+
+    for (uint32_t slice_size : {100u, 3u})
+    {
+        std::vector<NetworkBuffer> slices;
+        for (uint32_t pos = 0; pos < message.size(); pos += slice_size)
+        {
+            slices.emplace_back(&message[pos], slice_size);
+        }
+
+        Locators locators_begin(locator_list.begin());
+        Locators locators_end(locator_list.end());
+        EXPECT_TRUE(send_resource_list.at(0)->send(slices, static_cast<uint32_t>(message.size()), &locators_begin,
+                &locators_end, (std::chrono::steady_clock::now() + std::chrono::milliseconds(100))));
+        sem.wait();
+    }
+}
+
 TEST_F(UDPv4Tests, simple_throughput)
 {
     const size_t sample_size = 1024;
@@ -0,0 +1,130 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastrtps/utils/IPFinder.h>
+#include <utils/InterfacesCache.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+class IPFinderTests : public ::testing::Test
+{
+protected:
+
+    static bool get_ips_from_system(
+            std::vector<IPFinder::info_IP>* vec_name,
+            bool return_loopback)
+    {
+        return IPFinder::getIPsFromSystem(vec_name, return_loopback);
+    }
+
+    static void expect_same_ips(
+            const std::vector<IPFinder::info_IP>& expected,
+            const std::vector<IPFinder::info_IP>& actual)
+    {
+        ASSERT_EQ(expected.size(), actual.size());
+        for (size_t i = 0; i < expected.size(); ++i)
+        {
+            EXPECT_EQ(expected[i].type, actual[i].type);
+            EXPECT_EQ(expected[i].name, actual[i].name);
+            EXPECT_EQ(expected[i].dev, actual[i].dev);
+            EXPECT_EQ(expected[i].locator, actual[i].locator);
+        }
+    }
+
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+using namespace eprosima::fastrtps::rtps;
+
+/*
+ * The cached addresses are the ones enumerated from the system, with and without the loopback ones.
+ */
+TEST_F(IPFinderTests, cached_ips_match_system)
+{
+    for (bool return_loopback : {false, true})
+    {
+        std::vector<IPFinder::info_IP> from_system;
+        ASSERT_TRUE(get_ips_from_system(&from_system, return_loopback));
+
+        std::vector<IPFinder::info_IP> cached;
+        ASSERT_TRUE(IPFinder::getIPs(&cached, return_loopback));
+        expect_same_ips(from_system, cached);
+    }
+}
+
+/*
+ * Repeated calls served from the cache append the same addresses, without dropping or duplicating any.
+ */
+TEST_F(IPFinderTests, repeated_calls_return_same_ips)
+{
+    for (bool return_loopback : {false, true})
+    {
+        std::vector<IPFinder::info_IP> first;
+        ASSERT_TRUE(IPFinder::getIPs(&first, return_loopback));
+
+        for (int i = 0; i < 5; ++i)
+        {
+            std::vector<IPFinder::info_IP> again;
+            ASSERT_TRUE(IPFinder::getIPs(&again, return_loopback));
+            expect_same_ips(first, again);
+        }
+
+        // The addresses are appended to the given list
+        std::vector<IPFinder::info_IP> twice;
+        ASSERT_TRUE(IPFinder::getIPs(&twice, return_loopback));
+        ASSERT_TRUE(IPFinder::getIPs(&twice, return_loopback));
+        ASSERT_EQ(2 * first.size(), twice.size());
+        expect_same_ips(first, std::vector<IPFinder::info_IP>(twice.begin(), twice.begin() + first.size()));
+        expect_same_ips(first, std::vector<IPFinder::info_IP>(twice.begin() + first.size(), twice.end()));
+    }
+}
+
+/*
+ * Without change notifications, as on platforms without netlink, the enumeration expires after its lifetime.
+ */
+TEST_F(IPFinderTests, polled_cache_expires)
+{
+    InterfacesCache cache(false);
+    cache.start_enumeration();
+    EXPECT_FALSE(cache.changed());
+
+    std::this_thread::sleep_for(c_interfaces_cache_lifetime / 2);
+    EXPECT_FALSE(cache.changed());
+
+    std::this_thread::sleep_for(c_interfaces_cache_lifetime);
+    EXPECT_TRUE(cache.changed());
+
+    // A new enumeration is valid for another lifetime
+    cache.start_enumeration();
+    EXPECT_FALSE(cache.changed());
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -3287,6 +3287,7 @@ TEST_F(XMLParserTests, getXMLEnum_positive)
  * 7. Correct parsing of a valid <data_sharing> set to AUTO with shared memory directory.
  * 8. Correct parsing of a valid <data_sharing> set to ON with shared memory directory.
  * 9. Correct parsing of a valid <data_sharing> set to OFF with shared memory directory.
+ * 10. Correct parsing of a valid <data_sharing> requesting huge pages.
  */
 TEST_F(XMLParserTests, getXMLDataSharingQos)
 {
@@ -3427,6 +3428,24 @@ TEST_F(XMLParserTests, getXMLDataSharingQos)
         EXPECT_EQ(datasharing_policy.max_domains(), 0u);
         EXPECT_EQ(datasharing_policy.domain_ids().size(), 0u);
     }
+
+    {
+        const char* xml =
+                "\
+                <data_sharing>\
+                    <kind>ON</kind>\
+                    <shared_dir>shared_dir</shared_dir>\
+                    <huge_pages>true</huge_pages>\
+                </data_sharing>\
+                ";
+
+        ASSERT_EQ(tinyxml2::XMLError::XML_SUCCESS, xml_doc.Parse(xml));
+        titleElement = xml_doc.RootElement();
+        EXPECT_EQ(XMLP_ret::XML_OK, XMLParserTest::propertiesPolicy_wrapper(titleElement, datasharing_policy, ident));
+        EXPECT_EQ(datasharing_policy.kind(), DataSharingKind::ON);
+        EXPECT_EQ(datasharing_policy.shm_directory(), "shared_dir");
+        EXPECT_TRUE(datasharing_policy.huge_pages());
+    }
 }
 
 /*
@@ -3438,6 +3457,7 @@ TEST_F(XMLParserTests, getXMLDataSharingQos)
  * 5. Check a negative max_domains.
  * 6. Check empty shared_dir.
  * 7. Check invalid tags (at different levels)
+ * 8. Check a non boolean huge_pages.
  */
 TEST_F(XMLParserTests, getXMLDataSharingQos_negativeCases)
 {
@@ -3558,6 +3578,21 @@ TEST_F(XMLParserTests, getXMLDataSharingQos_negativeCases)
                 XMLParserTest::propertiesPolicy_wrapper(titleElement, datasharing_policy, ident));
     }
 
+    {
+        const char* xml =
+                "\
+                <data_sharing>\
+                    <kind>AUTOMATIC</kind>\
+                    <huge_pages>maybe</huge_pages>\
+                </data_sharing>\
+                ";
+
+        ASSERT_EQ(tinyxml2::XMLError::XML_SUCCESS, xml_doc.Parse(xml));
+        titleElement = xml_doc.RootElement();
+        EXPECT_EQ(XMLP_ret::XML_ERROR,
+                XMLParserTest::propertiesPolicy_wrapper(titleElement, datasharing_policy, ident));
+    }
+
     {
         const char* xml =
                 "\
@@ -660,6 +660,10 @@ TEST_F(XMLParserTests, parseXMLTransportData)
                     <calculate_crc>false</calculate_crc>\
                     <check_crc>false</check_crc>\
                     <enable_tcp_nodelay>false</enable_tcp_nodelay>\
+                    <reactor_threads>2</reactor_threads>\
+                    <enable_write_coalescing>true</enable_write_coalescing>\
+                    <write_coalescing_max_latency_us>50</write_coalescing_max_latency_us>\
+                    <enable_tcp_cork>true</enable_tcp_cork>\
                     <tls><!-- TLS Section --></tls>\
                 </transport_descriptor>\
                 ";
@@ -692,6 +696,10 @@ TEST_F(XMLParserTests, parseXMLTransportData)
         EXPECT_EQ(pTCPv4Desc->logical_port_increment, 2u);
         EXPECT_EQ(pTCPv4Desc->listening_ports[0], 5100u);
         EXPECT_EQ(pTCPv4Desc->listening_ports[1], 5200u);
+        EXPECT_EQ(pTCPv4Desc->reactor_threads, 2u);
+        EXPECT_TRUE(pTCPv4Desc->enable_write_coalescing);
+        EXPECT_EQ(pTCPv4Desc->write_coalescing_max_latency_us, 50u);
+        EXPECT_TRUE(pTCPv4Desc->enable_tcp_cork);
         xmlparser::XMLProfileManager::DeleteInstance();
 
         // TCPv6
@@ -717,6 +725,10 @@ TEST_F(XMLParserTests, parseXMLTransportData)
         EXPECT_EQ(pTCPv6Desc->logical_port_increment, 2u);
         EXPECT_EQ(pTCPv6Desc->listening_ports[0], 5100u);
         EXPECT_EQ(pTCPv6Desc->listening_ports[1], 5200u);
+        EXPECT_EQ(pTCPv6Desc->reactor_threads, 2u);
+        EXPECT_TRUE(pTCPv6Desc->enable_write_coalescing);
+        EXPECT_EQ(pTCPv6Desc->write_coalescing_max_latency_us, 50u);
+        EXPECT_TRUE(pTCPv6Desc->enable_tcp_cork);
         xmlparser::XMLProfileManager::DeleteInstance();
     }
 
@@ -734,6 +746,10 @@ TEST_F(XMLParserTests, parseXMLTransportData)
                     <port_queue_capacity>512</port_queue_capacity>\
                     <healthy_check_timeout_ms>1000</healthy_check_timeout_ms>\
                     <rtps_dump_file>rtsp_messages.log</rtps_dump_file>\
+                    <listener_busy_poll_us>50</listener_busy_poll_us>\
+                    <listener_busy_poll_only>false</listener_busy_poll_only>\
+                    <huge_pages>true</huge_pages>\
+                    <lazy_segment>true</lazy_segment>\
                     <maxMessageSize>16384</maxMessageSize>\
                     <maxInitialPeersRange>100</maxInitialPeersRange>\
                 </transport_descriptor>\
@@ -749,6 +765,10 @@ TEST_F(XMLParserTests, parseXMLTransportData)
         EXPECT_EQ(pSHMDesc->port_queue_capacity(), 512u);
         EXPECT_EQ(pSHMDesc->healthy_check_timeout_ms(), 1000u);
         EXPECT_EQ(pSHMDesc->rtps_dump_file(), "rtsp_messages.log");
+        EXPECT_EQ(pSHMDesc->listener_busy_poll_us(), 50u);
+        EXPECT_FALSE(pSHMDesc->listener_busy_poll_only());
+        EXPECT_TRUE(pSHMDesc->huge_pages());
+        EXPECT_TRUE(pSHMDesc->lazy_segment());
         EXPECT_EQ(pSHMDesc->max_message_size(), 16384u);
         EXPECT_EQ(pSHMDesc->max_initial_peers_range(), 100u);
 
@@ -802,6 +822,10 @@ TEST_F(XMLParserTests, parseXMLTransportData_NegativeClauses)
         "calculate_crc",
         "check_crc",
         "enable_tcp_nodelay",
+        "reactor_threads",
+        "enable_write_coalescing",
+        "write_coalescing_max_latency_us",
+        "enable_tcp_cork",
         "tls",
         "bad_element"
     };
@@ -814,6 +838,10 @@ TEST_F(XMLParserTests, parseXMLTransportData_NegativeClauses)
         "port_queue_capacity",
         "healthy_check_timeout_ms",
         "rtps_dump_file",
+        "listener_busy_poll_us",
+        "listener_busy_poll_only",
+        "huge_pages",
+        "lazy_segment",
         "bad_element"
     };
 
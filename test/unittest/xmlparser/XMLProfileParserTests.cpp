@@ -991,6 +991,10 @@ TEST_F(XMLProfileParserTests, SHM_transport_descriptors_config)
     ASSERT_EQ(descriptor->port_queue_capacity(), std::numeric_limits<uint32_t>::max());
     ASSERT_EQ(descriptor->healthy_check_timeout_ms(), std::numeric_limits<uint32_t>::max());
     ASSERT_EQ(descriptor->rtps_dump_file(), "test_file.dump");
+    ASSERT_EQ(descriptor->listener_busy_poll_us(), std::numeric_limits<uint32_t>::max());
+    ASSERT_TRUE(descriptor->listener_busy_poll_only());
+    ASSERT_TRUE(descriptor->huge_pages());
+    ASSERT_TRUE(descriptor->lazy_segment());
     ASSERT_EQ(descriptor->maxMessageSize, 128000u);
     ASSERT_EQ(descriptor->max_message_size(), 128000u);
 }
@@ -1479,6 +1483,79 @@ TEST_F(XMLProfileParserTests, loadXMLFile)
 
 }
 
+/*
+ * Tests the parsing of profiles deferred with the FASTDDS_DEFERRED_XML_PROFILES environment variable.
+ *  1. Without the variable, a file with an incorrect profile is not loaded.
+ *  2. With the variable, the same file is loaded and its default profile is parsed right away.
+ *  3. Deferred profiles are parsed when they are first requested, and kept for the following requests.
+ *  4. The error on the incorrect profile is reported when it is requested.
+ */
+TEST_F(XMLProfileParserTests, deferred_profiles)
+{
+    const char* filename = "deferred_profiles.xml";
+    const char* xml =
+            "                                                                                                                  \
+        <profiles>                                                                                                     \
+            <participant profile_name=\"default_participant\" is_default_profile=\"true\">                             \
+                <domainId>2021</domainId>                                                                              \
+                <rtps></rtps>                                                                                          \
+            </participant>                                                                                             \
+            <participant profile_name=\"deferred_participant\">                                                        \
+                <domainId>2022</domainId>                                                                              \
+                <rtps></rtps>                                                                                          \
+            </participant>                                                                                             \
+            <publisher profile_name=\"deferred_publisher\">                                                            \
+                <userDefinedID>67</userDefinedID>                                                                      \
+            </publisher>                                                                                               \
+            <participant profile_name=\"wrong_participant\">                                                           \
+                <domainId>wrong</domainId>                                                                             \
+                <rtps></rtps>                                                                                          \
+            </participant>                                                                                             \
+        </profiles>                                                                                                    \
+    ";
+    tinyxml2::XMLDocument xml_doc;
+    ASSERT_EQ(tinyxml2::XMLError::XML_SUCCESS, xml_doc.Parse(xml));
+    xml_doc.SaveFile(filename);
+
+    EXPECT_EQ(xmlparser::XMLP_ret::XML_ERROR, xmlparser::XMLProfileManager::loadXMLFile(filename));
+    xmlparser::XMLProfileManager::DeleteInstance();
+
+#ifdef _WIN32
+    _putenv_s("FASTDDS_DEFERRED_XML_PROFILES", "1");
+#else
+    setenv("FASTDDS_DEFERRED_XML_PROFILES", "1", 1);
+#endif // ifdef _WIN32
+    EXPECT_EQ(xmlparser::XMLP_ret::XML_OK, xmlparser::XMLProfileManager::loadXMLFile(filename));
+
+    ParticipantAttributes participant_atts;
+    xmlparser::XMLProfileManager::getDefaultParticipantAttributes(participant_atts);
+    EXPECT_EQ(2021u, participant_atts.domainId);
+
+    for (int i = 0; i < 2; ++i)
+    {
+        EXPECT_EQ(xmlparser::XMLP_ret::XML_OK,
+                xmlparser::XMLProfileManager::fillParticipantAttributes("deferred_participant", participant_atts));
+        EXPECT_EQ(2022u, participant_atts.domainId);
+    }
+
+    PublisherAttributes publisher_atts;
+    EXPECT_EQ(xmlparser::XMLP_ret::XML_OK,
+            xmlparser::XMLProfileManager::fillPublisherAttributes("deferred_publisher", publisher_atts));
+    EXPECT_EQ(67, publisher_atts.getUserDefinedID());
+
+    EXPECT_EQ(xmlparser::XMLP_ret::XML_ERROR,
+            xmlparser::XMLProfileManager::fillParticipantAttributes("wrong_participant", participant_atts));
+    EXPECT_EQ(xmlparser::XMLP_ret::XML_ERROR,
+            xmlparser::XMLProfileManager::fillPublisherAttributes("deferred_participant", publisher_atts, false));
+
+#ifdef _WIN32
+    _putenv_s("FASTDDS_DEFERRED_XML_PROFILES", "");
+#else
+    unsetenv("FASTDDS_DEFERRED_XML_PROFILES");
+#endif // ifdef _WIN32
+    remove(filename);
+}
+
 int main(
         int argc,
         char** argv)
@@ -0,0 +1,219 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastdds/builtin/typelookup/TypeLookupReplyCache.hpp>
+#include <fastrtps/types/TypeObjectFactory.h>
+#include <fastdds/dds/log/Log.hpp>
+#include "idl/TypesTypeObject.h"
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+using namespace eprosima::fastrtps::types;
+using namespace eprosima::fastdds::dds::builtin;
+
+class TypeLookupReplyCacheTests : public ::testing::Test
+{
+public:
+
+    ~TypeLookupReplyCacheTests()
+    {
+        TypeObjectFactory::delete_instance();
+        eprosima::fastdds::dds::Log::KillThread();
+    }
+
+    static TypeIdentifier hashed_identifier(
+            octet kind,
+            uint32_t value)
+    {
+        TypeIdentifier type_id;
+        type_id._d(kind);
+        memset(type_id.equivalence_hash(), 0, 14);
+        memcpy(type_id.equivalence_hash(), &value, sizeof(value));
+        return type_id;
+    }
+
+    TypeLookupReplyCache cache_;
+};
+
+/*
+ * A getTypes answer is cached, and later requests are answered even if the factory no longer knows the type.
+ */
+TEST_F(TypeLookupReplyCacheTests, types_reply_is_cached)
+{
+    const TypeIdentifier* type_id = GetMyEnumStructIdentifier(false);
+    ASSERT_NE(nullptr, type_id);
+    ASSERT_NE(nullptr, GetMinimalMyEnumStructObject());
+
+    TypeLookup_getTypes_In in;
+    in.type_ids.push_back(*type_id);
+    TypeLookup_getTypes_Out out;
+    cache_.reply_types(*TypeObjectFactory::get_instance(), in, out);
+    ASSERT_EQ(1u, out.types.size());
+    EXPECT_EQ(*type_id, out.types[0].type_identifier());
+    EXPECT_EQ(*GetMinimalMyEnumStructObject(), out.types[0].type_object());
+    EXPECT_TRUE(out.complete_to_minimal.empty());
+
+    // The answer is taken from the cache once the type is unknown to the factory
+    TypeIdentifier requested = *type_id;
+    TypeObject object = out.types[0].type_object();
+    TypeObjectFactory::delete_instance();
+    TypeLookup_getTypes_Out cached;
+    in.type_ids[0] = requested;
+    cache_.reply_types(*TypeObjectFactory::get_instance(), in, cached);
+    ASSERT_EQ(1u, cached.types.size());
+    EXPECT_EQ(requested, cached.types[0].type_identifier());
+    EXPECT_EQ(object, cached.types[0].type_object());
+}
+
+/*
+ * Unknown types are neither answered nor cached.
+ */
+TEST_F(TypeLookupReplyCacheTests, unknown_type_is_not_cached)
+{
+    TypeLookup_getTypes_In in;
+    in.type_ids.push_back(hashed_identifier(EK_MINIMAL, 1u));
+    TypeLookup_getTypes_Out out;
+    cache_.reply_types(*TypeObjectFactory::get_instance(), in, out);
+    EXPECT_TRUE(out.types.empty());
+    EXPECT_TRUE(out.complete_to_minimal.empty());
+    EXPECT_FALSE(cache_.get_type(in.type_ids[0], out));
+}
+
+/*
+ * An EK_COMPLETE identifier resolved to a minimal one is answered from the cache with its complete_to_minimal pair.
+ * The answer is only given for the identifier that was requested.
+ */
+TEST_F(TypeLookupReplyCacheTests, complete_to_minimal_is_cached)
+{
+    TypeIdentifier complete_id = hashed_identifier(EK_COMPLETE, 2u);
+    TypeIdentifier minimal_id = hashed_identifier(EK_MINIMAL, 2u);
+
+    TypeIdentifierTypeObjectPair type;
+    type.type_identifier(complete_id);
+    type.type_object(*GetMinimalMyEnumStructObject());
+    TypeIdentifierPair complete_to_minimal;
+    complete_to_minimal.type_identifier1(minimal_id);
+    complete_to_minimal.type_identifier2(complete_id);
+    cache_.add_type(type, &complete_to_minimal);
+
+    TypeLookup_getTypes_Out out;
+    ASSERT_TRUE(cache_.get_type(complete_id, out));
+    ASSERT_EQ(1u, out.types.size());
+    EXPECT_EQ(complete_id, out.types[0].type_identifier());
+    EXPECT_EQ(*GetMinimalMyEnumStructObject(), out.types[0].type_object());
+    ASSERT_EQ(1u, out.complete_to_minimal.size());
+    EXPECT_EQ(minimal_id, out.complete_to_minimal[0].type_identifier1());
+    EXPECT_EQ(complete_id, out.complete_to_minimal[0].type_identifier2());
+
+    // Same hash, different kind
+    TypeLookup_getTypes_Out minimal_out;
+    EXPECT_FALSE(cache_.get_type(minimal_id, minimal_out));
+    EXPECT_TRUE(minimal_out.types.empty());
+}
+
+/*
+ * A dependencies answer is cached only when the requested types and their dependencies are all registered.
+ */
+TEST_F(TypeLookupReplyCacheTests, dependencies_of_unregistered_types_are_not_cached)
+{
+    const TypeIdentifier* type_id = GetMyEnumStructIdentifier(false);
+    ASSERT_NE(nullptr, type_id);
+    ASSERT_NE(nullptr, GetMinimalMyEnumStructObject());
+
+    // One of the requested types is not registered
+    TypeLookup_getTypeDependencies_In in;
+    in.type_ids.push_back(*type_id);
+    in.type_ids.push_back(hashed_identifier(EK_MINIMAL, 3u));
+    TypeLookup_getTypeDependencies_Out out;
+    cache_.reply_type_dependencies(*TypeObjectFactory::get_instance(), in, out);
+    ASSERT_EQ(1u, out.dependent_typeids.size());
+    EXPECT_EQ(*GetMyEnumIdentifier(false), out.dependent_typeids[0].type_id());
+    TypeLookup_getTypeDependencies_Out cached;
+    EXPECT_FALSE(cache_.get_dependencies(in, cached));
+
+    // Every type is registered
+    in.type_ids.pop_back();
+    out = TypeLookup_getTypeDependencies_Out();
+    cache_.reply_type_dependencies(*TypeObjectFactory::get_instance(), in, out);
+    ASSERT_EQ(1u, out.dependent_typeids.size());
+    ASSERT_TRUE(cache_.get_dependencies(in, cached));
+    ASSERT_EQ(1u, cached.dependent_typeids.size());
+    EXPECT_EQ(out.dependent_typeids[0].type_id(), cached.dependent_typeids[0].type_id());
+}
+
+/*
+ * The continuation point of a dependencies request is part of its key.
+ */
+TEST_F(TypeLookupReplyCacheTests, dependencies_key_includes_continuation_point)
+{
+    TypeLookup_getTypeDependencies_In in;
+    in.type_ids.push_back(hashed_identifier(EK_MINIMAL, 4u));
+    in.continuation_point.push_back(0);
+
+    TypeLookup_getTypeDependencies_Out out;
+    TypeIdentifierWithSize dependency;
+    dependency.type_id(hashed_identifier(EK_MINIMAL, 5u));
+    out.dependent_typeids.push_back(dependency);
+    out.continuation_point.push_back(1);
+    cache_.add_dependencies(in, out);
+
+    TypeLookup_getTypeDependencies_Out cached;
+    ASSERT_TRUE(cache_.get_dependencies(in, cached));
+    ASSERT_EQ(1u, cached.dependent_typeids.size());
+    EXPECT_EQ(dependency.type_id(), cached.dependent_typeids[0].type_id());
+    EXPECT_EQ(out.continuation_point, cached.continuation_point);
+
+    TypeLookup_getTypeDependencies_In next = in;
+    next.continuation_point[0] = 1;
+    EXPECT_FALSE(cache_.get_dependencies(next, cached));
+}
+
+/*
+ * The dependencies answers are cleared when their maximum number is reached.
+ */
+TEST_F(TypeLookupReplyCacheTests, dependencies_cleared_at_max_entries)
+{
+    TypeLookup_getTypeDependencies_Out out;
+    TypeLookup_getTypeDependencies_In in;
+    in.type_ids.push_back(TypeIdentifier());
+    for (uint32_t i = 0; i < TypeLookupReplyCache::max_dependency_entries; ++i)
+    {
+        in.type_ids[0] = hashed_identifier(EK_MINIMAL, i);
+        cache_.add_dependencies(in, out);
+    }
+
+    TypeLookup_getTypeDependencies_In first;
+    first.type_ids.push_back(hashed_identifier(EK_MINIMAL, 0u));
+    TypeLookup_getTypeDependencies_Out cached;
+    EXPECT_TRUE(cache_.get_dependencies(first, cached));
+    EXPECT_TRUE(cache_.get_dependencies(in, cached));
+
+    // One more entry clears the previous ones
+    TypeLookup_getTypeDependencies_In last;
+    last.type_ids.push_back(hashed_identifier(EK_MINIMAL,
+            static_cast<uint32_t>(TypeLookupReplyCache::max_dependency_entries)));
+    cache_.add_dependencies(last, out);
+    EXPECT_FALSE(cache_.get_dependencies(first, cached));
+    EXPECT_FALSE(cache_.get_dependencies(in, cached));
+    EXPECT_TRUE(cache_.get_dependencies(last, cached));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}